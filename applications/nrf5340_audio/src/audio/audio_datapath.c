@@ -90,6 +90,19 @@ LOG_MODULE_REGISTER(audio_datapath, CONFIG_AUDIO_DATAPATH_LOG_LEVEL);
 /* How often to print under-run warning */
 #define UNDERRUN_LOG_INTERVAL_BLKS 5000
 
+/* Period over which the lowest output FIFO depth is tracked before adjusting the depth */
+#define JITTER_BUF_WINDOW_US	     500000
+#define JITTER_BUF_WINDOW_FRAMES     (JITTER_BUF_WINDOW_US / CONFIG_AUDIO_FRAME_DURATION_US)
+/* Headroom to keep in the output FIFO, in multiples of the smoothed jitter */
+#define JITTER_BUF_JITTER_MULT	     3
+/* Gain of the jitter estimator is 1/16, as in RFC 3550 */
+#define JITTER_BUF_JITTER_GAIN_SHIFT 4
+
+#if CONFIG_AUDIO_DATAPATH_JITTER_BUF
+BUILD_ASSERT((CONFIG_AUDIO_DATAPATH_JITTER_BUF_MAX_BLKS + NUM_BLKS_IN_FRAME) < FIFO_NUM_BLKS,
+	     "Jitter buffer depth does not fit in the output FIFO");
+#endif /* CONFIG_AUDIO_DATAPATH_JITTER_BUF */
+
 enum drift_comp_state {
 	DRIFT_STATE_INIT,   /* Waiting for data to be received */
 	DRIFT_STATE_CALIB,  /* Calibrate and zero out local delay */
@@ -159,6 +172,24 @@ static struct {
 		uint32_t pres_delay_us;
 		bool enabled;
 	} pres_comp;
+
+#if CONFIG_AUDIO_DATAPATH_JITTER_BUF
+	struct {
+		audio_datapath_plc_cb_t plc_cb;
+		uint32_t jitter_us_q4; /* Smoothed inter-arrival jitter in 1/16 us */
+		int32_t prev_transit_us;
+		bool prev_transit_valid;
+		uint16_t target_blks;	 /* Wanted FIFO depth when a frame arrives */
+		uint16_t min_depth_blks; /* Lowest FIFO depth in the current window */
+		uint16_t window_ctr;
+		uint16_t conceal_run; /* Consecutive concealed blocks */
+		/* Statistics */
+		uint32_t total_blks_concealed;
+		uint32_t total_bad_frames;
+		uint32_t total_blks_inserted;
+		uint32_t total_blks_dropped;
+	} jitter_buf;
+#endif /* CONFIG_AUDIO_DATAPATH_JITTER_BUF */
 } ctrl_blk;
 
 static bool tone_active;
@@ -479,6 +510,149 @@ static void audio_datapath_presentation_compensation(uint32_t recv_frame_ts_us,
 	}
 }
 
+/**
+ * @brief	Get the number of audio blocks in the output FIFO.
+ */
+static uint32_t out_fifo_num_blks_get(void)
+{
+	return (ctrl_blk.out.prod_blk_idx + FIFO_NUM_BLKS - ctrl_blk.out.cons_blk_idx) %
+	       FIFO_NUM_BLKS;
+}
+
+#if CONFIG_AUDIO_DATAPATH_JITTER_BUF
+/**
+ * @brief	Default packet loss concealment, fading out the previous block.
+ *
+ * @note	Each concealed block has half the amplitude of the previous one,
+ *		until the configured number of blocks has been concealed.
+ */
+static void plc_fade_out(void *blk, void const *prev_blk, size_t size, uint32_t num_concealed)
+{
+	if (num_concealed >= CONFIG_AUDIO_DATAPATH_JITTER_BUF_FADE_BLKS) {
+		memset(blk, 0, size);
+		return;
+	}
+
+	if (IS_ENABLED(CONFIG_AUDIO_BIT_DEPTH_16)) {
+		for (size_t i = 0; i < size / sizeof(int16_t); i++) {
+			((int16_t *)blk)[i] = ((int16_t const *)prev_blk)[i] / 2;
+		}
+	} else if (IS_ENABLED(CONFIG_AUDIO_BIT_DEPTH_32)) {
+		for (size_t i = 0; i < size / sizeof(int32_t); i++) {
+			((int32_t *)blk)[i] = ((int32_t const *)prev_blk)[i] / 2;
+		}
+	}
+}
+
+/**
+ * @brief	Fill an output block with concealment audio.
+ *
+ * @param	blk		Block to fill.
+ * @param	prev_blk	Block played before the missing one.
+ * @param	num_concealed	Number of consecutive blocks concealed before this one.
+ */
+static void jitter_buf_conceal(void *blk, void const *prev_blk, uint32_t num_concealed)
+{
+	audio_datapath_plc_cb_t plc_cb = ctrl_blk.jitter_buf.plc_cb;
+
+	if (plc_cb == NULL) {
+		plc_cb = plc_fade_out;
+	}
+
+	plc_cb(blk, prev_blk, BLK_STEREO_SIZE_OCTETS, num_concealed);
+
+	ctrl_blk.jitter_buf.total_blks_concealed++;
+}
+
+/**
+ * @brief	Update the arrival jitter estimate and the target FIFO depth.
+ *
+ * @note	The jitter is the smoothed variation of the time from sdu_ref_us to
+ *		reception of the frame, as the interarrival jitter in RFC 3550.
+ *
+ * @param	recv_frame_ts_us	Timestamp of when frame was received.
+ * @param	sdu_ref_us		ISO timestamp reference from Bluetooth LE controller.
+ * @param	sdu_ref_not_consecutive	True if sdu_ref_us and the previous sdu_ref_us
+ *					originate from non-consecutive frames.
+ */
+static void jitter_buf_jitter_update(uint32_t recv_frame_ts_us, uint32_t sdu_ref_us,
+				     bool sdu_ref_not_consecutive)
+{
+	int32_t transit_us = recv_frame_ts_us - sdu_ref_us;
+	uint32_t jitter_us;
+	uint32_t target_blks;
+
+	if (ctrl_blk.jitter_buf.prev_transit_valid && !sdu_ref_not_consecutive) {
+		int32_t delta_us = abs(transit_us - ctrl_blk.jitter_buf.prev_transit_us);
+
+		/* J += (|D| - J) / 16, with J kept in 1/16 us */
+		ctrl_blk.jitter_buf.jitter_us_q4 +=
+			delta_us - (ctrl_blk.jitter_buf.jitter_us_q4 >> JITTER_BUF_JITTER_GAIN_SHIFT);
+	}
+
+	ctrl_blk.jitter_buf.prev_transit_us = transit_us;
+	ctrl_blk.jitter_buf.prev_transit_valid = true;
+
+	jitter_us = ctrl_blk.jitter_buf.jitter_us_q4 >> JITTER_BUF_JITTER_GAIN_SHIFT;
+	target_blks = CONFIG_AUDIO_DATAPATH_JITTER_BUF_MIN_BLKS +
+		      DIV_ROUND_UP(jitter_us * JITTER_BUF_JITTER_MULT, BLK_PERIOD_US);
+
+	ctrl_blk.jitter_buf.target_blks = MIN(target_blks, CONFIG_AUDIO_DATAPATH_JITTER_BUF_MAX_BLKS);
+}
+
+/**
+ * @brief	Move the output FIFO depth one block towards the target depth.
+ *
+ * @note	The lowest depth seen when frames arrive is tracked over a window. At the end
+ *		of the window, one block is dropped if this depth was above the target, or one
+ *		concealed block is inserted if it was below. Adjusting by a single block at a
+ *		time avoids the audible gaps of larger jumps.
+ *
+ * @param	recv_frame_ts_us	Timestamp of when frame was received.
+ */
+static void jitter_buf_depth_adjust(uint32_t recv_frame_ts_us)
+{
+	uint32_t depth_blks = out_fifo_num_blks_get();
+
+	if (ctrl_blk.jitter_buf.window_ctr == 0 || depth_blks < ctrl_blk.jitter_buf.min_depth_blks) {
+		ctrl_blk.jitter_buf.min_depth_blks = depth_blks;
+	}
+
+	if (++ctrl_blk.jitter_buf.window_ctr < JITTER_BUF_WINDOW_FRAMES) {
+		return;
+	}
+
+	ctrl_blk.jitter_buf.window_ctr = 0;
+
+	/* The presentation delay dictates the FIFO depth when compensation is running */
+	if (ctrl_blk.pres_comp.enabled) {
+		return;
+	}
+
+	if (ctrl_blk.jitter_buf.min_depth_blks > ctrl_blk.jitter_buf.target_blks) {
+		ctrl_blk.out.prod_blk_idx = PREV_IDX(ctrl_blk.out.prod_blk_idx);
+		ctrl_blk.jitter_buf.total_blks_dropped++;
+
+		LOG_DBG("Jitter buffer block dropped, min depth: %d target: %d",
+			ctrl_blk.jitter_buf.min_depth_blks, ctrl_blk.jitter_buf.target_blks);
+	} else if (ctrl_blk.jitter_buf.min_depth_blks < ctrl_blk.jitter_buf.target_blks) {
+		uint16_t prod_blk_idx = ctrl_blk.out.prod_blk_idx;
+
+		jitter_buf_conceal(&ctrl_blk.out.fifo[prod_blk_idx * BLK_STEREO_NUM_SAMPS],
+				   &ctrl_blk.out.fifo[PREV_IDX(prod_blk_idx) * BLK_STEREO_NUM_SAMPS], 0);
+
+		/* Record producer block start reference */
+		ctrl_blk.out.prod_blk_ts[prod_blk_idx] = recv_frame_ts_us - BLK_PERIOD_US;
+
+		ctrl_blk.out.prod_blk_idx = NEXT_IDX(prod_blk_idx);
+		ctrl_blk.jitter_buf.total_blks_inserted++;
+
+		LOG_DBG("Jitter buffer block inserted, min depth: %d target: %d",
+			ctrl_blk.jitter_buf.min_depth_blks, ctrl_blk.jitter_buf.target_blks);
+	}
+}
+#endif /* CONFIG_AUDIO_DATAPATH_JITTER_BUF */
+
 static void tone_stop_worker(struct k_work *work)
 {
 	tone_active = false;
@@ -641,6 +815,10 @@ static void audio_datapath_i2s_blk_complete(uint32_t frame_start_ts_us, uint32_t
 						ctrl_blk.out.total_blk_underruns);
 				}
 
+#if CONFIG_AUDIO_DATAPATH_JITTER_BUF
+				ctrl_blk.jitter_buf.conceal_run = 0;
+#endif /* CONFIG_AUDIO_DATAPATH_JITTER_BUF */
+
 				tx_buf = (uint8_t *)&ctrl_blk.out
 						 .fifo[next_out_blk_idx * BLK_STEREO_NUM_SAMPS];
 
@@ -656,6 +834,10 @@ static void audio_datapath_i2s_blk_complete(uint32_t frame_start_ts_us, uint32_t
 					}
 				}
 
+#if CONFIG_AUDIO_DATAPATH_JITTER_BUF
+				uint8_t const *prev_tx_buf = tx_buf;
+#endif /* CONFIG_AUDIO_DATAPATH_JITTER_BUF */
+
 				/*
 				 * No data available in out.fifo
 				 * use alternative buffers
@@ -663,7 +845,17 @@ static void audio_datapath_i2s_blk_complete(uint32_t frame_start_ts_us, uint32_t
 				ret = alt_buffer_get((void **)&tx_buf);
 				ERR_CHK(ret);
 
+#if CONFIG_AUDIO_DATAPATH_JITTER_BUF
+				/* Conceal the missing block instead of outputting silence */
+				if (underrun_condition && prev_tx_buf != NULL) {
+					jitter_buf_conceal(tx_buf, prev_tx_buf,
+							   ctrl_blk.jitter_buf.conceal_run++);
+				} else {
+					memset(tx_buf, 0, BLK_STEREO_SIZE_OCTETS);
+				}
+#else
 				memset(tx_buf, 0, BLK_STEREO_SIZE_OCTETS);
+#endif /* CONFIG_AUDIO_DATAPATH_JITTER_BUF */
 			}
 
 			if (tone_active) {
@@ -882,6 +1074,16 @@ void audio_datapath_pres_delay_us_get(uint32_t *delay_us)
 	*delay_us = ctrl_blk.pres_comp.pres_delay_us;
 }
 
+void audio_datapath_plc_cb_register(audio_datapath_plc_cb_t plc_cb)
+{
+#if CONFIG_AUDIO_DATAPATH_JITTER_BUF
+	ctrl_blk.jitter_buf.plc_cb = plc_cb;
+#else
+	ARG_UNUSED(plc_cb);
+	LOG_WRN("Jitter buffer not enabled - PLC callback not used");
+#endif /* CONFIG_AUDIO_DATAPATH_JITTER_BUF */
+}
+
 void audio_datapath_stream_out(const uint8_t *buf, size_t size, uint32_t sdu_ref_us, bool bad_frame,
 			       uint32_t recv_frame_ts_us)
 {
@@ -930,6 +1132,15 @@ void audio_datapath_stream_out(const uint8_t *buf, size_t size, uint32_t sdu_ref
 
 	ctrl_blk.prev_pres_sdu_ref_us = sdu_ref_us;
 
+#if CONFIG_AUDIO_DATAPATH_JITTER_BUF
+	/*** Jitter estimation ***/
+	jitter_buf_jitter_update(recv_frame_ts_us, sdu_ref_us, sdu_ref_not_consecutive);
+
+	if (bad_frame) {
+		ctrl_blk.jitter_buf.total_bad_frames++;
+	}
+#endif /* CONFIG_AUDIO_DATAPATH_JITTER_BUF */
+
 	/*** Presentation compensation ***/
 	if (ctrl_blk.pres_comp.enabled) {
 		audio_datapath_presentation_compensation(recv_frame_ts_us, sdu_ref_us,
@@ -961,9 +1172,13 @@ void audio_datapath_stream_out(const uint8_t *buf, size_t size, uint32_t sdu_ref
 
 	/*** Add audio data to FIFO buffer ***/
 
-	int32_t num_blks_in_fifo = ctrl_blk.out.prod_blk_idx - ctrl_blk.out.cons_blk_idx;
+#if CONFIG_AUDIO_DATAPATH_JITTER_BUF
+	jitter_buf_depth_adjust(recv_frame_ts_us);
+#endif /* CONFIG_AUDIO_DATAPATH_JITTER_BUF */
+
+	uint32_t num_blks_in_fifo = out_fifo_num_blks_get();
 
-	if ((num_blks_in_fifo + NUM_BLKS_IN_FRAME) > FIFO_NUM_BLKS) {
+	if ((num_blks_in_fifo + NUM_BLKS_IN_FRAME) >= FIFO_NUM_BLKS) {
 		LOG_WRN("Output audio stream overrun - Discarding audio frame");
 
 		/* Discard frame to allow consumer to catch up */
@@ -1007,6 +1222,14 @@ int audio_datapath_start(struct data_fifo *fifo_rx)
 		/* Clear counters and mute initial audio */
 		memset(&ctrl_blk.out, 0, sizeof(ctrl_blk.out));
 
+#if CONFIG_AUDIO_DATAPATH_JITTER_BUF
+		audio_datapath_plc_cb_t plc_cb = ctrl_blk.jitter_buf.plc_cb;
+
+		memset(&ctrl_blk.jitter_buf, 0, sizeof(ctrl_blk.jitter_buf));
+		ctrl_blk.jitter_buf.plc_cb = plc_cb;
+		ctrl_blk.jitter_buf.target_blks = CONFIG_AUDIO_DATAPATH_JITTER_BUF_MIN_BLKS;
+#endif /* CONFIG_AUDIO_DATAPATH_JITTER_BUF */
+
 		audio_datapath_i2s_start();
 		ctrl_blk.stream_started = true;
 
@@ -1181,6 +1404,33 @@ static int cmd_audio_pres_comp_disable(const struct shell *shell, size_t argc, c
 	return 0;
 }
 
+static int cmd_audio_jitter_buf_stats(const struct shell *shell, size_t argc, const char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+#if CONFIG_AUDIO_DATAPATH_JITTER_BUF
+	shell_print(shell, "Depth: %d blocks, target: %d blocks, jitter: %d us",
+		    out_fifo_num_blks_get(), ctrl_blk.jitter_buf.target_blks,
+		    ctrl_blk.jitter_buf.jitter_us_q4 >> JITTER_BUF_JITTER_GAIN_SHIFT);
+	shell_print(shell, "Under-runs: %d blocks, concealed: %d blocks, bad frames: %d",
+		    ctrl_blk.out.total_blk_underruns, ctrl_blk.jitter_buf.total_blks_concealed,
+		    ctrl_blk.jitter_buf.total_bad_frames);
+	shell_print(shell, "Depth adjustments: %d blocks inserted, %d blocks dropped",
+		    ctrl_blk.jitter_buf.total_blks_inserted, ctrl_blk.jitter_buf.total_blks_dropped);
+
+	if (ctrl_blk.pres_comp.enabled) {
+		shell_print(shell, "Depth is set by presentation compensation");
+	}
+#else
+	shell_print(shell, "Depth: %d blocks, under-runs: %d blocks", out_fifo_num_blks_get(),
+		    ctrl_blk.out.total_blk_underruns);
+	shell_print(shell, "Enable CONFIG_AUDIO_DATAPATH_JITTER_BUF for jitter buffer statistics");
+#endif /* CONFIG_AUDIO_DATAPATH_JITTER_BUF */
+
+	return 0;
+}
+
 SHELL_STATIC_SUBCMD_SET_CREATE(test_cmd,
 			       SHELL_COND_CMD(CONFIG_SHELL, nrf_tone_start, NULL,
 					      "Start local tone from nRF5340", cmd_i2s_tone_play),
@@ -1198,6 +1448,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(test_cmd,
 			       SHELL_COND_CMD(CONFIG_SHELL, pll_pres_comp_disable, NULL,
 					      "Disable audio presentation compensation",
 					      cmd_audio_pres_comp_disable),
+			       SHELL_COND_CMD(CONFIG_SHELL, jitter_buf_stats, NULL,
+					      "Print output audio jitter buffer statistics",
+					      cmd_audio_jitter_buf_stats),
 			       SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_REGISTER(test, &test_cmd, "Test mode commands", NULL);
@@ -14,6 +14,19 @@
 
 #include "sw_codec_select.h"
 
+/**
+ * @brief Callback for concealing a missing output audio block
+ *
+ * @note Called from the I2S interrupt context, so it must return quickly
+ *
+ * @param blk Block to fill with concealment audio
+ * @param prev_blk The block last passed to I2S
+ * @param size Size of both blocks in bytes
+ * @param num_concealed Number of consecutive blocks concealed before this one
+ */
+typedef void (*audio_datapath_plc_cb_t)(void *blk, void const *prev_blk, size_t size,
+					uint32_t num_concealed);
+
 /**
  * @brief Mixes a tone into the I2S TX stream
  *
@@ -46,6 +59,15 @@ int audio_datapath_pres_delay_us_set(uint32_t delay_us);
  */
 void audio_datapath_pres_delay_us_get(uint32_t *delay_us);
 
+/**
+ * @brief Register a packet loss concealment callback for the output audio stream
+ *
+ * @note Only used if CONFIG_AUDIO_DATAPATH_JITTER_BUF is enabled
+ *
+ * @param plc_cb Callback to use, or NULL to restore the default fade-out
+ */
+void audio_datapath_plc_cb_register(audio_datapath_plc_cb_t plc_cb);
+
 /**
  * @brief Input an audio data frame which is processed and outputted over I2S
  *
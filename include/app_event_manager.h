@@ -55,6 +55,11 @@ enum app_event_type_flags {
 	 */
 	APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE =
 		APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START,
+	/** processes events of the type on the high priority event queue.
+	 *  Flag set by user. Ignored unless
+	 *  @kconfig{CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_QUEUE} is enabled.
+	 */
+	APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY,
 	/** shows number of predefined flags.*/
 	APP_EVENT_TYPE_FLAGS_COUNT,
 	/** marks beginning of user-specific flags.*/
@@ -83,6 +88,16 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
  */
 #define APP_EVENT_ID(ename) _EVENT_ID(ename)
 
+/**
+ * @brief Get the listener ID
+ *
+ * Macro that creates listener pointer from the listener name.
+ *
+ * @param lname The name of the listener
+ * @return Listener pointer to struct event_listener type
+ */
+#define APP_EVENT_LISTENER_ID(lname) _EVENT_LISTENER_ID(lname)
+
 /** @brief Create an event listener object.
  *
  * @param lname   Module name.
@@ -178,6 +193,66 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 	_APP_EVENT_TYPE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags)
 
 
+/** @brief Define a memory pool for an event type.
+ *
+ * Events of the given type are allocated from a statically allocated pool of
+ * @p block_cnt blocks instead of app_event_manager_alloc. If the pool is
+ * exhausted, the allocation falls back to app_event_manager_alloc.
+ *
+ * The macro must be used in the same source file as @ref APP_EVENT_TYPE_DEFINE.
+ *
+ * @note
+ * For this macro to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_EVENT_POOLS} option needs to be enabled.
+ *
+ * @param ename      Name of the event.
+ * @param block_cnt  Number of events that can be allocated from the pool.
+ */
+#define APP_EVENT_POOL_DEFINE(ename, block_cnt) \
+	_APP_EVENT_POOL_DEFINE(ename, sizeof(struct ename), block_cnt)
+
+
+/** @brief Define a memory pool for an event type with dynamic data size.
+ *
+ * Works like @ref APP_EVENT_POOL_DEFINE, but every pool block can
+ * additionally hold up to @p dyndata_size bytes of dynamic data. Events with
+ * larger dynamic data are allocated using app_event_manager_alloc.
+ *
+ * @param ename         Name of the event.
+ * @param block_cnt     Number of events that can be allocated from the pool.
+ * @param dyndata_size  Maximum size of the dynamic data (in bytes).
+ */
+#define APP_EVENT_POOL_DYNDATA_DEFINE(ename, block_cnt, dyndata_size) \
+	_APP_EVENT_POOL_DEFINE(ename, sizeof(struct ename) + (dyndata_size), block_cnt)
+
+
+/** @brief Define a coalescing policy for an event type.
+ *
+ * At most one event of the given type is pending in the event queue. An event
+ * submitted while another event of the type is pending is merged into the
+ * pending event and freed. The pending event keeps its position in the event
+ * queue.
+ *
+ * If @p merge_fn is NULL, the data of the submitted event overwrites the data
+ * of the pending event, so the latest value wins. Otherwise, @p merge_fn is
+ * called to update the pending event. The function is called under the event
+ * queue lock, possibly from an interrupt, so it must be short and must not
+ * block. Submit hooks are not called for the merged events.
+ *
+ * The macro must be used in the same source file as @ref APP_EVENT_TYPE_DEFINE.
+ * Events with dynamic data cannot be coalesced.
+ *
+ * @note
+ * For this macro to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING} option needs to be enabled.
+ *
+ * @param ename     Name of the event.
+ * @param merge_fn  Function merging the events of type @ref app_event_merge_fn, or NULL.
+ */
+#define APP_EVENT_COALESCE_DEFINE(ename, merge_fn) \
+	_APP_EVENT_COALESCE_DEFINE(ename, merge_fn)
+
+
 /** @brief Verify if an event ID is valid.
  *
  * The pointer to an event type structure is used as its ID. This macro
@@ -403,6 +478,85 @@ void *app_event_manager_alloc(size_t size);
 void app_event_manager_free(void *addr);
 
 
+/** @brief Release an event that was not submitted.
+ *
+ * Returns the event to the memory pool of its event type, or frees it using
+ * app_event_manager_free if it was not allocated from a pool.
+ *
+ * @param aeh  Pointer to the application event header of the event.
+ **/
+void app_event_manager_event_release(struct app_event_header *aeh);
+
+
+/** @brief Get statistics of the memory pool of an event type.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_EVENT_POOLS} option needs to be enabled.
+ *
+ * @param type_id  Pointer to the event type object.
+ * @param stats    Pointer to the structure to be filled with the statistics.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -ENOENT If no pool is defined for the event type.
+ */
+int app_event_manager_pool_stats_get(const struct event_type *type_id,
+				     struct app_event_pool_stats *stats);
+
+
+/** @brief Get statistics of the coalescing of an event type.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING} option needs to be enabled.
+ *
+ * @param type_id  Pointer to the event type object.
+ * @param stats    Pointer to the structure to be filled with the statistics.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -ENOENT If no coalescing policy is defined for the event type.
+ */
+int app_event_manager_coalesce_stats_get(const struct event_type *type_id,
+					 struct app_event_coalesce_stats *stats);
+
+
+/** @brief Get execution time statistics of an event listener.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_LISTENER_STATS} option needs to be enabled.
+ *
+ * @param el     Pointer to the listener object, see @ref APP_EVENT_LISTENER_ID.
+ * @param stats  Pointer to the structure to be filled with the statistics.
+ */
+void app_event_manager_listener_stats_get(const struct event_listener *el,
+					  struct app_event_listener_stats *stats);
+
+
+/** @brief Reset execution time statistics of all event listeners.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_LISTENER_STATS} option needs to be enabled.
+ */
+void app_event_manager_listener_stats_reset(void);
+
+
+/** @brief Use the listener loop of the previous dispatch implementation.
+ *
+ * The previous loop checked the event display bitmask for every notified
+ * listener and the consumed flag in its condition. It is only kept to
+ * measure the dispatch cost against it in benchmarks.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_DISPATCH_BASELINE} option needs to be enabled.
+ *
+ * @param enable  True to use the previous loop, false to use the current one.
+ */
+void app_event_manager_dispatch_baseline_set(bool enable);
+
+
 /** @brief Log event.
  *
  * This helper macro simplifies event logging.
@@ -262,6 +262,58 @@ struct audio_module_parameters {
 	struct audio_module_thread_configuration thread;
 };
 
+/**
+ * @brief Reference counted audio data block, shared by all the destinations of a module.
+ */
+struct audio_module_block {
+	/* Audio data of the block. */
+	struct audio_data audio_data;
+
+	/* Number of destinations that have not yet released the block. */
+	atomic_t ref_count;
+};
+
+/**
+ * @brief Profiling statistics of a module.
+ *
+ * @note The latency is measured from when an audio data item is queued on the module's
+ *       RX FIFO until the module releases it, and is given in cycles.
+ */
+struct audio_module_stats {
+	/* Number of audio data items processed by the module. */
+	uint32_t blocks_processed;
+
+	/* Number of audio data items dropped by or on the way into the module. */
+	uint32_t blocks_dropped;
+
+	/* Total number of cycles spent in the module's data_process function. */
+	uint64_t process_cycles_total;
+
+	/* Maximum number of cycles spent in a single call to data_process. */
+	uint32_t process_cycles_max;
+
+	/* Number of latency samples. */
+	uint32_t latency_cnt;
+
+	/* Total latency of all the samples, in cycles. */
+	uint64_t latency_cycles_total;
+
+	/* Minimum latency, in cycles. */
+	uint32_t latency_cycles_min;
+
+	/* Maximum latency, in cycles. */
+	uint32_t latency_cycles_max;
+
+	/* Maximum number of messages queued on the RX FIFO. */
+	uint32_t rx_fifo_high_water;
+
+	/* Maximum number of messages queued on the TX FIFO. */
+	uint32_t tx_fifo_high_water;
+
+	/* Maximum number of data slab blocks in use. */
+	uint32_t data_slab_high_water;
+};
+
 /**
  * @brief Private module handle.
  */
@@ -293,8 +345,11 @@ struct audio_module_handle {
 	/* Number of destination modules. */
 	uint8_t dest_count;
 
-	/* Semaphore to count messages between modules and on a module's TX FIFO. */
-	struct k_sem sem;
+	/* Pool of blocks for the audio data sent to the destination modules and the TX FIFO. */
+	struct audio_module_block blocks[CONFIG_AUDIO_MODULE_BLOCKS_NUM];
+
+	/* Bitmap of the blocks in use. */
+	ATOMIC_DEFINE(blocks_used, CONFIG_AUDIO_MODULE_BLOCKS_NUM);
 
 	/* Mutex to make the above destinations list thread safe. */
 	struct k_mutex dest_mutex;
@@ -304,20 +359,41 @@ struct audio_module_handle {
 
 	/* Private context for the module. */
 	struct audio_module_context *context;
+
+#if CONFIG_AUDIO_MODULE_STATS
+	/* List node in the list of open modules. */
+	sys_snode_t stats_node;
+
+	/* Profiling statistics of the module. */
+	struct audio_module_stats stats;
+
+	/* Lock to make the above statistics thread safe. */
+	struct k_spinlock stats_lock;
+#endif /* CONFIG_AUDIO_MODULE_STATS */
 };
 
 /**
  * @brief Private structure describing a data_in message into the module thread.
  */
 struct audio_module_message {
-	/* Audio data to input. */
+	/* Audio data to input, valid if block is NULL. */
 	struct audio_data audio_data;
 
+	/* Shared block holding the audio data to input, or NULL if the audio data was copied
+	 * into the message.
+	 */
+	struct audio_module_block *block;
+
 	/* Sending module's handle. */
 	struct audio_module_handle *tx_handle;
 
 	/* Callback for when the audio data has been consumed. */
 	audio_module_response_cb response_cb;
+
+#if CONFIG_AUDIO_MODULE_STATS
+	/* Cycle count when the message was queued. */
+	uint32_t tx_cycles;
+#endif /* CONFIG_AUDIO_MODULE_STATS */
 };
 
 /**
@@ -505,6 +581,29 @@ int audio_module_names_get(struct audio_module_handle const *const handle, char
 int audio_module_state_get(struct audio_module_handle const *const handle,
 			   enum audio_module_state *state);
 
+/**
+ * @brief Get the profiling statistics of an audio module.
+ *
+ * @note Requires CONFIG_AUDIO_MODULE_STATS.
+ *
+ * @param handle  [in]   The handle to the module instance.
+ * @param stats   [out]  Pointer to the module's statistics.
+ *
+ * @return 0 if successful, -ENOTSUP if the statistics are disabled, error otherwise.
+ */
+int audio_module_stats_get(struct audio_module_handle *handle, struct audio_module_stats *stats);
+
+/**
+ * @brief Reset the profiling statistics of an audio module.
+ *
+ * @note Requires CONFIG_AUDIO_MODULE_STATS.
+ *
+ * @param handle  [in/out]  The handle to the module instance.
+ *
+ * @return 0 if successful, -ENOTSUP if the statistics are disabled, error otherwise.
+ */
+int audio_module_stats_reset(struct audio_module_handle *handle);
+
 /**
  * @brief Helper to calculate the number of channels from the channel map for the given
  *        audio data.
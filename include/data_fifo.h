@@ -31,6 +31,27 @@ struct data_fifo_msgq {
 	size_t size;
 };
 
+#if CONFIG_DATA_FIFO_SPSC
+/* State of a data_fifo in single-producer single-consumer mode.
+ * The counters are free running and only written by one side each.
+ */
+struct data_fifo_spsc {
+	/* Number of blocks given out by data_fifo_pointer_first_vacant_get. Producer only. */
+	uint32_t alloced;
+	/* Number of blocks locked by data_fifo_block_lock. Written by the producer. */
+	atomic_t locked;
+	/* Number of blocks given out by data_fifo_pointer_last_filled_get. Consumer only. */
+	uint32_t read;
+	/* Number of blocks freed by data_fifo_block_free. Written by the consumer. */
+	atomic_t freed;
+	/* Set while a thread waits for a filled or vacant block. */
+	atomic_t filled_waiting;
+	atomic_t vacant_waiting;
+	struct k_sem filled_sem;
+	struct k_sem vacant_sem;
+};
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 struct data_fifo {
 	char *msgq_buffer;
 	char *slab_buffer;
@@ -39,6 +60,10 @@ struct data_fifo {
 	uint32_t elements_max;
 	size_t block_size_max;
 	bool initialized;
+#if CONFIG_DATA_FIFO_SPSC
+	bool spsc_mode;
+	struct data_fifo_spsc spsc;
+#endif /* CONFIG_DATA_FIFO_SPSC */
 };
 
 #define DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in)                                 \
@@ -52,6 +77,39 @@ struct data_fifo {
 				 .elements_max = elements_max_in,                                  \
 				 .initialized = false}
 
+/**
+ * @brief Define a data_fifo in single-producer single-consumer mode.
+ *
+ * The FIFO is a ring of blocks with atomic indices, so no kernel objects are used
+ * when blocks are passed between the producer and the consumer. The API is the same as for
+ * a FIFO defined with DATA_FIFO_DEFINE, with the following restrictions:
+ * - Only one context (thread or ISR) may call data_fifo_pointer_first_vacant_get and
+ *   data_fifo_block_lock, and only one context may call data_fifo_pointer_last_filled_get
+ *   and data_fifo_block_free.
+ * - Blocks must be locked in the order they were allocated, and freed in the order they
+ *   were read.
+ * - data_fifo_empty and data_fifo_uninit must not be called while the FIFO is in use.
+ * - elements_max_in must be a power of two, so that the free running indices map to the
+ *   same block when they wrap around.
+ *
+ * Requires CONFIG_DATA_FIFO_SPSC.
+ */
+#define DATA_FIFO_SPSC_DEFINE(name, elements_max_in, block_size_max_in)                            \
+	BUILD_ASSERT(IS_ENABLED(CONFIG_DATA_FIFO_SPSC),                                            \
+		     "CONFIG_DATA_FIFO_SPSC must be enabled for DATA_FIFO_SPSC_DEFINE");           \
+	BUILD_ASSERT(IS_POWER_OF_TWO(elements_max_in),                                             \
+		     "DATA_FIFO_SPSC_DEFINE elements_max_in must be a power of two");              \
+	char __aligned(WB_UP(                                                                      \
+		1)) _msgq_buffer_##name[(elements_max_in) * sizeof(struct data_fifo_msgq)] = {0};  \
+	char __aligned(WB_UP(1)) _slab_buffer_##name[(elements_max_in) * (block_size_max_in)] = {  \
+		0};                                                                                \
+	struct data_fifo name = {.msgq_buffer = _msgq_buffer_##name,                               \
+				 .slab_buffer = _slab_buffer_##name,                               \
+				 .block_size_max = block_size_max_in,                              \
+				 .elements_max = elements_max_in,                                  \
+				 .initialized = false,                                             \
+				 .spsc_mode = true}
+
 /**
  * @brief Get pointer to the first vacant block in slab.
  *
@@ -92,6 +150,8 @@ int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
  * @retval -ESPIPE	A generic return value if an error occurs in k_msg_put.
  *			Since data has already been added to the slab, there
  *			must be space in the message queue.
+ * @retval -EPERM	The FIFO is in single-producer single-consumer mode and
+ *			the block is not the oldest allocated block.
  */
 int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size);
 
@@ -16,6 +16,7 @@
 #define DFU_TARGET_STREAM_H__
 
 #include <stddef.h>
+#include <stdbool.h>
 #include <zephyr/storage/stream_flash.h>
 
 #ifdef __cplusplus
@@ -53,6 +54,12 @@ struct dfu_target_stream_init {
 	 * can be used to inspect the actual written data.
 	 */
 	stream_flash_callback_t cb;
+
+	/* Do not store the write progress to settings, also when
+	 * `CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS` is set. For streams
+	 * whose offset can not be used to resume the download.
+	 */
+	bool no_save_progress;
 };
 
 /**
@@ -36,6 +36,20 @@ enum at_parser_cmd_type {
 	AT_PARSER_CMD_TYPE_TEST
 };
 
+#if defined(CONFIG_AT_PARSER_TOKEN_INDEX)
+/**
+ * @brief Location of a value in the current AT command line.
+ */
+struct at_parser_index_entry {
+	/* Offset of the value from the start of the AT command line. */
+	uint16_t offset;
+	/* Length of the value. */
+	uint16_t len;
+	/* Type of the value. */
+	uint8_t type;
+};
+#endif /* CONFIG_AT_PARSER_TOKEN_INDEX */
+
 /**
  * @brief AT parser
  *
@@ -53,6 +67,12 @@ struct at_parser {
 	bool is_next_empty;
 	/* Sentinel value for determining initialization state. */
 	uint32_t init_sentinel;
+#if defined(CONFIG_AT_PARSER_TOKEN_INDEX)
+	/* Number of values in the index. */
+	size_t index_count;
+	/* Values of the current AT command line, indexed when the line is configured. */
+	struct at_parser_index_entry index[CONFIG_AT_PARSER_TOKEN_INDEX_SIZE];
+#endif
 };
 
 /**
@@ -112,6 +112,16 @@ int nrf_modem_lib_trace_clear(void);
  * @return Rolling average bitrate of the trace backend
  */
 uint32_t nrf_modem_lib_trace_backend_bitrate_get(void);
+
+/** @brief Get the compression ratio of the trace backend.
+ *
+ * This function returns the ratio between the amount of trace data written to the trace backend
+ * and the amount of data stored by it, since the trace backend was initialized.
+ *
+ * @return Compression ratio of the trace backend in percent, or 0 if the trace backend does not
+ *         compress trace data or has not stored any yet.
+ */
+uint32_t nrf_modem_lib_trace_backend_compression_ratio_get(void);
 #endif /* defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE) || defined(__DOXYGEN__) */
 
 /** @} */
@@ -122,6 +122,20 @@ struct nrf_modem_lib_trace_backend {
 	 * @return 0 on success, negative errno on failure.
 	 */
 	int (*resume)(void);
+
+	/**
+	 * @brief Get the amount of trace data written to the trace backend and stored by it.
+	 *
+	 * Trace backends that compress the trace data store fewer bytes than are written to them.
+	 *
+	 * @note Set to @c NULL if this operation is not supported by the trace backend.
+	 *
+	 * @param written Number of bytes of trace data written to the backend.
+	 * @param stored  Number of bytes stored by the backend for the written trace data.
+	 *
+	 * @return 0 on success, negative errno on failure.
+	 */
+	int (*compression_stats_get)(size_t *written, size_t *stored);
 };
 
 /**@} */ /* defgroup trace_backend */
@@ -192,6 +192,18 @@ struct download_client {
 		bool connection_close;
 		/** Is using ranged query. */
 		bool ranged;
+		/** Received data is pending to be parsed. */
+		bool parse_pending;
+		/** Number of ranged requests awaiting a response. */
+		uint8_t in_flight;
+		/** Offset of the next byte to request. */
+		size_t requested;
+		/** Payload bytes left in the current ranged response. */
+		size_t frag_left;
+		/** Bytes received past the end of the current ranged response. */
+		size_t excess;
+		/** CRC32 of the ETag sent by the server, zero if none was sent. */
+		uint32_t etag;
 	} http;
 
 	struct {
@@ -290,6 +302,21 @@ int download_client_start(struct download_client *client, const char *file,
  */
 int download_client_file_size_get(struct download_client *client, size_t *size);
 
+/**
+ * @brief Retrieve the identity of the version of the file being downloaded.
+ *
+ * This is the CRC32 of the HTTP ETag sent by the server. It can be stored to
+ * check that the file on the server is unchanged before resuming a download.
+ * It is only available after the first HTTP response header has been received,
+ * and requires @kconfig{CONFIG_DOWNLOAD_CLIENT_ETAG}.
+ *
+ * @param[in]  client	Client instance.
+ * @param[out] etag	CRC32 of the ETag, zero if the server did not send one.
+ *
+ * @retval int Zero on success, a negative error code otherwise.
+ */
+int download_client_etag_get(struct download_client *client, uint32_t *etag);
+
 /**
  * @brief Retrieve the number of bytes downloaded so far.
  *
@@ -727,6 +727,45 @@ int nrf_cloud_obj_pgps_request_create(struct nrf_cloud_obj *const obj,
 int nrf_cloud_gnss_msg_json_encode(const struct nrf_cloud_gnss_data * const gnss,
 				   cJSON * const gnss_msg_obj);
 
+/**
+ * @brief Write an nRF Cloud sensor device message as JSON text directly into a buffer.
+ *
+ * No cJSON object is built and no memory is allocated. The text is the same as the
+ * message sent by @ref nrf_cloud_sensor_data_send.
+ *
+ * @param[in]  sensor   Sensor data to write. The data must be a null-terminated string.
+ * @param[out] buf      Buffer for the null-terminated text. Can be NULL if buf_size is 0.
+ * @param[in]  buf_size Size of the buffer.
+ * @param[out] len      Length of the text, without the null terminator.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL Invalid parameter.
+ * @retval -ENOBUFS Buffer too small. The required length is still set in len.
+ */
+int nrf_cloud_sensor_data_json_write(const struct nrf_cloud_sensor_data *const sensor,
+				     char *const buf, const size_t buf_size, size_t *const len);
+
+/**
+ * @brief Write an nRF Cloud GNSS device message as JSON text directly into a buffer.
+ *
+ * No cJSON object is built and no memory is allocated. The text is the same as the
+ * message encoded by @ref nrf_cloud_gnss_msg_json_encode.
+ *
+ * @param[in]  gnss     GNSS data to write.
+ * @param[out] buf      Buffer for the null-terminated text. Can be NULL if buf_size is 0.
+ * @param[in]  buf_size Size of the buffer.
+ * @param[out] len      Length of the text, without the null terminator.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL Invalid parameter.
+ * @retval -EFBIG NMEA sentence too long.
+ * @retval -ENOSYS Modem GNSS data type without CONFIG_NRF_MODEM.
+ * @retval -EPROTO Invalid GNSS data type.
+ * @retval -ENOBUFS Buffer too small. The required length is still set in len.
+ */
+int nrf_cloud_gnss_msg_json_write(const struct nrf_cloud_gnss_data *const gnss,
+				  char *const buf, const size_t buf_size, size_t *const len);
+
 /**
  * @brief Add service info into the provided cJSON object.
  *
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_CLOUD_SENSOR_BATCH_H_
+#define NRF_CLOUD_SENSOR_BATCH_H_
+
+/** @file nrf_cloud_sensor_batch.h
+ * @brief Module to send sensor data to nRF Cloud in batches.
+ */
+
+#include <stddef.h>
+#include <net/nrf_cloud.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup nrf_cloud_sensor_batch nRF Cloud sensor data batching
+ * @{
+ */
+
+/**
+ * @brief Add a sensor sample to the batch.
+ *
+ * The batch is sent to the bulk topic using MQTT or CoAP when the sample does not fit in
+ * the buffer, when it holds @kconfig{CONFIG_NRF_CLOUD_SENSOR_BATCH_MAX_SAMPLES} samples,
+ * or when its first sample is @kconfig{CONFIG_NRF_CLOUD_SENSOR_BATCH_MAX_AGE} seconds old.
+ * If the sample has no timestamp, the current time is used when @kconfig{CONFIG_DATE_TIME}
+ * is enabled.
+ *
+ * @param[in] sensor Sensor data. The data must be a null-terminated string.
+ *
+ * @retval 0 Sample added.
+ * @retval -EINVAL Invalid parameter.
+ * @retval -E2BIG Sample larger than the batch buffer.
+ * @return A negative error number if the batch had to be sent to make room and sending
+ *         failed. The sample is not added.
+ */
+int nrf_cloud_sensor_batch_add(const struct nrf_cloud_sensor_data *sensor);
+
+/**
+ * @brief Send the samples in the batch to nRF Cloud now.
+ *
+ * @retval 0 Batch sent, or no samples to send.
+ * @return A negative error number if sending failed. The samples are kept.
+ */
+int nrf_cloud_sensor_batch_flush(void);
+
+/**
+ * @brief Get the number of samples in the batch.
+ *
+ * @return Number of samples waiting to be sent.
+ */
+size_t nrf_cloud_sensor_batch_count_get(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_CLOUD_SENSOR_BATCH_H_ */
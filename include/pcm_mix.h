@@ -29,13 +29,41 @@ enum pcm_mix_mode {
 	B_MONO_INTO_A_STEREO_R,
 };
 
+/** Sample formats supported by the mixer. */
+enum pcm_mix_format {
+	/** Signed 16-bit samples in a 16-bit carrier. */
+	PCM_MIX_FORMAT_S16,
+	/** Signed 24-bit samples, sign extended into a 32-bit carrier. */
+	PCM_MIX_FORMAT_S24_32,
+	/** Signed 32-bit samples in a 32-bit carrier. */
+	PCM_MIX_FORMAT_S32,
+};
+
+/** Number of fractional bits in the gain of a mixer input. */
+#define PCM_MIX_GAIN_FRAC_BITS 12
+
+/** Gain of a mixer input that leaves the input unchanged. */
+#define PCM_MIX_GAIN_UNITY (1U << PCM_MIX_GAIN_FRAC_BITS)
+
+/** Input to the multi-input mixer. */
+struct pcm_mix_input {
+	/** Pointer to the PCM data buffer, NULL if the input is silent. */
+	void const *pcm;
+
+	/** Size of the PCM data buffer (in bytes). */
+	size_t size;
+
+	/** Linear gain in unsigned Q4.12 format, see @ref PCM_MIX_GAIN_UNITY. */
+	uint16_t gain;
+};
+
 /**
  * @brief Mixes two buffers of PCM data.
  *
  * @note Uses simple addition with hard clip protection.
  * Input can be mono or stereo as long as the inputs match.
  * By selecting the mix mode, mono can also be mixed into a stereo buffer.
- * Hard coded for the signed 16-bit PCM.
+ * Hard coded for the signed 16-bit PCM, see @ref pcm_mix_fmt for other formats.
  *
  * @param pcm_a         [in/out] Pointer to the PCM data buffer A.
  * @param size_a        [in]     Size of the PCM data buffer A (in bytes).
@@ -52,6 +80,62 @@ enum pcm_mix_mode {
 int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
 	    enum pcm_mix_mode mix_mode);
 
+/**
+ * @brief Mixes two buffers of PCM data of the given sample format.
+ *
+ * @note Same as @ref pcm_mix, but for any of the formats in pcm_mix_format.
+ * Samples that are clipped are counted, see @ref pcm_mix_clip_count_get.
+ *
+ * @param pcm_a         [in/out] Pointer to the PCM data buffer A.
+ * @param size_a        [in]     Size of the PCM data buffer A (in bytes).
+ * @param pcm_b         [in]     Pointer to the PCM data buffer B.
+ * @param size_b        [in]     Size of the PCM data buffer B (in bytes).
+ * @param mix_mode      [in]     Mixing mode according to pcm_mix_mode.
+ * @param format        [in]     Sample format of both buffers.
+ *
+ * @retval 0            Success. Result stored in pcm_a.
+ * @retval -EINVAL      pcm_a is NULL, size_a = 0 or the format is invalid.
+ * @retval -EPERM       Either size_b < size_a (for stereo to stereo, mono to mono)
+ *			or size_a/2 < size_b (for mono to stereo mix).
+ * @retval -ESRCH       Invalid mixing mode.
+ */
+int pcm_mix_fmt(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+		enum pcm_mix_mode mix_mode, enum pcm_mix_format format);
+
+/**
+ * @brief Mixes a number of PCM buffers into an output buffer in one pass.
+ *
+ * @note Each input is scaled by its gain before the inputs are summed, and the sum is
+ * clipped to the range of the sample format. All inputs must have the same channel
+ * layout and format as the output. Inputs shorter than the output are treated as
+ * silence for the remaining samples. The previous content of the output is overwritten.
+ *
+ * @param pcm_out       [out] Pointer to the output PCM data buffer.
+ * @param size_out      [in]  Size of the output PCM data buffer (in bytes).
+ * @param inputs        [in]  Array of inputs to mix.
+ * @param num_inputs    [in]  Number of inputs, at most CONFIG_PCM_MIX_INPUTS_MAX.
+ * @param format        [in]  Sample format of all buffers.
+ *
+ * @retval 0            Success. Result stored in pcm_out.
+ * @retval -EINVAL      pcm_out is NULL, size_out = 0, the format is invalid or
+ *			there are too many inputs.
+ * @retval -EPERM       An input is larger than the output.
+ */
+int pcm_mix_n(void *const pcm_out, size_t size_out, struct pcm_mix_input const *const inputs,
+	      size_t num_inputs, enum pcm_mix_format format);
+
+/**
+ * @brief Gets the number of samples that have been clipped by the mixer.
+ *
+ * @return Number of clipped samples since start-up or the last reset.
+ */
+uint32_t pcm_mix_clip_count_get(void);
+
+/**
+ * @brief Resets the clip counter of the mixer.
+ */
+void pcm_mix_clip_count_reset(void);
+
 /**
  * @}
  */
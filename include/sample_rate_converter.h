@@ -40,9 +40,36 @@
 /** Filter types supported by the sample rate converter */
 enum sample_rate_converter_filter {
 	SAMPLE_RATE_FILTER_TEST = 1,
-	SAMPLE_RATE_FILTER_SIMPLE
+	SAMPLE_RATE_FILTER_SIMPLE,
+	/* Fractional conversion using a polyphase filter with interpolation between phases. */
+	SAMPLE_RATE_FILTER_POLYPHASE,
+	/* Fractional conversion using a cubic Lagrange interpolator in Farrow structure. */
+	SAMPLE_RATE_FILTER_FARROW
 };
 
+/** Number of taps in each phase of the polyphase filter. */
+#define SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS 16
+
+/** Number of phases of the polyphase filter. Must be a power of two. */
+#define SAMPLE_RATE_CONVERTER_POLYPHASE_PHASES 32
+
+/** Number of input samples used by the cubic Farrow interpolator. */
+#define SAMPLE_RATE_CONVERTER_FARROW_TAPS 4
+
+/** Largest number of input samples used for each output sample in a fractional conversion. */
+#define SAMPLE_RATE_CONVERTER_FRAC_TAPS_MAX SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS
+
+/**
+ * Largest ratio between the input and output sample rate for a fractional conversion, as
+ * numerator and denominator. The polyphase filter cut-off is designed for this range, which
+ * covers 44.1 kHz <-> 48 kHz.
+ */
+#define SAMPLE_RATE_CONVERTER_FRAC_RATIO_MAX_NUM 9
+#define SAMPLE_RATE_CONVERTER_FRAC_RATIO_MAX_DEN 8
+
+/** Largest drift correction for a fractional conversion in parts per million. */
+#define SAMPLE_RATE_CONVERTER_DRIFT_PPM_MAX 10000
+
 /**
  * To maintain filter requirements the input buffer must in some cases store two samples between
  * each block processed.
@@ -81,6 +108,33 @@ struct buf_ctx {
 	size_t bytes_in_buf;
 };
 
+/** Streaming state for the fractional sample rate conversion */
+struct sample_rate_converter_frac {
+	/* Input samples to advance for each output sample, in Q32.32 format. */
+	uint64_t step;
+
+	/* Position of the next output sample, relative to the start of the history, in Q32.32
+	 * format.
+	 */
+	uint64_t pos;
+
+	/* Drift correction of the step in parts per million. */
+	int32_t drift_ppm;
+
+	/* Number of input samples used for each output sample. */
+	size_t taps;
+
+	/* Phases of the filter, NULL for the Farrow interpolator. */
+	q15_t const *filter;
+
+	/* The last (taps - 1) input samples from the previous process call. */
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	q15_t hist_15[SAMPLE_RATE_CONVERTER_FRAC_TAPS_MAX - 1];
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	q31_t hist_31[SAMPLE_RATE_CONVERTER_FRAC_TAPS_MAX - 1];
+#endif
+};
+
 /** Context for the sample rate conversion */
 struct sample_rate_converter_ctx {
 	/* Input and output sample rate to be used for the conversion. */
@@ -88,7 +142,7 @@ struct sample_rate_converter_ctx {
 	uint32_t sample_rate_output;
 
 	/* The ratio for the current conversion. When the conversion is upsampling the ratio is
-	 * positive and negative when downsampling.
+	 * positive and negative when downsampling. Zero for fractional conversions.
 	 */
 	int conversion_ratio;
 
@@ -121,6 +175,9 @@ struct sample_rate_converter_ctx {
 #elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
 	q31_t state_buf_31[SAMPLE_RATE_CONVERTER_STATE_BUFFER_SIZE];
 #endif
+
+	/* State for the fractional filters, which work directly on the caller buffers. */
+	struct sample_rate_converter_frac frac;
 };
 
 /**
@@ -149,6 +206,13 @@ int sample_rate_converter_open(struct sample_rate_converter_ctx *ctx);
  *		based on the conversion ratio, the module will buffer both input and output bytes
  *		when needed to meet this criteria.
  *
+ *		The fractional filters, SAMPLE_RATE_FILTER_POLYPHASE and
+ *		SAMPLE_RATE_FILTER_FARROW, support any pair of sample rates within the ratio given
+ *		by SAMPLE_RATE_CONVERTER_FRAC_RATIO_MAX_NUM/DEN, including equal rates for drift
+ *		correction only. They read directly from the input and write directly to the
+ *		output, so the input is not limited by CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX.
+ *		The number of output samples varies between calls and is given by output_written.
+ *
  * @param[in,out]	ctx			Pointer to the sample rate conversion context.
  * @param[in]		filter			Filter type to be used for the conversion.
  * @param[in]		input			Pointer to samples to process.
@@ -170,6 +234,23 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 				  size_t output_size, size_t *output_written,
 				  uint32_t output_sample_rate);
 
+/**
+ * @brief	Set the drift correction for fractional conversions.
+ *
+ * @details	Adjusts the conversion ratio of the fractional filters by the given amount,
+ *		without resetting the stream. Use this to compensate for the difference between
+ *		the clocks of the audio source and sink. A positive value consumes the input
+ *		faster and produces fewer output samples. The drift correction is kept when the
+ *		sample rates or filter changes, and is cleared by sample_rate_converter_open().
+ *
+ * @param[in,out]	ctx		Pointer to the sample rate conversion context.
+ * @param[in]		drift_ppm	Drift correction in parts per million.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	NULL pointer given for context or drift correction out of range.
+ */
+int sample_rate_converter_drift_set(struct sample_rate_converter_ctx *ctx, int32_t drift_ppm);
+
 /**
  * @}
  */
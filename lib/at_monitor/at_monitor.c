@@ -3,6 +3,7 @@
  *
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
+#include <ctype.h>
 #include <stddef.h>
 #include <string.h>
 #include <zephyr/kernel.h>
@@ -17,7 +18,8 @@ LOG_MODULE_REGISTER(at_monitor, CONFIG_AT_MONITOR_LOG_LEVEL);
 
 struct at_notif_fifo {
 	void *fifo_reserved;
-	char data[]; /* Null-terminated AT notification string */
+	char *data; /* Null-terminated AT notification string */
+	uint32_t matched[]; /* Bitmap of the monitors to dispatch to, by section index */
 };
 
 static void at_monitor_task(struct k_work *work);
@@ -26,6 +28,9 @@ static K_FIFO_DEFINE(at_monitor_fifo);
 static K_HEAP_DEFINE(at_monitor_heap, CONFIG_AT_MONITOR_HEAP_SIZE);
 static K_WORK_DEFINE(at_monitor_work, at_monitor_task);
 
+/* Signatures of the filters of the first monitors, by section index */
+static uint64_t filter_signature[CONFIG_AT_MONITOR_SIGNATURE_COUNT];
+
 static bool is_paused(const struct at_monitor_entry *mon)
 {
 	return mon->flags.paused;
@@ -36,9 +41,81 @@ static bool is_direct(const struct at_monitor_entry *mon)
 	return mon->flags.direct;
 }
 
-static bool has_match(const struct at_monitor_entry *mon, const char *notif)
+/* Only pairs of letters and AT command prefixes go into a signature. Long notifications are
+ * mostly made of numbers, quotes and commas, which would otherwise set most of the bits.
+ */
+static bool is_signature_char(char c)
+{
+	return isalpha((unsigned char)c) || c == '+' || c == '%' || c == '#';
+}
+
+static uint64_t signature_pair(char c0, char c1)
+{
+	uint32_t pair = ((uint32_t)(uint8_t)c0 << 8) | (uint8_t)c1;
+
+	/* Fibonacci hashing, the top 6 bits of the product index the 64 signature bits */
+	return BIT64((pair * 0x9E3779B1U) >> 26);
+}
+
+/* A signature has one bit set for each pair of adjacent letters in a string.
+ * A filter can only be found in a notification if all of its pairs are in the notification too,
+ * so most filters are rejected without searching the notification.
+ */
+static uint64_t signature_get(const char *str, size_t *len)
+{
+	uint64_t signature = 0;
+	size_t i;
+
+	if (str[0] == '\0') {
+		*len = 0;
+		return 0;
+	}
+
+	for (i = 1; str[i] != '\0'; i++) {
+		if (is_signature_char(str[i - 1]) && is_signature_char(str[i])) {
+			signature |= signature_pair(str[i - 1], str[i]);
+		}
+	}
+
+	*len = i;
+
+	return signature;
+}
+
+static bool has_match(const struct at_monitor_entry *mon, size_t idx, const char *notif,
+		      uint64_t signature)
 {
-	return (mon->filter == ANY || strstr(notif, mon->filter));
+	if (mon->filter == ANY) {
+		return true;
+	}
+
+	/* Filters without a signature are always searched */
+	if (idx < ARRAY_SIZE(filter_signature) && (filter_signature[idx] & ~signature)) {
+		return false;
+	}
+
+	return strstr(notif, mon->filter) != NULL;
+}
+
+static struct at_notif_fifo *at_notif_alloc(const char *notif, size_t len, size_t words)
+{
+	struct at_notif_fifo *at_notif;
+	size_t sz_needed;
+
+	sz_needed = sizeof(struct at_notif_fifo) + words * sizeof(uint32_t) + len + sizeof(char);
+
+	at_notif = k_heap_alloc(&at_monitor_heap, sz_needed, K_NO_WAIT);
+	if (!at_notif) {
+		LOG_WRN("No heap space for incoming notification: %s", notif);
+		__ASSERT(at_notif, "No heap space for incoming notification: %s", notif);
+		return NULL;
+	}
+
+	memset(at_notif->matched, 0, words * sizeof(uint32_t));
+	at_notif->data = (char *)&at_notif->matched[words];
+	memcpy(at_notif->data, notif, len + sizeof(char));
+
+	return at_notif;
 }
 
 /* Dispatch AT notifications immediately, or schedules a workqueue task to do that.
@@ -47,41 +124,48 @@ static bool has_match(const struct at_monitor_entry *mon, const char *notif)
  */
 void at_monitor_dispatch(const char *notif)
 {
-	bool monitored;
 	struct at_notif_fifo *at_notif;
-	size_t sz_needed;
+	bool alloc_failed;
+	uint64_t signature;
+	size_t count;
+	size_t words;
+	size_t len;
+	size_t idx;
 
 	__ASSERT_NO_MSG(notif != NULL);
 
-	monitored = false;
+	/* Go through the notification once, then match each filter against its signature */
+	signature = signature_get(notif, &len);
+
+	STRUCT_SECTION_COUNT(at_monitor_entry, &count);
+	words = DIV_ROUND_UP(count, 32);
+
+	at_notif = NULL;
+	alloc_failed = false;
+	idx = 0;
 	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-		if (!is_paused(e) && has_match(e, notif)) {
+		if (!is_paused(e) && has_match(e, idx, notif, signature)) {
 			if (is_direct(e)) {
 				LOG_DBG("Dispatching to %p (ISR)", e->handler);
 				e->handler(notif);
-			} else {
-				/* Copy and schedule work-queue task */
-				monitored = true;
+			} else if (!alloc_failed) {
+				/* Only copy monitored notifications to save heap */
+				if (!at_notif) {
+					at_notif = at_notif_alloc(notif, len, words);
+					alloc_failed = !at_notif;
+				}
+				if (at_notif) {
+					at_notif->matched[idx / 32] |= BIT(idx % 32);
+				}
 			}
 		}
+		idx++;
 	}
 
-	if (!monitored) {
-		/* Only copy monitored notifications to save heap */
-		return;
-	}
-
-	sz_needed = sizeof(struct at_notif_fifo) + strlen(notif) + sizeof(char);
-
-	at_notif = k_heap_alloc(&at_monitor_heap, sz_needed, K_NO_WAIT);
 	if (!at_notif) {
-		LOG_WRN("No heap space for incoming notification: %s", notif);
-		__ASSERT(at_notif, "No heap space for incoming notification: %s", notif);
 		return;
 	}
 
-	strcpy(at_notif->data, notif);
-
 	k_fifo_put(&at_monitor_fifo, at_notif);
 	k_work_submit(&at_monitor_work);
 }
@@ -89,14 +173,28 @@ void at_monitor_dispatch(const char *notif)
 static void at_monitor_task(struct k_work *work)
 {
 	struct at_notif_fifo *at_notif;
+	struct at_monitor_entry *e;
+	uint32_t matched;
+	size_t count;
+	size_t idx;
+
+	STRUCT_SECTION_COUNT(at_monitor_entry, &count);
 
 	while ((at_notif = k_fifo_get(&at_monitor_fifo, K_NO_WAIT))) {
-		/* Match notification with all monitors */
+		/* Dispatch to the monitors matched in the ISR, in section order */
 		LOG_DBG("AT notif: %.*s", strlen(at_notif->data) - strlen("\r\n"), at_notif->data);
-		STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-			if (!is_paused(e) && !is_direct(e) && has_match(e, at_notif->data)) {
-				LOG_DBG("Dispatching to %p", e->handler);
-				e->handler(at_notif->data);
+		for (size_t w = 0; w * 32 < count; w++) {
+			matched = at_notif->matched[w];
+			while (matched) {
+				idx = w * 32 + u32_count_trailing_zeros(matched);
+				matched &= matched - 1;
+
+				STRUCT_SECTION_GET(at_monitor_entry, idx, &e);
+				/* The monitor may have been paused since */
+				if (!is_paused(e)) {
+					LOG_DBG("Dispatching to %p", e->handler);
+					e->handler(at_notif->data);
+				}
 			}
 		}
 		k_heap_free(&at_monitor_heap, at_notif);
@@ -105,8 +203,25 @@ static void at_monitor_task(struct k_work *work)
 
 static int at_monitor_sys_init(void)
 {
+	struct at_monitor_entry *e;
+	size_t count;
+	size_t len;
 	int err;
 
+	/* Filters are fixed, so their signatures are computed once */
+	STRUCT_SECTION_COUNT(at_monitor_entry, &count);
+	if (count > ARRAY_SIZE(filter_signature)) {
+		LOG_WRN("%zu AT monitors without a filter signature",
+			count - ARRAY_SIZE(filter_signature));
+	}
+
+	for (size_t i = 0; i < MIN(count, ARRAY_SIZE(filter_signature)); i++) {
+		STRUCT_SECTION_GET(at_monitor_entry, i, &e);
+		if (e->filter != ANY) {
+			filter_signature[i] = signature_get(e->filter, &len);
+		}
+	}
+
 	err = nrf_modem_at_notif_handler_set(at_monitor_dispatch);
 	if (err) {
 		LOG_ERR("Failed to hook the dispatch function, err %d", err);
@@ -236,10 +236,23 @@ static int at_parser_seek(struct at_parser *parser, size_t index, struct at_toke
 {
 	int err;
 
+#if defined(CONFIG_AT_PARSER_TOKEN_INDEX)
+	if (index < parser->index_count) {
+		const struct at_parser_index_entry *entry = &parser->index[index];
+
+		token->start = parser->at + entry->offset;
+		token->len = entry->len;
+		token->type = entry->type;
+
+		return 0;
+	}
+#endif
+
 	if (!is_index_ahead(parser, index)) {
 		/* Rewind parser. */
 		parser->cursor = parser->at;
 		parser->count = 0;
+		parser->is_next_empty = false;
 	}
 
 	do {
@@ -249,6 +262,44 @@ static int at_parser_seek(struct at_parser *parser, size_t index, struct at_toke
 	return err;
 }
 
+#if defined(CONFIG_AT_PARSER_TOKEN_INDEX)
+/* Tokenize the current AT command line in one pass and record where its values are.
+ * The parser is left after the last indexed value, so tokenizing resumes from there for the
+ * values that are not in the index, and errors are returned when the values they prevent from
+ * being parsed are requested, as without the index.
+ */
+static void at_parser_index_build(struct at_parser *parser)
+{
+	struct at_token token;
+	size_t offset;
+
+	parser->index_count = 0;
+
+	while (parser->index_count < ARRAY_SIZE(parser->index)) {
+		if (at_parser_tok(parser, &token)) {
+			break;
+		}
+
+		offset = token.start - parser->at;
+		if (offset > UINT16_MAX || token.len > UINT16_MAX) {
+			/* The value is found by tokenizing the line again. */
+			break;
+		}
+
+		parser->index[parser->index_count++] = (struct at_parser_index_entry){
+			.offset = offset,
+			.len = token.len,
+			.type = token.type,
+		};
+	}
+
+	if (parser->count == 0) {
+		/* Nothing was tokenized, leave the leading CRLF to be trimmed on the next attempt. */
+		parser->cursor = parser->at;
+	}
+}
+#endif /* CONFIG_AT_PARSER_TOKEN_INDEX */
+
 int at_parser_init(struct at_parser *parser, const char *at)
 {
 	if (!parser || !at) {
@@ -261,6 +312,10 @@ int at_parser_init(struct at_parser *parser, const char *at)
 	parser->cursor = at;
 	parser->init_sentinel = INIT_SENTINEL;
 
+#if defined(CONFIG_AT_PARSER_TOKEN_INDEX)
+	at_parser_index_build(parser);
+#endif
+
 	return 0;
 }
 
@@ -291,6 +346,10 @@ int at_parser_cmd_next(struct at_parser *parser)
 	 */
 	parser->at = parser->cursor;
 
+#if defined(CONFIG_AT_PARSER_TOKEN_INDEX)
+	at_parser_index_build(parser);
+#endif
+
 	return 0;
 }
 
@@ -13,6 +13,162 @@ LOG_MODULE_REGISTER(data_fifo, CONFIG_DATA_FIFO_LOG_LEVEL);
 
 static struct k_spinlock lock;
 
+#if CONFIG_DATA_FIFO_SPSC
+/* elements_max is a power of two, so indices stay consecutive when the counters wrap */
+static uint32_t spsc_index(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return idx & (data_fifo->elements_max - 1);
+}
+
+static void *spsc_block_ptr(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return &data_fifo->slab_buffer[spsc_index(data_fifo, idx) * data_fifo->block_size_max];
+}
+
+static struct data_fifo_msgq *spsc_slot(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return &((struct data_fifo_msgq *)data_fifo->msgq_buffer)[spsc_index(data_fifo, idx)];
+}
+
+static bool spsc_vacant_available(struct data_fifo *data_fifo)
+{
+	return (data_fifo->spsc.alloced - (uint32_t)atomic_get(&data_fifo->spsc.freed)) <
+	       data_fifo->elements_max;
+}
+
+static bool spsc_filled_available(struct data_fifo *data_fifo)
+{
+	return data_fifo->spsc.read != (uint32_t)atomic_get(&data_fifo->spsc.locked);
+}
+
+static void spsc_wake(atomic_t *waiting, struct k_sem *sem)
+{
+	/* Only pay for the semaphore when the other side is waiting */
+	if (atomic_cas(waiting, 1, 0)) {
+		k_sem_give(sem);
+	}
+}
+
+/** @brief Wait until a block is available in single-producer single-consumer mode.
+ *
+ * The waiting flag is set before the condition is checked again, so the other side
+ * either sees the flag and gives the semaphore, or the block is already available.
+ */
+static int spsc_wait(struct data_fifo *data_fifo, bool (*available)(struct data_fifo *),
+		     atomic_t *waiting, struct k_sem *sem, k_timeout_t timeout, int no_wait_err)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+
+	while (!available(data_fifo)) {
+		int ret;
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return no_wait_err;
+		}
+
+		atomic_set(waiting, 1);
+
+		if (available(data_fifo)) {
+			atomic_clear(waiting);
+			break;
+		}
+
+		ret = k_sem_take(sem, sys_timepoint_timeout(end));
+		if (ret) {
+			atomic_clear(waiting);
+			return available(data_fifo) ? 0 : ret;
+		}
+	}
+
+	return 0;
+}
+
+static int spsc_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
+					 k_timeout_t timeout)
+{
+	int ret;
+
+	ret = spsc_wait(data_fifo, spsc_vacant_available, &data_fifo->spsc.vacant_waiting,
+			&data_fifo->spsc.vacant_sem, timeout, -ENOMEM);
+	if (ret) {
+		return ret;
+	}
+
+	*data = spsc_block_ptr(data_fifo, data_fifo->spsc.alloced);
+	data_fifo->spsc.alloced++;
+
+	return 0;
+}
+
+static int spsc_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
+{
+	uint32_t idx = (uint32_t)atomic_get(&data_fifo->spsc.locked);
+	struct data_fifo_msgq *slot = spsc_slot(data_fifo, idx);
+
+	if (idx == data_fifo->spsc.alloced || *data != spsc_block_ptr(data_fifo, idx)) {
+		LOG_ERR("Block %p is not the oldest allocated block", *data);
+		return -EPERM;
+	}
+
+	slot->block_ptr = *data;
+	slot->size = size;
+
+	/* Publish the block after the slot has been written */
+	atomic_inc(&data_fifo->spsc.locked);
+
+	spsc_wake(&data_fifo->spsc.filled_waiting, &data_fifo->spsc.filled_sem);
+
+	return 0;
+}
+
+static int spsc_pointer_last_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
+					k_timeout_t timeout)
+{
+	int ret;
+	struct data_fifo_msgq *slot;
+
+	ret = spsc_wait(data_fifo, spsc_filled_available, &data_fifo->spsc.filled_waiting,
+			&data_fifo->spsc.filled_sem, timeout, -ENOMSG);
+	if (ret) {
+		return ret;
+	}
+
+	slot = spsc_slot(data_fifo, data_fifo->spsc.read);
+	*data = slot->block_ptr;
+	*size = slot->size;
+	data_fifo->spsc.read++;
+
+	return 0;
+}
+
+static void spsc_block_free(struct data_fifo *data_fifo, void *data)
+{
+	uint32_t idx = (uint32_t)atomic_get(&data_fifo->spsc.freed);
+
+	if (idx == data_fifo->spsc.read || data != spsc_block_ptr(data_fifo, idx)) {
+		LOG_ERR("Block %p is not the oldest read block", data);
+		__ASSERT_NO_MSG(false);
+		return;
+	}
+
+	atomic_inc(&data_fifo->spsc.freed);
+
+	spsc_wake(&data_fifo->spsc.vacant_waiting, &data_fifo->spsc.vacant_sem);
+}
+
+static void spsc_reset(struct data_fifo *data_fifo)
+{
+	data_fifo->spsc.alloced = 0;
+	data_fifo->spsc.read = 0;
+	atomic_clear(&data_fifo->spsc.locked);
+	atomic_clear(&data_fifo->spsc.freed);
+	atomic_clear(&data_fifo->spsc.filled_waiting);
+	atomic_clear(&data_fifo->spsc.vacant_waiting);
+	k_sem_init(&data_fifo->spsc.filled_sem, 0, 1);
+	k_sem_init(&data_fifo->spsc.vacant_sem, 0, 1);
+}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 /** @brief Checks that the elements in the msgq and slab are legal.
  * I.e. the number of msgq elements cannot be more than mem blocks used.
  */
@@ -48,6 +204,12 @@ int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc_mode) {
+		return spsc_pointer_first_vacant_get(data_fifo, data, timeout);
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	ret = k_mem_slab_alloc(&data_fifo->mem_slab, data, timeout);
 	return ret;
 }
@@ -66,6 +228,12 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
 		return -EINVAL;
 	}
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc_mode) {
+		return spsc_block_lock(data_fifo, data, size);
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	struct data_fifo_msgq msgq_tmp;
 
 	msgq_tmp.block_ptr = *data;
@@ -93,6 +261,12 @@ int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
 
 	struct data_fifo_msgq msgq_tmp;
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc_mode) {
+		return spsc_pointer_last_filled_get(data_fifo, data, size, timeout);
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	ret = k_msgq_get(&data_fifo->msgq, &msgq_tmp, timeout);
 	if (ret) {
 		return ret;
@@ -108,6 +282,13 @@ void data_fifo_block_free(struct data_fifo *data_fifo, void *data)
 	__ASSERT_NO_MSG(data_fifo != NULL);
 	__ASSERT_NO_MSG(data_fifo->initialized);
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc_mode) {
+		spsc_block_free(data_fifo, data);
+		return;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	k_mem_slab_free(&data_fifo->mem_slab, data);
 }
 
@@ -120,6 +301,15 @@ int data_fifo_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num, u
 	uint32_t msgq_num_used = UINT32_MAX;
 	uint32_t slab_blocks_num_used = UINT32_MAX;
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc_mode) {
+		/* The counters are updated from two contexts, so this is only a snapshot */
+		*locked_num = (uint32_t)atomic_get(&data_fifo->spsc.locked) - data_fifo->spsc.read;
+		*alloced_num = data_fifo->spsc.alloced - (uint32_t)atomic_get(&data_fifo->spsc.freed);
+		return 0;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	ret = msgq_slab_legal_used_elements(data_fifo, &msgq_num_used, &slab_blocks_num_used);
 	if (ret) {
 		return ret;
@@ -138,6 +328,13 @@ int data_fifo_empty(struct data_fifo *data_fifo)
 	void *old_data;
 	size_t size;
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc_mode) {
+		spsc_reset(data_fifo);
+		return 0;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	ret = data_fifo_num_used_get(data_fifo, &fifo_alloced_num, &fifo_locked_num);
 	if (ret) {
 		LOG_ERR("Failed to get num used in FIFO");
@@ -192,6 +389,19 @@ int data_fifo_init(struct data_fifo *data_fifo)
 	__ASSERT_NO_MSG((data_fifo->block_size_max % WB_UP(1)) == 0);
 	int ret;
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc_mode) {
+		if (!IS_POWER_OF_TWO(data_fifo->elements_max)) {
+			LOG_ERR("SPSC FIFO size %u is not a power of two", data_fifo->elements_max);
+			return -EINVAL;
+		}
+
+		spsc_reset(data_fifo);
+		data_fifo->initialized = true;
+		return 0;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	k_msgq_init(&data_fifo->msgq, data_fifo->msgq_buffer, sizeof(struct data_fifo_msgq),
 		    data_fifo->elements_max);
 
@@ -119,6 +119,19 @@ uint32_t nrf_modem_lib_trace_backend_bitrate_get(void)
 	return backend_bps_avg;
 }
 
+uint32_t nrf_modem_lib_trace_backend_compression_ratio_get(void)
+{
+	size_t written;
+	size_t stored;
+
+	if (!trace_backend.compression_stats_get ||
+	    trace_backend.compression_stats_get(&written, &stored) || !stored) {
+		return 0;
+	}
+
+	return (uint64_t)written * 100 / stored;
+}
+
 static void trace_backend_bitrate_perf_start(void)
 {
 	backend_measurement_start = k_uptime_ticks();
@@ -158,7 +171,14 @@ K_WORK_DELAYABLE_DEFINE(backend_bps_log_work, backend_bps_log);
 
 static void backend_bps_log(struct k_work *item)
 {
-	LOG_INF("Trace backend bitrate (bps): %u", backend_bps_avg);
+	uint32_t ratio = nrf_modem_lib_trace_backend_compression_ratio_get();
+
+	if (ratio) {
+		LOG_INF("Trace backend bitrate (bps): %u, compression ratio: %u.%02u",
+			backend_bps_avg, ratio / 100, ratio % 100);
+	} else {
+		LOG_INF("Trace backend bitrate (bps): %u", backend_bps_avg);
+	}
 
 	k_work_schedule(&backend_bps_log_work, BACKEND_BPS_LOG_PERIOD);
 }
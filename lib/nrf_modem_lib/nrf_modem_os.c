@@ -17,6 +17,8 @@
 
 #define UNUSED_FLAGS 0
 #define THREAD_MONITOR_ENTRIES 10
+#define SLEEPING_THREAD_BUCKETS_LOG2 4
+#define SLEEPING_THREAD_BUCKETS BIT(SLEEPING_THREAD_BUCKETS_LOG2)
 
 LOG_MODULE_REGISTER(nrf_modem, CONFIG_NRF_MODEM_LIB_LOG_LEVEL);
 
@@ -42,8 +44,12 @@ static struct thread_monitor_entry {
 	int cnt; /* Last RPC event count. */
 } thread_event_monitor[THREAD_MONITOR_ENTRIES];
 
-/* A list of threads that are sleeping and should be woken up on next event. */
-static sys_slist_t sleeping_threads;
+/* Lists of threads that are sleeping and should be woken up on next event for their context,
+ * hashed by context so that an event only goes through the threads that may be sleeping on it.
+ * Threads sleeping on context 0 are woken up on any event and have their own list.
+ */
+static sys_slist_t sleeping_threads[SLEEPING_THREAD_BUCKETS];
+static sys_slist_t sleeping_threads_any;
 
 /* RPC event counter, incremented on each RPC event. */
 static atomic_t rpc_event_cnt;
@@ -53,11 +59,17 @@ static atomic_t rpc_event_cnt;
  */
 static struct thread_monitor_entry *thread_monitor_entry_get(k_tid_t id)
 {
-	struct thread_monitor_entry *entry = thread_event_monitor;
-	struct thread_monitor_entry *new_entry = thread_event_monitor;
+	struct thread_monitor_entry *entry;
+	struct thread_monitor_entry *new_entry = NULL;
 	int entry_age, oldest_entry_age = 0;
+	/* Start looking at a position given by the thread ID, entries are never cleared so
+	 * the entry of a thread is found before the first uninitialized entry.
+	 */
+	size_t start = ((uintptr_t)id >> 3) % THREAD_MONITOR_ENTRIES;
+
+	for (size_t i = 0; i < THREAD_MONITOR_ENTRIES; i++) {
+		entry = &thread_event_monitor[(start + i) % THREAD_MONITOR_ENTRIES];
 
-	for ( ; PART_OF_ARRAY(thread_event_monitor, entry); entry++) {
 		if (entry->id == id) {
 			return entry;
 		} else if (entry->id == 0) {
@@ -68,7 +80,7 @@ static struct thread_monitor_entry *thread_monitor_entry_get(k_tid_t id)
 
 		/* Identify oldest entry. */
 		entry_age = rpc_event_cnt - entry->cnt;
-		if (entry_age > oldest_entry_age) {
+		if (!new_entry || entry_age > oldest_entry_age) {
 			oldest_entry_age = entry_age;
 			new_entry = entry;
 		}
@@ -102,6 +114,28 @@ static bool can_thread_sleep(struct thread_monitor_entry *entry)
 	return allow_to_sleep;
 }
 
+/* Get the list of threads sleeping on a context. */
+static sys_slist_t *sleeping_thread_list_get(uint32_t context)
+{
+	if (context == 0) {
+		return &sleeping_threads_any;
+	}
+
+	return &sleeping_threads[(context * 2654435761U) >> (32 - SLEEPING_THREAD_BUCKETS_LOG2)];
+}
+
+/* Wake up the threads in a list sleeping on a context, or all of them if the context is 0. */
+static void sleeping_thread_list_wake(sys_slist_t *list, uint32_t context)
+{
+	struct sleeping_thread *thread;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(list, thread, node) {
+		if ((context == 0) || (thread->context == context)) {
+			k_sem_give(&thread->sem);
+		}
+	}
+}
+
 /* Initialize sleeping thread structure. */
 static void sleeping_thread_init(struct sleeping_thread *thread, uint32_t context)
 {
@@ -123,7 +157,7 @@ static bool sleeping_thread_add(struct sleeping_thread *thread)
 
 	if (can_thread_sleep(entry)) {
 		allow_to_sleep = true;
-		sys_slist_append(&sleeping_threads, &thread->node);
+		sys_slist_append(sleeping_thread_list_get(thread->context), &thread->node);
 	}
 
 	irq_unlock(key);
@@ -138,7 +172,7 @@ static void sleeping_thread_remove(struct sleeping_thread *thread)
 
 	uint32_t key = irq_lock();
 
-	sys_slist_find_and_remove(&sleeping_threads, &thread->node);
+	sys_slist_find_and_remove(sleeping_thread_list_get(thread->context), &thread->node);
 
 	entry = thread_monitor_entry_get(k_current_get());
 	thread_monitor_entry_update(entry);
@@ -343,16 +377,18 @@ void nrf_modem_os_event_notify(uint32_t context)
 {
 	atomic_inc(&rpc_event_cnt);
 
-	struct sleeping_thread *thread;
-
-	SYS_SLIST_FOR_EACH_CONTAINER(&sleeping_threads, thread, node) {
-		/* Wake sleeping thread if context of the thread matches, is 0 or the notify
-		 * context is 0.
-		 */
-		if ((thread->context == context) || (context == 0) || (thread->context == 0)) {
-			k_sem_give(&thread->sem);
+	/* Wake sleeping thread if context of the thread matches, is 0 or the notify
+	 * context is 0.
+	 */
+	if (context == 0) {
+		for (size_t i = 0; i < ARRAY_SIZE(sleeping_threads); i++) {
+			sleeping_thread_list_wake(&sleeping_threads[i], 0);
 		}
+	} else {
+		sleeping_thread_list_wake(sleeping_thread_list_get(context), context);
 	}
+
+	sleeping_thread_list_wake(&sleeping_threads_any, 0);
 }
 
 void *nrf_modem_os_alloc(size_t bytes)
@@ -474,7 +510,10 @@ static int on_init(void)
 	 * initialization. This is because we want to keep the list intact regardless of modem
 	 * reinitialization to wake sleeping threads on modem initialization.
 	 */
-	sys_slist_init(&sleeping_threads);
+	for (size_t i = 0; i < ARRAY_SIZE(sleeping_threads); i++) {
+		sys_slist_init(&sleeping_threads[i]);
+	}
+	sys_slist_init(&sleeping_threads_any);
 	atomic_clear(&rpc_event_cnt);
 
 	return 0;
@@ -493,12 +532,11 @@ void nrf_modem_os_init(void)
 
 void nrf_modem_os_shutdown(void)
 {
-	struct sleeping_thread *thread;
-
 	/* Wake up all sleeping threads. */
-	SYS_SLIST_FOR_EACH_CONTAINER(&sleeping_threads, thread, node) {
-		k_sem_give(&thread->sem);
+	for (size_t i = 0; i < ARRAY_SIZE(sleeping_threads); i++) {
+		sleeping_thread_list_wake(&sleeping_threads[i], 0);
 	}
+	sleeping_thread_list_wake(&sleeping_threads_any, 0);
 }
 
 SYS_INIT(on_init, POST_KERNEL, 0);
@@ -16,6 +16,10 @@
 
 #include <modem/trace_backend.h>
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+#include "trace_lz.h"
+#endif
+
 LOG_MODULE_REGISTER(modem_trace_backend, CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
 
 #define EXT_FLASH_DEVICE DEVICE_DT_GET(DT_ALIAS(ext_flash))
@@ -26,6 +30,31 @@ LOG_MODULE_REGISTER(modem_trace_backend, CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
 
 #define TRACE_MAGIC_INITIALIZED 0x152ac523
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+BUILD_ASSERT(BUF_SIZE <= TRACE_LZ_BLOCK_MAX, "Flash buffer is too large to be compressed");
+
+/* Block is compressed, otherwise it is stored as is. */
+#define BLOCK_FLAG_COMPRESSED BIT(0)
+
+/* Header of each block of traces in flash. */
+struct block_header {
+	/* Length of the trace data in the block. */
+	uint16_t len;
+	uint16_t flags;
+};
+
+/* Blocks being written to and read from flash, header included. */
+static uint8_t block_write_buf[sizeof(struct block_header) + BUF_SIZE];
+static uint8_t block_read_buf[sizeof(struct block_header) + BUF_SIZE];
+/* Decompressed block being read, and the length of its trace data. */
+static uint8_t read_buf[BUF_SIZE];
+static size_t read_buf_len;
+
+/* Trace data written to the backend and stored in flash, for the compression ratio. */
+static size_t stats_written;
+static size_t stats_stored;
+#endif /* CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS */
+
 static trace_backend_processed_cb trace_processed_callback;
 
 static const struct flash_area *modem_trace_area;
@@ -64,20 +93,116 @@ static size_t buffer_append(const void *data, size_t len)
 	return append_len;
 }
 
+/* Get the length of the trace data in an FCB entry. */
+static size_t entry_trace_len(struct fcb_entry *entry)
+{
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+	int err;
+	struct block_header header;
+
+	err = flash_area_read(trace_fcb.fap, FCB_ENTRY_FA_DATA_OFF(*entry), &header,
+			      sizeof(header));
+	if (err) {
+		LOG_ERR("flash_area_read failed, err %d", err);
+		return 0;
+	}
+
+	return header.len;
+#else
+	return entry->fe_data_len;
+#endif
+}
+
 static int fcb_walk_callback(struct fcb_entry_ctx *loc_ctx, void *arg)
 {
 	if ((loc_ctx->loc.fe_sector == sector) && (loc_ctx->loc.fe_elem_off < loc.fe_elem_off)) {
 		return 0;
 	}
 
-	trace_bytes_unread -= loc_ctx->loc.fe_data_len;
+	trace_bytes_unread -= entry_trace_len(&loc_ctx->loc);
 	return 0;
 }
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+/* Compress the flash buffer into a block, or copy it if it does not compress. */
+static size_t block_build(void)
+{
+	struct block_header header = {
+		.len = flash_buf_written,
+	};
+	size_t len;
+
+	len = trace_lz_compress(flash_buf, flash_buf_written, &block_write_buf[sizeof(header)],
+				flash_buf_written - 1);
+	if (len) {
+		header.flags = BLOCK_FLAG_COMPRESSED;
+	} else {
+		memcpy(&block_write_buf[sizeof(header)], flash_buf, flash_buf_written);
+		len = flash_buf_written;
+	}
+
+	memcpy(block_write_buf, &header, sizeof(header));
+
+	stats_written += flash_buf_written;
+	stats_stored += sizeof(header) + len;
+
+	return sizeof(header) + len;
+}
+
+/* Read the block at the read location and decompress its trace data into the read buffer. */
+static int block_load(void)
+{
+	int err;
+	struct block_header header;
+	const uint8_t *data = &block_read_buf[sizeof(header)];
+	size_t len;
+
+	if (loc.fe_data_len < sizeof(header) || loc.fe_data_len > sizeof(block_read_buf)) {
+		LOG_ERR("Invalid trace block length %d", loc.fe_data_len);
+		return -EBADMSG;
+	}
+
+	len = loc.fe_data_len - sizeof(header);
+
+	err = flash_area_read(trace_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc), block_read_buf,
+			      loc.fe_data_len);
+	if (err) {
+		LOG_ERR("Flash_area_read failed, err %d", err);
+		return err;
+	}
+
+	memcpy(&header, block_read_buf, sizeof(header));
+
+	if (header.flags & BLOCK_FLAG_COMPRESSED) {
+		err = trace_lz_decompress(data, len, read_buf, sizeof(read_buf));
+		if (err < 0) {
+			LOG_ERR("Failed to decompress trace block, err %d", err);
+			return -EBADMSG;
+		}
+
+		len = err;
+	} else {
+		len = MIN(len, sizeof(read_buf));
+		memcpy(read_buf, data, len);
+	}
+
+	if (len != header.len) {
+		LOG_ERR("Trace block has %zu bytes, expected %d", len, header.len);
+		return -EBADMSG;
+	}
+
+	read_buf_len = len;
+
+	return 0;
+}
+#endif /* CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS */
+
 static int buffer_flush_to_flash(void)
 {
 	int err;
 	struct fcb_entry loc_flush;
+	const uint8_t *block;
+	size_t block_len;
 
 	if (!is_initialized) {
 		return -EPERM;
@@ -87,7 +212,15 @@ static int buffer_flush_to_flash(void)
 		return -ENODATA;
 	}
 
-	err = fcb_append(&trace_fcb, flash_buf_written, &loc_flush);
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+	block = block_write_buf;
+	block_len = block_build();
+#else
+	block = flash_buf;
+	block_len = flash_buf_written;
+#endif
+
+	err = fcb_append(&trace_fcb, block_len, &loc_flush);
 	if (err) {
 		if (IS_ENABLED(CONFIG_NRF_MODEM_TRACE_FLASH_NOSPACE_ERASE_OLDEST)) {
 			/* Find the number of trace bytes in oldest sector (that is not read). */
@@ -110,7 +243,7 @@ static int buffer_flush_to_flash(void)
 				LOG_ERR("fcb_rotate failed, err %d", err);
 				return err;
 			}
-			err = fcb_append(&trace_fcb, flash_buf_written, &loc_flush);
+			err = fcb_append(&trace_fcb, block_len, &loc_flush);
 		}
 
 		if (err) {
@@ -120,7 +253,7 @@ static int buffer_flush_to_flash(void)
 	}
 
 	err = flash_area_write(
-		trace_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc_flush), flash_buf, flash_buf_written);
+		trace_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc_flush), block, block_len);
 	if (err) {
 		LOG_ERR("flash_area_write failed, err %d", err);
 		return err;
@@ -218,7 +351,7 @@ int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 	/* Get trace size */
 	err = fcb_getnext(&trace_fcb, &loc);
 	while (!err) {
-		trace_bytes_unread += loc.fe_data_len;
+		trace_bytes_unread += entry_trace_len(&loc);
 		err = fcb_getnext(&trace_fcb, &loc);
 	}
 
@@ -241,20 +374,39 @@ static int read_from_offset(void *buf, size_t len)
 {
 	int err;
 	size_t to_read;
+	size_t entry_len;
 
-	to_read = MIN(len, loc.fe_data_len - read_offset);
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+	/* The read buffer is lost on reboot, while the read location is kept. */
+	if (!read_buf_len) {
+		err = block_load();
+		if (err) {
+			return err;
+		}
+	}
+
+	entry_len = read_buf_len;
+	to_read = MIN(len, entry_len - read_offset);
+	memcpy(buf, &read_buf[read_offset], to_read);
+#else
+	entry_len = loc.fe_data_len;
+	to_read = MIN(len, entry_len - read_offset);
 	err = flash_area_read(
 		trace_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc) + read_offset, buf, to_read);
 	if (err) {
 		LOG_ERR("Flash_area_read failed, err %d", err);
 		return err;
 	}
+#endif
 
 	trace_bytes_unread -= to_read;
 
 	read_offset += to_read;
-	if (read_offset >= loc.fe_data_len) {
+	if (read_offset >= entry_len) {
 		read_offset = 0;
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+		read_buf_len = 0;
+#endif
 	}
 
 	/* Erase if done with previous sector. */
@@ -385,6 +537,9 @@ int trace_backend_clear(void)
 	trace_bytes_unread = 0;
 	read_offset = 0;
 	sector = NULL;
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+	read_buf_len = 0;
+#endif
 
 	return err;
 }
@@ -395,6 +550,16 @@ int trace_backend_deinit(void)
 	return 0;
 }
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+int trace_backend_compression_stats_get(size_t *written, size_t *stored)
+{
+	*written = stats_written;
+	*stored = stats_stored;
+
+	return 0;
+}
+#endif
+
 struct nrf_modem_lib_trace_backend trace_backend = {
 	.init = trace_backend_init,
 	.deinit = trace_backend_deinit,
@@ -402,4 +567,7 @@ struct nrf_modem_lib_trace_backend trace_backend = {
 	.data_size = trace_backend_data_size,
 	.read = trace_backend_read,
 	.clear = trace_backend_clear,
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+	.compression_stats_get = trace_backend_compression_stats_get,
+#endif
 };
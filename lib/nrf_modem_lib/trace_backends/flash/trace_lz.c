@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+#include "trace_lz.h"
+
+/* The compressed data is a sequence of literal runs and back references, each introduced by
+ * a control byte:
+ *  - 000LLLLL: L + 1 literal bytes follow.
+ *  - LLLOOOOO OOOOOOOO: copy L + 2 bytes starting O + 1 bytes back, L is 1 to 6.
+ *  - 111OOOOO LLLLLLLL OOOOOOOO: copy L + 9 bytes starting O + 1 bytes back.
+ */
+#define LITERAL_MAX 32
+#define MATCH_MIN   3
+#define MATCH_MAX   (7 + UINT8_MAX + 2)
+#define OFFSET_MAX  (1 << 13)
+
+#define HASH_LOG  10
+#define HASH_SIZE (1 << HASH_LOG)
+
+/* Positions in the block being compressed, indexed by the hash of the three bytes there.
+ * Entries left from previous blocks are harmless, as every candidate match is verified.
+ */
+static uint16_t hash_table[HASH_SIZE];
+
+static uint32_t hash(const uint8_t *p)
+{
+	return (((uint32_t)p[0] << 16 | (uint32_t)p[1] << 8 | p[2]) * 2654435761U) >>
+	       (32 - HASH_LOG);
+}
+
+static bool literals_put(const uint8_t *lit, size_t len, uint8_t *out, size_t out_len,
+			 size_t *op)
+{
+	size_t run;
+
+	while (len) {
+		run = MIN(len, LITERAL_MAX);
+
+		if (*op + 1 + run > out_len) {
+			return false;
+		}
+
+		out[(*op)++] = run - 1;
+		memcpy(&out[*op], lit, run);
+		*op += run;
+		lit += run;
+		len -= run;
+	}
+
+	return true;
+}
+
+size_t trace_lz_compress(const uint8_t *in, size_t in_len, uint8_t *out, size_t out_len)
+{
+	size_t ip = 0;
+	size_t op = 0;
+	size_t lit = 0;
+	size_t ref;
+	size_t len;
+	size_t max;
+	size_t off;
+	uint32_t h;
+
+	if (in_len > TRACE_LZ_BLOCK_MAX) {
+		return 0;
+	}
+
+	while (ip + MATCH_MIN <= in_len) {
+		h = hash(&in[ip]);
+		ref = hash_table[h];
+		hash_table[h] = ip;
+
+		if (ref >= ip || ip - ref > OFFSET_MAX || memcmp(&in[ref], &in[ip], MATCH_MIN)) {
+			ip++;
+			continue;
+		}
+
+		max = MIN(in_len - ip, MATCH_MAX);
+		for (len = MATCH_MIN; len < max && in[ref + len] == in[ip + len]; len++) {
+		}
+
+		if (!literals_put(&in[lit], ip - lit, out, out_len, &op)) {
+			return 0;
+		}
+
+		off = ip - ref - 1;
+
+		if (len - 2 < 7) {
+			if (op + 2 > out_len) {
+				return 0;
+			}
+
+			out[op++] = ((len - 2) << 5) | (off >> 8);
+		} else {
+			if (op + 3 > out_len) {
+				return 0;
+			}
+
+			out[op++] = (7 << 5) | (off >> 8);
+			out[op++] = len - 2 - 7;
+		}
+
+		out[op++] = off & 0xff;
+
+		ip += len;
+		lit = ip;
+	}
+
+	if (!literals_put(&in[lit], in_len - lit, out, out_len, &op)) {
+		return 0;
+	}
+
+	return op;
+}
+
+int trace_lz_decompress(const uint8_t *in, size_t in_len, uint8_t *out, size_t out_len)
+{
+	size_t ip = 0;
+	size_t op = 0;
+	size_t len;
+	size_t off;
+	uint8_t ctrl;
+
+	while (ip < in_len) {
+		ctrl = in[ip++];
+
+		if (ctrl < LITERAL_MAX) {
+			len = ctrl + 1;
+
+			if (ip + len > in_len) {
+				return -EINVAL;
+			}
+
+			if (op + len > out_len) {
+				return -ENOMEM;
+			}
+
+			memcpy(&out[op], &in[ip], len);
+			ip += len;
+			op += len;
+			continue;
+		}
+
+		len = ctrl >> 5;
+		if (len == 7) {
+			if (ip >= in_len) {
+				return -EINVAL;
+			}
+
+			len += in[ip++];
+		}
+
+		len += 2;
+
+		if (ip >= in_len) {
+			return -EINVAL;
+		}
+
+		off = (((size_t)ctrl & 0x1f) << 8 | in[ip++]) + 1;
+
+		if (off > op) {
+			return -EINVAL;
+		}
+
+		if (op + len > out_len) {
+			return -ENOMEM;
+		}
+
+		/* Byte by byte, as the reference can overlap the output. */
+		for (size_t i = 0; i < len; i++, op++) {
+			out[op] = out[op - off];
+		}
+	}
+
+	return op;
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef TRACE_LZ_H__
+#define TRACE_LZ_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Largest block that can be compressed. */
+#define TRACE_LZ_BLOCK_MAX UINT16_MAX
+
+/**
+ * @brief Compress a block of trace data.
+ *
+ * The block is compressed with a byte-oriented LZ77 codec that needs no state between blocks,
+ * so that each block can be decompressed on its own.
+ *
+ * @param in      Data to compress.
+ * @param in_len  Length of the data, at most @ref TRACE_LZ_BLOCK_MAX.
+ * @param out     Output buffer.
+ * @param out_len Size of the output buffer.
+ *
+ * @return Length of the compressed data, or 0 if it does not fit in @p out_len bytes.
+ */
+size_t trace_lz_compress(const uint8_t *in, size_t in_len, uint8_t *out, size_t out_len);
+
+/**
+ * @brief Decompress a block of trace data.
+ *
+ * @param in      Compressed data.
+ * @param in_len  Length of the compressed data.
+ * @param out     Output buffer.
+ * @param out_len Size of the output buffer.
+ *
+ * @return Length of the decompressed data if the operation was successful.
+ *         Otherwise, a (negative) error code is returned.
+ * @retval -EINVAL The compressed data is malformed.
+ * @retval -ENOMEM The decompressed data does not fit in @p out_len bytes.
+ */
+int trace_lz_decompress(const uint8_t *in, size_t in_len, uint8_t *out, size_t out_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_LZ_H__ */
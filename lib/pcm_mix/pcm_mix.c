@@ -6,99 +6,227 @@
 
 #include <pcm_mix.h>
 
+#include <string.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#if defined(CONFIG_PCM_MIX_ARM_DSP)
+#include <cmsis_core.h>
+#endif
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pcm_mix, CONFIG_PCM_MIX_LOG_LEVEL);
 
-/* Clip signal if amplitude is outside legal range */
-static void hard_limiter(int32_t *const pcm)
+#define S24_MAX ((1 << 23) - 1)
+
+/* Number of samples that have been clipped since the last reset */
+static atomic_t clip_cnt;
+
+static size_t sample_bytes(enum pcm_mix_format format)
 {
-	if (*pcm < INT16_MIN) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MIN;
-	} else if (*pcm > INT16_MAX) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MAX;
-	}
+	return (format == PCM_MIX_FORMAT_S16) ? sizeof(int16_t) : sizeof(int32_t);
 }
 
-/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
-static void pcm_mix_identical(void *const pcm_a, size_t size_a, void const *const pcm_b,
-			      size_t size_b)
+/* Clip signal if amplitude is outside legal range of the format */
+static inline int32_t sat_format(int64_t pcm, enum pcm_mix_format format, uint32_t *clips)
 {
-	int32_t res;
+	int64_t max;
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i];
+	switch (format) {
+	case PCM_MIX_FORMAT_S16:
+		max = INT16_MAX;
+		break;
+	case PCM_MIX_FORMAT_S24_32:
+		max = S24_MAX;
+		break;
+	default:
+		max = INT32_MAX;
+		break;
+	}
+
+	if (pcm > max) {
+		(*clips)++;
+		return (int32_t)max;
+	} else if (pcm < -max - 1) {
+		(*clips)++;
+		return (int32_t)(-max - 1);
+	}
+
+	return (int32_t)pcm;
+}
 
-		hard_limiter(&res);
+static inline int16_t sat_add_s16(int16_t a, int16_t b, uint32_t *clips)
+{
+#if defined(CONFIG_PCM_MIX_ARM_DSP)
+	int32_t res = __SSAT((int32_t)a + b, 16);
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
+	if (res != (int32_t)a + b) {
+		(*clips)++;
 	}
+
+	return (int16_t)res;
+#else
+	return (int16_t)sat_format((int32_t)a + b, PCM_MIX_FORMAT_S16, clips);
+#endif
 }
 
-/* Mix mono into both channels of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_lr(void *const pcm_a, size_t size_a,
-					    void const *const pcm_b, size_t size_b)
+static inline int32_t sat_add_s32(int32_t a, int32_t b, enum pcm_mix_format format,
+				  uint32_t *clips)
 {
+#if defined(CONFIG_PCM_MIX_ARM_DSP)
 	int32_t res;
 
-	/* Use size_b as this is the length of the mono sample.
-	 * This must be *2 to traverse the stereo sample and /2 since
-	 * the sample is two bytes in size.
-	 */
-	for (uint32_t i = 0; i < size_b; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i / 2];
+	if (format == PCM_MIX_FORMAT_S24_32) {
+		/* Two 24-bit values can not overflow the 32-bit carrier */
+		res = __SSAT(a + b, 24);
+		if (res != a + b) {
+			(*clips)++;
+		}
+	} else {
+		res = __QADD(a, b);
+		if (res != (int64_t)a + b) {
+			(*clips)++;
+		}
+	}
 
-		hard_limiter(&res);
+	return res;
+#else
+	return sat_format((int64_t)a + b, format, clips);
+#endif
+}
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
+/* Saturating add of two pairs of signed 16-bit samples packed into 32-bit words */
+static inline uint32_t sat_add_s16x2(uint32_t a, uint32_t b, uint32_t *clips)
+{
+#if defined(CONFIG_PCM_MIX_ARM_DSP)
+	uint32_t res = __QADD16(a, b);
+	uint32_t diff = res ^ __SADD16(a, b);
+
+	if (diff) {
+		*clips += ((diff & 0xFFFF) != 0) + ((diff >> 16) != 0);
 	}
+
+	return res;
+#else
+	/* Add each lane without letting the carry propagate into the next lane */
+	uint32_t sum = ((a & 0x7FFF7FFF) + (b & 0x7FFF7FFF)) ^ ((a ^ b) & 0x80008000);
+	/* A lane overflowed if both operands have the same sign and the result does not */
+	uint32_t ovf = ~(a ^ b) & (a ^ sum) & 0x80008000;
+
+	if (ovf) {
+		/* 0x7FFF for a positive lane, 0x8000 for a negative lane */
+		uint32_t sat = 0x7FFF7FFF + ((a & 0x80008000) >> 15);
+		uint32_t mask = (ovf >> 15) * 0xFFFF;
+
+		*clips += ((ovf & 0x8000) != 0) + ((ovf >> 31) != 0);
+		sum = (sum & ~mask) | (sat & mask);
+	}
+
+	return sum;
+#endif
 }
 
-/* Mix mono into left channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_l(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+static inline uint32_t load_s16x2(void const *const p)
 {
-	int32_t res;
+	uint32_t val;
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2] + ((int16_t *)pcm_b)[i];
+	memcpy(&val, p, sizeof(val));
 
-		hard_limiter(&res);
+	return val;
+}
+
+static inline void store_s16x2(void *const p, uint32_t val)
+{
+	memcpy(p, &val, sizeof(val));
+}
 
-		((int16_t *)pcm_a)[i * 2] = (int16_t)res;
+/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
+static void pcm_mix_identical_s16(int16_t *pcm_a, int16_t const *pcm_b, size_t samples,
+				  uint32_t *clips)
+{
+	size_t i;
+
+	for (i = 0; i + 1 < samples; i += 2) {
+		store_s16x2(&pcm_a[i],
+			    sat_add_s16x2(load_s16x2(&pcm_a[i]), load_s16x2(&pcm_b[i]), clips));
+	}
+
+	if (i < samples) {
+		pcm_a[i] = sat_add_s16(pcm_a[i], pcm_b[i], clips);
 	}
 }
 
-/* Mix mono into right channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_r(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+/* Mix mono into both channels of a stereo buffer */
+static void pcm_mix_b_mono_into_a_stereo_lr_s16(int16_t *pcm_a, int16_t const *pcm_b,
+						size_t samples, uint32_t *clips)
 {
-	int32_t res;
+	for (size_t i = 0; i < samples; i++) {
+		/* Duplicate the mono sample into both lanes */
+		uint32_t b = (uint16_t)pcm_b[i] * 0x00010001U;
+
+		store_s16x2(&pcm_a[i * 2], sat_add_s16x2(load_s16x2(&pcm_a[i * 2]), b, clips));
+	}
+}
+
+/* Mix mono into one channel of a stereo buffer */
+static void pcm_mix_b_mono_into_a_stereo_ch_s16(int16_t *pcm_a, int16_t const *pcm_b,
+						size_t samples, uint32_t *clips)
+{
+	for (size_t i = 0; i < samples; i++) {
+		pcm_a[i * 2] = sat_add_s16(pcm_a[i * 2], pcm_b[i], clips);
+	}
+}
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2 + 1] + ((int16_t *)pcm_b)[i];
+static void pcm_mix_identical_s32(int32_t *pcm_a, int32_t const *pcm_b, size_t samples,
+				  enum pcm_mix_format format, uint32_t *clips)
+{
+	for (size_t i = 0; i < samples; i++) {
+		pcm_a[i] = sat_add_s32(pcm_a[i], pcm_b[i], format, clips);
+	}
+}
 
-		hard_limiter(&res);
+static void pcm_mix_b_mono_into_a_stereo_lr_s32(int32_t *pcm_a, int32_t const *pcm_b,
+						size_t samples, enum pcm_mix_format format,
+						uint32_t *clips)
+{
+	for (size_t i = 0; i < samples; i++) {
+		pcm_a[i * 2] = sat_add_s32(pcm_a[i * 2], pcm_b[i], format, clips);
+		pcm_a[i * 2 + 1] = sat_add_s32(pcm_a[i * 2 + 1], pcm_b[i], format, clips);
+	}
+}
 
-		((int16_t *)pcm_a)[i * 2 + 1] = (int16_t)res;
+static void pcm_mix_b_mono_into_a_stereo_ch_s32(int32_t *pcm_a, int32_t const *pcm_b,
+						size_t samples, enum pcm_mix_format format,
+						uint32_t *clips)
+{
+	for (size_t i = 0; i < samples; i++) {
+		pcm_a[i * 2] = sat_add_s32(pcm_a[i * 2], pcm_b[i], format, clips);
 	}
 }
 
-int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
-	    enum pcm_mix_mode mix_mode)
+int pcm_mix_fmt(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+		enum pcm_mix_mode mix_mode, enum pcm_mix_format format)
 {
+	size_t samples;
+	uint32_t clips = 0;
+	bool wide;
+
 	if (pcm_a == NULL || size_a == 0) {
 		return -EINVAL;
 	}
 
+	if (format > PCM_MIX_FORMAT_S32) {
+		return -EINVAL;
+	}
+
 	if (pcm_b == NULL || size_b == 0) {
 		/* Nothing to mix, returning */
 		return 0;
 	}
 
+	wide = (format != PCM_MIX_FORMAT_S16);
+	samples = size_b / sample_bytes(format);
+
 	switch (mix_mode) {
 	case B_STEREO_INTO_A_STEREO:
 		/* Fall through */
@@ -106,30 +234,134 @@ int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t si
 		if (size_b > size_a) {
 			return -EPERM;
 		}
-		pcm_mix_identical(pcm_a, size_a, pcm_b, size_b);
+
+		if (wide) {
+			pcm_mix_identical_s32(pcm_a, pcm_b, samples, format, &clips);
+		} else {
+			pcm_mix_identical_s16(pcm_a, pcm_b, samples, &clips);
+		}
 		break;
 	case B_MONO_INTO_A_STEREO_LR:
 		if (size_b > (size_a / 2)) {
 			return -EPERM;
 		}
-		pcm_mix_b_mono_into_a_stereo_lr(pcm_a, size_a, pcm_b, size_b);
-		break;
-	case B_MONO_INTO_A_STEREO_L:
-		pcm_mix_b_mono_into_a_stereo_l(pcm_a, size_a, pcm_b, size_b);
-		if (size_b > (size_a / 2)) {
-			LOG_ERR("size a %d size b %d", size_a, size_b);
-			return -EPERM;
+
+		if (wide) {
+			pcm_mix_b_mono_into_a_stereo_lr_s32(pcm_a, pcm_b, samples, format, &clips);
+		} else {
+			pcm_mix_b_mono_into_a_stereo_lr_s16(pcm_a, pcm_b, samples, &clips);
 		}
 		break;
+	case B_MONO_INTO_A_STEREO_L:
+		/* Fall through */
 	case B_MONO_INTO_A_STEREO_R:
-		pcm_mix_b_mono_into_a_stereo_r(pcm_a, size_a, pcm_b, size_b);
 		if (size_b > (size_a / 2)) {
+			LOG_ERR("size a %zu size b %zu", size_a, size_b);
 			return -EPERM;
 		}
+
+		/* The right channel is the second sample of each stereo frame */
+		if (wide) {
+			pcm_mix_b_mono_into_a_stereo_ch_s32(
+				(int32_t *)pcm_a + (mix_mode == B_MONO_INTO_A_STEREO_R), pcm_b,
+				samples, format, &clips);
+		} else {
+			pcm_mix_b_mono_into_a_stereo_ch_s16(
+				(int16_t *)pcm_a + (mix_mode == B_MONO_INTO_A_STEREO_R), pcm_b,
+				samples, &clips);
+		}
 		break;
 	default:
 		return -ESRCH;
 	};
 
+	if (clips) {
+		atomic_add(&clip_cnt, clips);
+	}
+
+	return 0;
+}
+
+int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+	    enum pcm_mix_mode mix_mode)
+{
+	return pcm_mix_fmt(pcm_a, size_a, pcm_b, size_b, mix_mode, PCM_MIX_FORMAT_S16);
+}
+
+static inline int64_t sample_get(void const *const pcm, size_t idx, enum pcm_mix_format format)
+{
+	if (format == PCM_MIX_FORMAT_S16) {
+		return ((int16_t const *)pcm)[idx];
+	}
+
+	return ((int32_t const *)pcm)[idx];
+}
+
+int pcm_mix_n(void *const pcm_out, size_t size_out, struct pcm_mix_input const *const inputs,
+	      size_t num_inputs, enum pcm_mix_format format)
+{
+	size_t samples;
+	size_t in_samples[CONFIG_PCM_MIX_INPUTS_MAX];
+	uint32_t clips = 0;
+
+	if (pcm_out == NULL || size_out == 0 || (inputs == NULL && num_inputs != 0)) {
+		return -EINVAL;
+	}
+
+	if (format > PCM_MIX_FORMAT_S32) {
+		return -EINVAL;
+	}
+
+	if (num_inputs > CONFIG_PCM_MIX_INPUTS_MAX) {
+		LOG_ERR("Too many inputs: %zu, max is %d", num_inputs, CONFIG_PCM_MIX_INPUTS_MAX);
+		return -EINVAL;
+	}
+
+	for (size_t k = 0; k < num_inputs; k++) {
+		if (inputs[k].size > size_out) {
+			return -EPERM;
+		}
+
+		in_samples[k] = (inputs[k].pcm == NULL) ? 0 : inputs[k].size / sample_bytes(format);
+	}
+
+	samples = size_out / sample_bytes(format);
+
+	for (size_t i = 0; i < samples; i++) {
+		/* Keep the gain fraction until all inputs are summed to avoid
+		 * accumulating rounding errors.
+		 */
+		int64_t acc = 0;
+		int32_t res;
+
+		for (size_t k = 0; k < num_inputs; k++) {
+			if (i < in_samples[k]) {
+				acc += sample_get(inputs[k].pcm, i, format) * inputs[k].gain;
+			}
+		}
+
+		res = sat_format(acc >> PCM_MIX_GAIN_FRAC_BITS, format, &clips);
+
+		if (format == PCM_MIX_FORMAT_S16) {
+			((int16_t *)pcm_out)[i] = (int16_t)res;
+		} else {
+			((int32_t *)pcm_out)[i] = res;
+		}
+	}
+
+	if (clips) {
+		atomic_add(&clip_cnt, clips);
+	}
+
 	return 0;
 }
+
+uint32_t pcm_mix_clip_count_get(void)
+{
+	return (uint32_t)atomic_get(&clip_cnt);
+}
+
+void pcm_mix_clip_count_reset(void)
+{
+	atomic_clear(&clip_cnt);
+}
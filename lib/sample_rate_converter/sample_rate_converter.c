@@ -10,6 +10,7 @@
 #include <errno.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(sample_rate_converter, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVEL);
@@ -34,6 +35,29 @@ LOG_MODULE_REGISTER(sample_rate_converter, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVE
 	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * sizeof(uint32_t))
 #endif
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+typedef q15_t frac_sample_t;
+#define FRAC_SAMPLE_MAX INT16_MAX
+#define FRAC_SAMPLE_MIN INT16_MIN
+#define FRAC_HIST(ctx)	((ctx)->frac.hist_15)
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+typedef q31_t frac_sample_t;
+#define FRAC_SAMPLE_MAX INT32_MAX
+#define FRAC_SAMPLE_MIN INT32_MIN
+#define FRAC_HIST(ctx)	((ctx)->frac.hist_31)
+#endif
+
+/* Number of bits of the fractional position used to select the polyphase filter phase */
+#define POLYPHASE_PHASE_BITS 5
+
+BUILD_ASSERT(BIT(POLYPHASE_PHASE_BITS) == SAMPLE_RATE_CONVERTER_POLYPHASE_PHASES,
+	     "Phase bits do not match the number of polyphase filter phases");
+
+static inline bool filter_is_fractional(enum sample_rate_converter_filter filter)
+{
+	return (filter == SAMPLE_RATE_FILTER_POLYPHASE) || (filter == SAMPLE_RATE_FILTER_FARROW);
+}
+
 static int validate_sample_rates(uint32_t sample_rate_input, uint32_t sample_rate_output)
 {
 	if (sample_rate_input > sample_rate_output) {
@@ -75,6 +99,188 @@ static inline int calculate_conversion_ratio(uint32_t sample_rate_input,
 	}
 }
 
+static int validate_sample_rates_frac(uint32_t sample_rate_input, uint32_t sample_rate_output)
+{
+	uint64_t rate_max = MAX(sample_rate_input, sample_rate_output);
+	uint64_t rate_min = MIN(sample_rate_input, sample_rate_output);
+
+	if (rate_min == 0) {
+		LOG_ERR("Sample rate can not be zero");
+		return -EINVAL;
+	}
+
+	if ((rate_max * SAMPLE_RATE_CONVERTER_FRAC_RATIO_MAX_DEN) >
+	    (rate_min * SAMPLE_RATE_CONVERTER_FRAC_RATIO_MAX_NUM)) {
+		LOG_ERR("Ratio between %d and %d is too large for fractional conversion",
+			sample_rate_input, sample_rate_output);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static void frac_step_update(struct sample_rate_converter_ctx *ctx)
+{
+	uint64_t step = ((uint64_t)ctx->sample_rate_input << 32) / ctx->sample_rate_output;
+
+	ctx->frac.step = step + ((int64_t)step * ctx->frac.drift_ppm) / 1000000;
+}
+
+/**
+ * @brief Reconfigures the sample rate converter context for a fractional conversion.
+ *
+ * @details The history is cleared, and the first output sample is positioned so that the
+ *	    filter only uses the history for the samples before the first input sample.
+ *
+ * @param[in,out]	ctx			Pointer to the sample rate conversion context.
+ * @param[in]		sample_rate_input	Sample rate of the input samples.
+ * @param[in]		sample_rate_output	Sample rate of the output samples.
+ * @param[in]		filter			Fractional filter type to use in the conversion.
+ *
+ * @retval 0 On success.
+ * @retval -EINVAL Invalid parameters used to initialize the conversion.
+ */
+static int frac_reconfigure(struct sample_rate_converter_ctx *ctx, uint32_t sample_rate_input,
+			    uint32_t sample_rate_output, enum sample_rate_converter_filter filter)
+{
+	int ret;
+	size_t taps;
+	q15_t const *filter_coeffs;
+
+	ret = validate_sample_rates_frac(sample_rate_input, sample_rate_output);
+	if (ret) {
+		return ret;
+	}
+
+	ret = sample_rate_converter_filter_frac_get(filter, &filter_coeffs, &taps);
+	if (ret) {
+		LOG_ERR("Failed to get filter (%d)", ret);
+		return ret;
+	}
+
+	ctx->sample_rate_input = sample_rate_input;
+	ctx->sample_rate_output = sample_rate_output;
+	ctx->conversion_ratio = 0;
+	ctx->filter_type = filter;
+
+	ctx->frac.taps = taps;
+	ctx->frac.filter = filter_coeffs;
+	ctx->frac.pos = (uint64_t)(taps / 2 - 1) << 32;
+	memset(FRAC_HIST(ctx), 0, sizeof(FRAC_HIST(ctx)));
+	frac_step_update(ctx);
+
+	LOG_DBG("Fractional sample rate converter initialized. Input sample rate: %d, Output "
+		"sample rate: %d, filter type: %d",
+		ctx->sample_rate_input, ctx->sample_rate_output, ctx->filter_type);
+	return 0;
+}
+
+static inline frac_sample_t frac_saturate(int64_t val)
+{
+	return (frac_sample_t)CLAMP(val, FRAC_SAMPLE_MIN, FRAC_SAMPLE_MAX);
+}
+
+static inline int64_t frac_dot(frac_sample_t const *x, q15_t const *coeffs)
+{
+	int64_t acc = 0;
+
+	for (size_t i = 0; i < SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS; i++) {
+		acc += (int64_t)x[i] * coeffs[i];
+	}
+
+	return acc;
+}
+
+/* Polyphase filter with linear interpolation between the two closest phases */
+static inline frac_sample_t frac_polyphase(frac_sample_t const *x, q15_t const *filter,
+					   uint32_t mu)
+{
+	uint32_t phase = mu >> (32 - POLYPHASE_PHASE_BITS);
+	int64_t weight = (mu >> (32 - POLYPHASE_PHASE_BITS - 15)) & 0x7FFF;
+	q15_t const *coeffs = &filter[phase * SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS];
+	int64_t acc_0 = frac_dot(x, coeffs);
+	int64_t acc_1 = frac_dot(x, coeffs + SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS);
+	int64_t acc = acc_0 + (((acc_1 - acc_0) * weight) >> 15);
+
+	return frac_saturate((acc + (1 << 14)) >> 15);
+}
+
+/* Cubic Lagrange interpolation between x[1] and x[2] in Farrow structure */
+static inline frac_sample_t frac_farrow(frac_sample_t const *x, uint32_t mu)
+{
+	int64_t mu_16 = mu >> 16;
+	int64_t c1 = 6 * (int64_t)x[2] - 2 * (int64_t)x[0] - 3 * (int64_t)x[1] - x[3];
+	int64_t c2 = 3 * ((int64_t)x[0] + x[2]) - 6 * (int64_t)x[1];
+	int64_t c3 = ((int64_t)x[3] - x[0]) + 3 * ((int64_t)x[1] - x[2]);
+	int64_t acc = ((((((c3 * mu_16) >> 16) + c2) * mu_16) >> 16) + c1) * mu_16 >> 16;
+
+	return frac_saturate(x[1] + acc / 6);
+}
+
+static int frac_process(struct sample_rate_converter_ctx *ctx, frac_sample_t const *input,
+			size_t samples_in, frac_sample_t *output, size_t output_size,
+			size_t *output_written)
+{
+	struct sample_rate_converter_frac *frac = &ctx->frac;
+	frac_sample_t *hist = FRAC_HIST(ctx);
+	size_t hist_len = frac->taps - 1;
+	size_t half = frac->taps / 2;
+	/* Output samples can be produced as long as the newest sample they use is available */
+	uint64_t end = (uint64_t)(hist_len + samples_in - half) << 32;
+	size_t samples_out = 0;
+
+	if (frac->pos < end) {
+		samples_out = (end - frac->pos + frac->step - 1) / frac->step;
+	}
+
+	if ((samples_out * sizeof(frac_sample_t)) > output_size) {
+		LOG_ERR("Conversion process will produce more bytes than the output buffer can "
+			"hold");
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < samples_out; i++) {
+		frac_sample_t window[SAMPLE_RATE_CONVERTER_FRAC_TAPS_MAX];
+		frac_sample_t const *x;
+		size_t start = (size_t)(frac->pos >> 32) + 1 - half;
+		uint32_t mu = (uint32_t)frac->pos;
+
+		if (start >= hist_len) {
+			x = &input[start - hist_len];
+		} else {
+			/* Only the first few output samples need the history */
+			for (size_t j = 0; j < frac->taps; j++) {
+				size_t idx = start + j;
+
+				window[j] = (idx < hist_len) ? hist[idx] : input[idx - hist_len];
+			}
+
+			x = window;
+		}
+
+		if (frac->filter != NULL) {
+			output[i] = frac_polyphase(x, frac->filter, mu);
+		} else {
+			output[i] = frac_farrow(x, mu);
+		}
+
+		frac->pos += frac->step;
+	}
+
+	frac->pos -= (uint64_t)samples_in << 32;
+
+	if (samples_in >= hist_len) {
+		memcpy(hist, &input[samples_in - hist_len], hist_len * sizeof(frac_sample_t));
+	} else {
+		memmove(hist, &hist[samples_in], (hist_len - samples_in) * sizeof(frac_sample_t));
+		memcpy(&hist[hist_len - samples_in], input, samples_in * sizeof(frac_sample_t));
+	}
+
+	*output_written = samples_out * sizeof(frac_sample_t);
+
+	return 0;
+}
+
 /**
  * @brief Reconfigures the sample rate converter context.
  *
@@ -102,6 +308,10 @@ static int sample_rate_converter_reconfigure(struct sample_rate_converter_ctx *c
 
 	__ASSERT(ctx != NULL, "Context cannot be NULL");
 
+	if (filter_is_fractional(filter)) {
+		return frac_reconfigure(ctx, sample_rate_input, sample_rate_output, filter);
+	}
+
 	ret = validate_sample_rates(sample_rate_input, sample_rate_output);
 	if (ret) {
 		LOG_ERR("Invalid sample rate given (%d)", ret);
@@ -199,11 +409,31 @@ int sample_rate_converter_open(struct sample_rate_converter_ctx *ctx)
 	return 0;
 }
 
-int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
-				  enum sample_rate_converter_filter filter, void const *const input,
-				  size_t input_size, uint32_t sample_rate_input, void *const output,
-				  size_t output_size, size_t *output_written,
-				  uint32_t sample_rate_output)
+int sample_rate_converter_drift_set(struct sample_rate_converter_ctx *ctx, int32_t drift_ppm)
+{
+	if (ctx == NULL) {
+		LOG_ERR("Context cannot be NULL");
+		return -EINVAL;
+	}
+
+	if (abs(drift_ppm) > SAMPLE_RATE_CONVERTER_DRIFT_PPM_MAX) {
+		LOG_ERR("Drift correction %d ppm is out of range", drift_ppm);
+		return -EINVAL;
+	}
+
+	ctx->frac.drift_ppm = drift_ppm;
+
+	if (filter_is_fractional(ctx->filter_type)) {
+		frac_step_update(ctx);
+	}
+
+	return 0;
+}
+
+/* Kept out of line, so that the internal buffers are only on the stack for integer ratios. */
+static __noinline int int_process(struct sample_rate_converter_ctx *ctx, void const *const input,
+				  size_t input_size, size_t samples_in, void *const output,
+				  size_t output_size, size_t *output_written)
 {
 	int ret;
 	const uint8_t *read_ptr;
@@ -219,34 +449,6 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 	size_t bytes_per_sample = sizeof(uint32_t);
 #endif
 
-	if (input_size % bytes_per_sample != 0) {
-		LOG_ERR("Size of input is not a byte multiple");
-		return -EINVAL;
-	}
-
-	size_t samples_in = input_size / bytes_per_sample;
-
-	if (samples_in > CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX) {
-		LOG_ERR("Too many samples given as input");
-		return -EINVAL;
-	}
-
-	if ((ctx == NULL) || (input == NULL) || (output == NULL) || (output_written == NULL)) {
-		LOG_ERR("Null pointer received");
-		return -EINVAL;
-	}
-
-	if ((ctx->sample_rate_input != sample_rate_input) ||
-	    (ctx->sample_rate_output != sample_rate_output) || (ctx->filter_type != filter)) {
-		LOG_DBG("State has changed, re-initializing filter");
-		ret = sample_rate_converter_reconfigure(ctx, sample_rate_input, sample_rate_output,
-							filter);
-		if (ret) {
-			LOG_ERR("Failed to initialize converter (%d)", ret);
-			return ret;
-		}
-	}
-
 	if ((ctx->conversion_ratio < 0) && (samples_in < abs(ctx->conversion_ratio))) {
 		LOG_ERR("Number of samples in can not be less than the conversion ratio (%d) when "
 			"downsampling",
@@ -393,3 +595,54 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 
 	return 0;
 }
+
+int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
+				  enum sample_rate_converter_filter filter, void const *const input,
+				  size_t input_size, uint32_t sample_rate_input, void *const output,
+				  size_t output_size, size_t *output_written,
+				  uint32_t sample_rate_output)
+{
+	int ret;
+
+#if CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	size_t bytes_per_sample = sizeof(uint16_t);
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	size_t bytes_per_sample = sizeof(uint32_t);
+#endif
+
+	if (input_size % bytes_per_sample != 0) {
+		LOG_ERR("Size of input is not a byte multiple");
+		return -EINVAL;
+	}
+
+	size_t samples_in = input_size / bytes_per_sample;
+
+	if (!filter_is_fractional(filter) &&
+	    (samples_in > CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX)) {
+		LOG_ERR("Too many samples given as input");
+		return -EINVAL;
+	}
+
+	if ((ctx == NULL) || (input == NULL) || (output == NULL) || (output_written == NULL)) {
+		LOG_ERR("Null pointer received");
+		return -EINVAL;
+	}
+
+	if ((ctx->sample_rate_input != sample_rate_input) ||
+	    (ctx->sample_rate_output != sample_rate_output) || (ctx->filter_type != filter)) {
+		LOG_DBG("State has changed, re-initializing filter");
+		ret = sample_rate_converter_reconfigure(ctx, sample_rate_input, sample_rate_output,
+							filter);
+		if (ret) {
+			LOG_ERR("Failed to initialize converter (%d)", ret);
+			return ret;
+		}
+	}
+
+	if (filter_is_fractional(filter)) {
+		return frac_process(ctx, input, samples_in, output, output_size, output_written);
+	}
+
+	return int_process(ctx, input, input_size, samples_in, output, output_size,
+			   output_written);
+}
@@ -135,6 +135,118 @@ static const q31_t filter_24khz_to_48khz_32bit_simple[] = {
 #endif
 #endif /* CONFIG_SAMPLE_RATE_CONVERTER_FILTER_SIMPLE */
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_FILTER_POLYPHASE
+/**
+ * Kaiser windowed sinc (beta = 6) with the cut-off at 0.85 times the Nyquist frequency of the
+ * input, split into phases. Each phase is normalized to unity gain in Q15 format. Phase k holds
+ * the taps for a fractional delay of k / SAMPLE_RATE_CONVERTER_POLYPHASE_PHASES input samples,
+ * and an extra phase is added so that the converter can interpolate between the two closest
+ * phases.
+ */
+static const q15_t filter_polyphase[SAMPLE_RATE_CONVERTER_POLYPHASE_PHASES + 1]
+				   [SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS] = {
+	/* Phase 0/32 */
+	{0xFFF0, 0xFFA8, 0x01C3, 0xFB51, 0x0904, 0xF222, 0x11BC, 0x6CE4,
+	 0x11BC, 0xF222, 0x0904, 0xFB51, 0x01C3, 0xFFA8, 0xFFF0, 0x0000},
+	/* Phase 1/32 */
+	{0xFFF9, 0xFF95, 0x01DC, 0xFB4E, 0x08B2, 0xF34C, 0x0E47, 0x6CB4,
+	 0x1548, 0xF109, 0x0947, 0xFB5F, 0x01A6, 0xFFBD, 0xFFE7, 0x000E},
+	/* Phase 2/32 */
+	{0x0001, 0xFF84, 0x01F1, 0xFB53, 0x0854, 0xF480, 0x0AF3, 0x6C4D,
+	 0x18F0, 0xEFFE, 0x097A, 0xFB76, 0x0183, 0xFFD4, 0xFFDE, 0x0010},
+	/* Phase 3/32 */
+	{0x0008, 0xFF74, 0x0200, 0xFB60, 0x07EA, 0xF5BC, 0x07C1, 0x6BA7,
+	 0x1CAD, 0xEF07, 0x099E, 0xFB96, 0x015C, 0xFFEC, 0xFFD4, 0x0012},
+	/* Phase 4/32 */
+	{0x000F, 0xFF67, 0x020B, 0xFB76, 0x0775, 0xF6FD, 0x04B3, 0x6ABD,
+	 0x207C, 0xEE24, 0x09B1, 0xFBC1, 0x0131, 0x0006, 0xFFC9, 0x0015},
+	/* Phase 5/32 */
+	{0x0015, 0xFF5B, 0x0212, 0xFB93, 0x06F7, 0xF842, 0x01CC, 0x6992,
+	 0x245B, 0xED59, 0x09B2, 0xFBF5, 0x0101, 0x0022, 0xFFBE, 0x0018},
+	/* Phase 6/32 */
+	{0x001B, 0xFF52, 0x0215, 0xFBB7, 0x0671, 0xF988, 0xFF0D, 0x6829,
+	 0x2844, 0xECA8, 0x09A1, 0xFC33, 0x00CD, 0x003E, 0xFFB3, 0x001A},
+	/* Phase 7/32 */
+	{0x001F, 0xFF4A, 0x0213, 0xFBE2, 0x05E4, 0xFACD, 0xFC77, 0x6684,
+	 0x2C34, 0xEC14, 0x097D, 0xFC7B, 0x0095, 0x005C, 0xFFA8, 0x001D},
+	/* Phase 8/32 */
+	{0x0023, 0xFF45, 0x020D, 0xFC13, 0x0552, 0xFC0F, 0xFA0E, 0x649F,
+	 0x3028, 0xEB9F, 0x0945, 0xFCCD, 0x005A, 0x007A, 0xFF9D, 0x0020},
+	/* Phase 9/32 */
+	{0x0027, 0xFF41, 0x0204, 0xFC49, 0x04BB, 0xFD4B, 0xF7D1, 0x6284,
+	 0x341B, 0xEB4B, 0x08F9, 0xFD28, 0x001B, 0x009A, 0xFF92, 0x0022},
+	/* Phase 10/32 */
+	{0x002A, 0xFF3E, 0x01F8, 0xFC84, 0x0421, 0xFE7F, 0xF5C2, 0x6031,
+	 0x380A, 0xEB1B, 0x089A, 0xFD8C, 0xFFD9, 0x00B9, 0xFF88, 0x0024},
+	/* Phase 11/32 */
+	{0x002C, 0xFF3E, 0x01E8, 0xFCC3, 0x0385, 0xFFAA, 0xF3E2, 0x5DAA,
+	 0x3BF0, 0xEB10, 0x0826, 0xFDF9, 0xFF94, 0x00D9, 0xFF7D, 0x0027},
+	/* Phase 12/32 */
+	{0x002D, 0xFF3F, 0x01D5, 0xFD06, 0x02E9, 0x00CA, 0xF231, 0x5AEF,
+	 0x3FCA, 0xEB2C, 0x079F, 0xFE6E, 0xFF4E, 0x00F9, 0xFF73, 0x0029},
+	/* Phase 13/32 */
+	{0x002E, 0xFF42, 0x01C0, 0xFD4B, 0x024D, 0x01DD, 0xF0AF, 0x580A,
+	 0x4392, 0xEB71, 0x0703, 0xFEEA, 0xFF05, 0x0119, 0xFF69, 0x002B},
+	/* Phase 14/32 */
+	{0x002F, 0xFF45, 0x01A8, 0xFD93, 0x01B3, 0x02E3, 0xEF5C, 0x54F8,
+	 0x4746, 0xEBE0, 0x0654, 0xFF6E, 0xFEBB, 0x0138, 0xFF60, 0x002C},
+	/* Phase 15/32 */
+	{0x002F, 0xFF4B, 0x018E, 0xFDDC, 0x011B, 0x03D9, 0xEE38, 0x51BD,
+	 0x4AE2, 0xEC7B, 0x0592, 0xFFF8, 0xFE71, 0x0156, 0xFF58, 0x002D},
+	/* Phase 16/32 */
+	{0x002E, 0xFF51, 0x0173, 0xFE26, 0x0087, 0x04BE, 0xED42, 0x4E62,
+	 0x4E60, 0xED42, 0x04BE, 0x0087, 0xFE26, 0x0173, 0xFF51, 0x002E},
+	/* Phase 17/32 */
+	{0x002D, 0xFF58, 0x0156, 0xFE71, 0xFFF8, 0x0592, 0xEC7B, 0x4AE2,
+	 0x51BD, 0xEE38, 0x03D9, 0x011B, 0xFDDC, 0x018E, 0xFF4B, 0x002F},
+	/* Phase 18/32 */
+	{0x002C, 0xFF60, 0x0138, 0xFEBB, 0xFF6E, 0x0654, 0xEBE0, 0x4746,
+	 0x54F8, 0xEF5C, 0x02E3, 0x01B3, 0xFD93, 0x01A8, 0xFF45, 0x002F},
+	/* Phase 19/32 */
+	{0x002B, 0xFF69, 0x0119, 0xFF05, 0xFEEA, 0x0703, 0xEB71, 0x4392,
+	 0x580A, 0xF0AF, 0x01DD, 0x024D, 0xFD4B, 0x01C0, 0xFF42, 0x002E},
+	/* Phase 20/32 */
+	{0x0029, 0xFF73, 0x00F9, 0xFF4E, 0xFE6E, 0x079F, 0xEB2C, 0x3FCA,
+	 0x5AEF, 0xF231, 0x00CA, 0x02E9, 0xFD06, 0x01D5, 0xFF3F, 0x002D},
+	/* Phase 21/32 */
+	{0x0027, 0xFF7D, 0x00D9, 0xFF94, 0xFDF9, 0x0826, 0xEB10, 0x3BF0,
+	 0x5DAA, 0xF3E2, 0xFFAA, 0x0385, 0xFCC3, 0x01E8, 0xFF3E, 0x002C},
+	/* Phase 22/32 */
+	{0x0024, 0xFF88, 0x00B9, 0xFFD9, 0xFD8C, 0x089A, 0xEB1B, 0x380A,
+	 0x6031, 0xF5C2, 0xFE7F, 0x0421, 0xFC84, 0x01F8, 0xFF3E, 0x002A},
+	/* Phase 23/32 */
+	{0x0022, 0xFF92, 0x009A, 0x001B, 0xFD28, 0x08F9, 0xEB4B, 0x341B,
+	 0x6284, 0xF7D1, 0xFD4B, 0x04BB, 0xFC49, 0x0204, 0xFF41, 0x0027},
+	/* Phase 24/32 */
+	{0x0020, 0xFF9D, 0x007A, 0x005A, 0xFCCD, 0x0945, 0xEB9F, 0x3028,
+	 0x649F, 0xFA0E, 0xFC0F, 0x0552, 0xFC13, 0x020D, 0xFF45, 0x0023},
+	/* Phase 25/32 */
+	{0x001D, 0xFFA8, 0x005C, 0x0095, 0xFC7B, 0x097D, 0xEC14, 0x2C34,
+	 0x6684, 0xFC77, 0xFACD, 0x05E4, 0xFBE2, 0x0213, 0xFF4A, 0x001F},
+	/* Phase 26/32 */
+	{0x001A, 0xFFB3, 0x003E, 0x00CD, 0xFC33, 0x09A1, 0xECA8, 0x2844,
+	 0x6829, 0xFF0D, 0xF988, 0x0671, 0xFBB7, 0x0215, 0xFF52, 0x001B},
+	/* Phase 27/32 */
+	{0x0018, 0xFFBE, 0x0022, 0x0101, 0xFBF5, 0x09B2, 0xED59, 0x245B,
+	 0x6992, 0x01CC, 0xF842, 0x06F7, 0xFB93, 0x0212, 0xFF5B, 0x0015},
+	/* Phase 28/32 */
+	{0x0015, 0xFFC9, 0x0006, 0x0131, 0xFBC1, 0x09B1, 0xEE24, 0x207C,
+	 0x6ABD, 0x04B3, 0xF6FD, 0x0775, 0xFB76, 0x020B, 0xFF67, 0x000F},
+	/* Phase 29/32 */
+	{0x0012, 0xFFD4, 0xFFEC, 0x015C, 0xFB96, 0x099E, 0xEF07, 0x1CAD,
+	 0x6BA7, 0x07C1, 0xF5BC, 0x07EA, 0xFB60, 0x0200, 0xFF74, 0x0008},
+	/* Phase 30/32 */
+	{0x0010, 0xFFDE, 0xFFD4, 0x0183, 0xFB76, 0x097A, 0xEFFE, 0x18F0,
+	 0x6C4D, 0x0AF3, 0xF480, 0x0854, 0xFB53, 0x01F1, 0xFF84, 0x0001},
+	/* Phase 31/32 */
+	{0x000E, 0xFFE7, 0xFFBD, 0x01A6, 0xFB5F, 0x0947, 0xF109, 0x1548,
+	 0x6CB4, 0x0E47, 0xF34C, 0x08B2, 0xFB4E, 0x01DC, 0xFF95, 0xFFF9},
+	/* Phase 32/32 */
+	{0x0000, 0xFFF0, 0xFFA8, 0x01C3, 0xFB51, 0x0904, 0xF222, 0x11BC,
+	 0x6CE4, 0x11BC, 0xF222, 0x0904, 0xFB51, 0x01C3, 0xFFA8, 0xFFF0},
+};
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FILTER_POLYPHASE */
+
 enum filter_conversion_ratio {
 	CONVERSION_48KHZ_TO_16KHZ = -3,
 	CONVERSION_48KHZ_TO_24KHZ = -2,
@@ -301,3 +413,31 @@ int sample_rate_converter_filter_get(enum sample_rate_converter_filter filter_ty
 #endif /* CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
 	return 0;
 }
+
+int sample_rate_converter_filter_frac_get(enum sample_rate_converter_filter filter_type,
+					  q15_t const **filter_ptr, size_t *taps)
+{
+	__ASSERT(filter_ptr != NULL, "Filter pointer cannot be NULL");
+	__ASSERT(taps != NULL, "Taps pointer cannot be NULL");
+
+	switch (filter_type) {
+#if CONFIG_SAMPLE_RATE_CONVERTER_FILTER_POLYPHASE
+	case SAMPLE_RATE_FILTER_POLYPHASE:
+		*filter_ptr = &filter_polyphase[0][0];
+		*taps = SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS;
+		break;
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FILTER_POLYPHASE */
+#if CONFIG_SAMPLE_RATE_CONVERTER_FILTER_FARROW
+	case SAMPLE_RATE_FILTER_FARROW:
+		/* The cubic Farrow structure calculates its coefficients from the input samples */
+		*filter_ptr = NULL;
+		*taps = SAMPLE_RATE_CONVERTER_FARROW_TAPS;
+		break;
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FILTER_FARROW */
+	default:
+		LOG_ERR("No matching fractional filter for type %d found", filter_type);
+		return -EINVAL;
+	}
+
+	return 0;
+}
@@ -24,4 +24,18 @@ int sample_rate_converter_filter_get(enum sample_rate_converter_filter filter_ty
 				     int conversion_ratio, void const **filter_ptr,
 				     size_t *filter_size);
 
+/**
+ * @brief Get the filter for a fractional conversion.
+ *
+ * @param[in]	filter_type	Selected fractional filter type.
+ * @param[out]	filter_ptr	Pointer to the phases of the filter, or NULL if the filter does not
+ *				use a coefficient table.
+ * @param[out]	taps		Number of input samples used for each output sample.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	No fractional filter matching the filter type found.
+ */
+int sample_rate_converter_filter_frac_get(enum sample_rate_converter_filter filter_type,
+					  q15_t const **filter_ptr, size_t *taps);
+
 #endif /* _SAMPLE_RATE_CONVERTER_FILTER_H_ */
@@ -5,6 +5,7 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/slist.h>
@@ -23,6 +24,25 @@ static K_WORK_DEFINE(event_processor, event_processor_fn);
 static sys_slist_t eventq = SYS_SLIST_STATIC_INIT(&eventq);
 static struct k_spinlock lock;
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_QUEUE)
+static void event_processor_high_prio_fn(struct k_work *work);
+
+static K_WORK_DEFINE(event_processor_high_prio, event_processor_high_prio_fn);
+static sys_slist_t eventq_high_prio = SYS_SLIST_STATIC_INIT(&eventq_high_prio);
+static struct k_work_q high_prio_work_q;
+static K_THREAD_STACK_DEFINE(high_prio_work_q_stack,
+			     CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_QUEUE_STACK_SIZE);
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+static const struct app_event_pool *event_pools[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+static struct k_spinlock pool_lock;
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING)
+static const struct app_event_coalesce *event_coalesce[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+#endif
+
 static bool log_is_event_displayed(const struct event_type *et)
 {
 	size_t idx = et - _event_type_list_start;
@@ -56,12 +76,6 @@ static void log_event(const struct app_event_header *aeh)
 {
 	const struct event_type *et = aeh->type_id;
 
-	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENTS) ||
-	    !log_is_event_displayed(et)) {
-		return;
-	}
-
-
 	if (et->log_event_func) {
 		et->log_event_func(aeh);
 	}
@@ -76,26 +90,13 @@ static void log_event(const struct app_event_header *aeh)
 	}
 }
 
-static void log_event_progress(const struct event_type *et,
-			       const struct event_listener *el)
+static void log_event_progress(const struct event_listener *el)
 {
-	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENTS) ||
-	    !IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENT_HANDLERS) ||
-	    !log_is_event_displayed(et)) {
-		return;
-	}
-
 	LOG_INF("|\tnotifying %s", el->name);
 }
 
-static void log_event_consumed(const struct event_type *et)
+static void log_event_consumed(void)
 {
-	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENTS) ||
-	    !IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENT_HANDLERS) ||
-	    !log_is_event_displayed(et)) {
-		return;
-	}
-
 	LOG_INF("|\tevent consumed");
 }
 
@@ -114,6 +115,245 @@ static void log_event_init(void)
 	}
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+static const struct app_event_pool *event_pool_get(const struct event_type *et)
+{
+	size_t idx = et - _event_type_list_start;
+
+	return event_pools[idx];
+}
+
+static bool event_pool_contains(const struct app_event_pool *pool, const void *addr)
+{
+	const char *ptr = addr;
+
+	return (ptr >= pool->buffer) &&
+	       (ptr < pool->buffer + (pool->block_size * pool->block_cnt));
+}
+
+static void event_pool_init(void)
+{
+	STRUCT_SECTION_FOREACH(app_event_pool, pool) {
+		APP_EVENT_ASSERT_ID(pool->type_id);
+
+		size_t idx = pool->type_id - _event_type_list_start;
+		int err = k_mem_slab_init(pool->slab, pool->buffer, pool->block_size,
+					  pool->block_cnt);
+
+		__ASSERT_NO_MSG(!err);
+		__ASSERT(!event_pools[idx], "Event pool of %s defined twice",
+			 pool->type_id->name);
+		ARG_UNUSED(err);
+
+		event_pools[idx] = pool;
+	}
+}
+
+void *_app_event_manager_pool_alloc(const struct event_type *type_id, size_t size)
+{
+	APP_EVENT_ASSERT_ID(type_id);
+
+	const struct app_event_pool *pool = event_pool_get(type_id);
+
+	if (!pool) {
+		return app_event_manager_alloc(size);
+	}
+
+	void *event;
+	int err = -ENOMEM;
+
+	if (size <= pool->block_size) {
+		err = k_mem_slab_alloc(pool->slab, &event, K_NO_WAIT);
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&pool_lock);
+
+	if (!err) {
+		pool->stats->alloc_cnt++;
+		pool->stats->used++;
+		pool->stats->max_used = MAX(pool->stats->max_used, pool->stats->used);
+	} else {
+		pool->stats->fallback_cnt++;
+	}
+
+	k_spin_unlock(&pool_lock, key);
+
+	if (err) {
+		LOG_DBG("Event pool of %s unavailable, use fallback allocator",
+			type_id->name);
+		return app_event_manager_alloc(size);
+	}
+
+	return event;
+}
+
+int app_event_manager_pool_stats_get(const struct event_type *type_id,
+				     struct app_event_pool_stats *stats)
+{
+	APP_EVENT_ASSERT_ID(type_id);
+
+	const struct app_event_pool *pool = event_pool_get(type_id);
+
+	if (!pool) {
+		return -ENOENT;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&pool_lock);
+
+	*stats = *pool->stats;
+
+	k_spin_unlock(&pool_lock, key);
+
+	return 0;
+}
+
+static bool event_pool_free(void *addr)
+{
+	const struct app_event_header *aeh = addr;
+
+	APP_EVENT_ASSERT_ID(aeh->type_id);
+
+	const struct app_event_pool *pool = event_pool_get(aeh->type_id);
+
+	if (!pool || !event_pool_contains(pool, addr)) {
+		return false;
+	}
+
+	k_mem_slab_free(pool->slab, addr);
+
+	k_spinlock_key_t key = k_spin_lock(&pool_lock);
+
+	__ASSERT_NO_MSG(pool->stats->used > 0);
+	pool->stats->used--;
+
+	k_spin_unlock(&pool_lock, key);
+
+	return true;
+}
+#else
+static void event_pool_init(void)
+{
+}
+
+static bool event_pool_free(void *addr)
+{
+	return false;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_POOLS */
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING)
+static const struct app_event_coalesce *event_coalesce_get(const struct event_type *et)
+{
+	size_t idx = et - _event_type_list_start;
+
+	return event_coalesce[idx];
+}
+
+static void event_coalesce_init(void)
+{
+	STRUCT_SECTION_FOREACH(app_event_coalesce, co) {
+		APP_EVENT_ASSERT_ID(co->type_id);
+
+		size_t idx = co->type_id - _event_type_list_start;
+
+		__ASSERT(!event_coalesce[idx], "Coalescing of %s defined twice",
+			 co->type_id->name);
+
+		event_coalesce[idx] = co;
+	}
+}
+
+/* Must be called with the event queue lock held. */
+static bool event_coalesce_merge(struct app_event_header *aeh)
+{
+	const struct app_event_coalesce *co = event_coalesce_get(aeh->type_id);
+
+	if (!co) {
+		return false;
+	}
+
+	struct app_event_coalesce_state *state = co->state;
+
+	if (!state->pending) {
+		state->pending = aeh;
+		state->stats.queued_cnt++;
+		return false;
+	}
+
+	if (co->merge) {
+		co->merge(state->pending, aeh);
+	} else {
+		/* Latest wins, the header of the pending event is kept. */
+		memcpy((uint8_t *)state->pending + sizeof(struct app_event_header),
+		       (const uint8_t *)aeh + sizeof(struct app_event_header),
+		       co->size - sizeof(struct app_event_header));
+	}
+
+	state->stats.merged_cnt++;
+
+	return true;
+}
+
+/* Called when the event is taken from the event queue for processing. */
+static void event_coalesce_dequeue(const struct app_event_header *aeh)
+{
+	const struct app_event_coalesce *co = event_coalesce_get(aeh->type_id);
+
+	if (!co) {
+		return;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	/* Events submitted from now on cannot be merged into the processed event. */
+	if (co->state->pending == aeh) {
+		co->state->pending = NULL;
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+int app_event_manager_coalesce_stats_get(const struct event_type *type_id,
+					 struct app_event_coalesce_stats *stats)
+{
+	APP_EVENT_ASSERT_ID(type_id);
+
+	const struct app_event_coalesce *co = event_coalesce_get(type_id);
+
+	if (!co) {
+		return -ENOENT;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	*stats = co->state->stats;
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+#else
+static void event_coalesce_init(void)
+{
+}
+
+static bool event_coalesce_merge(struct app_event_header *aeh)
+{
+	return false;
+}
+
+static void event_coalesce_dequeue(const struct app_event_header *aeh)
+{
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING */
+
+static void event_free(struct app_event_header *aeh)
+{
+	if (!event_pool_free(aeh)) {
+		app_event_manager_free(aeh);
+	}
+}
+
 void * __weak app_event_manager_alloc(size_t size)
 {
 	void *event = k_malloc(size);
@@ -137,19 +377,204 @@ void __weak app_event_manager_free(void *addr)
 	k_free(addr);
 }
 
-static void event_processor_fn(struct k_work *work)
+void app_event_manager_event_release(struct app_event_header *aeh)
+{
+	event_free(aeh);
+}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS)
+static struct k_spinlock listener_stats_lock;
+
+static void listener_stats_update(struct app_event_listener_stats *stats, uint32_t cycles)
+{
+	/* Bucket n holds the notifications that took [2^n, 2^(n+1)) cycles. */
+	size_t bucket = (cycles > 1) ? (31 - __builtin_clz(cycles)) : 0;
+
+	bucket = MIN(bucket, ARRAY_SIZE(stats->hist) - 1);
+
+	k_spinlock_key_t key = k_spin_lock(&listener_stats_lock);
+
+	stats->call_cnt++;
+	stats->total_cycles += cycles;
+	stats->max_cycles = MAX(stats->max_cycles, cycles);
+	stats->hist[bucket]++;
+
+	k_spin_unlock(&listener_stats_lock, key);
+}
+
+void app_event_manager_listener_stats_get(const struct event_listener *el,
+					  struct app_event_listener_stats *stats)
+{
+	__ASSERT_NO_MSG(el != NULL);
+
+	k_spinlock_key_t key = k_spin_lock(&listener_stats_lock);
+
+	*stats = *el->stats;
+
+	k_spin_unlock(&listener_stats_lock, key);
+}
+
+void app_event_manager_listener_stats_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&listener_stats_lock);
+
+	STRUCT_SECTION_FOREACH(event_listener, el) {
+		memset(el->stats, 0, sizeof(*el->stats));
+	}
+
+	k_spin_unlock(&listener_stats_lock, key);
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_LISTENER_STATS */
+
+static inline bool listener_notify(const struct event_listener *el,
+				   const struct app_event_header *aeh)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS)
+	uint32_t start = k_cycle_get_32();
+	bool consumed = el->notification(aeh);
+
+	listener_stats_update(el->stats, k_cycle_get_32() - start);
+
+	return consumed;
+#else
+	return el->notification(aeh);
+#endif
+}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_DISPATCH_BASELINE)
+static bool dispatch_baseline;
+
+void app_event_manager_dispatch_baseline_set(bool enable)
+{
+	dispatch_baseline = enable;
+}
+
+/* Listener loop of the previous implementation, kept for comparison */
+static void notify_listeners_baseline(const struct event_type *et,
+				      const struct app_event_header *aeh)
+{
+	bool consumed = false;
+
+	for (const struct event_subscriber *es = et->subs_start;
+	     (es != et->subs_stop) && !consumed;
+	     es++) {
+
+		__ASSERT_NO_MSG(es != NULL);
+
+		const struct event_listener *el = es->listener;
+
+		__ASSERT_NO_MSG(el != NULL);
+		__ASSERT_NO_MSG(el->notification != NULL);
+
+		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENT_HANDLERS) &&
+		    log_is_event_displayed(et)) {
+			log_event_progress(el);
+		}
+
+		consumed = listener_notify(el, aeh);
+
+		if (consumed && IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENT_HANDLERS) &&
+		    log_is_event_displayed(et)) {
+			log_event_consumed();
+		}
+	}
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_DISPATCH_BASELINE */
+
+static void notify_listeners(const struct event_type *et, const struct app_event_header *aeh,
+			     bool show_handlers)
+{
+	/* The subscribers of the event type are placed in a contiguous array
+	 * at link time, sorted by their priority.
+	 */
+	for (const struct event_subscriber *es = et->subs_start;
+	     es != et->subs_stop;
+	     es++) {
+
+		const struct event_listener *el = es->listener;
+
+		__ASSERT_NO_MSG(el != NULL);
+		__ASSERT_NO_MSG(el->notification != NULL);
+
+		if (show_handlers) {
+			log_event_progress(el);
+		}
+
+		if (listener_notify(el, aeh)) {
+			if (show_handlers) {
+				log_event_consumed();
+			}
+			break;
+		}
+	}
+}
+
+static bool high_prio_events_pending(void)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_QUEUE)
+	return !sys_slist_is_empty(&eventq_high_prio);
+#else
+	return false;
+#endif
+}
+
+static void process_event(struct app_event_header *aeh)
+{
+	APP_EVENT_ASSERT_ID(aeh->type_id);
+
+	const struct event_type *et = aeh->type_id;
+
+	/* Logging is decided once per event, so the listener loop below only
+	 * checks a local flag. With logging disabled, the checks are removed
+	 * at compile time.
+	 */
+	const bool show_event = IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENTS) &&
+				log_is_event_displayed(et);
+	const bool show_handlers = IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENT_HANDLERS) &&
+				   show_event;
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
+			h->hook(aeh);
+		}
+	}
+
+	if (show_event) {
+		log_event(aeh);
+	}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_DISPATCH_BASELINE)
+	if (dispatch_baseline) {
+		notify_listeners_baseline(et, aeh);
+	} else {
+		notify_listeners(et, aeh, show_handlers);
+	}
+#else
+	notify_listeners(et, aeh, show_handlers);
+#endif
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
+			h->hook(aeh);
+		}
+	}
+
+	event_free(aeh);
+}
+
+static void process_event_queue(sys_slist_t *queue, bool yield_to_high_prio)
 {
 	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
 
 	/* Make current event list local. */
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
-	if (sys_slist_is_empty(&eventq)) {
+	if (sys_slist_is_empty(queue)) {
 		k_spin_unlock(&lock, key);
 		return;
 	}
 
-	sys_slist_merge_slist(&events, &eventq);
+	sys_slist_merge_slist(&events, queue);
 
 	k_spin_unlock(&lock, key);
 
@@ -160,65 +585,81 @@ static void event_processor_fn(struct k_work *work)
 						       struct app_event_header,
 						       node);
 
-		APP_EVENT_ASSERT_ID(aeh->type_id);
-
-		const struct event_type *et = aeh->type_id;
+		event_coalesce_dequeue(aeh);
+		process_event(aeh);
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
-				h->hook(aeh);
-			}
+		/* Let the high priority work queue thread run even if the current thread is
+		 * cooperative.
+		 */
+		if (yield_to_high_prio && high_prio_events_pending()) {
+			k_yield();
 		}
+	}
+}
 
-		log_event(aeh);
-
-		bool consumed = false;
-
-		for (const struct event_subscriber *es = et->subs_start;
-		     (es != et->subs_stop) && !consumed;
-		     es++) {
-
-			__ASSERT_NO_MSG(es != NULL);
-
-			const struct event_listener *el = es->listener;
-
-			__ASSERT_NO_MSG(el != NULL);
-			__ASSERT_NO_MSG(el->notification != NULL);
-
-			log_event_progress(et, el);
+static void event_processor_fn(struct k_work *work)
+{
+	process_event_queue(&eventq, IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_QUEUE));
+}
 
-			consumed = el->notification(aeh);
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_QUEUE)
+static void event_processor_high_prio_fn(struct k_work *work)
+{
+	process_event_queue(&eventq_high_prio, false);
+}
 
-			if (consumed) {
-				log_event_consumed(et);
-			}
-		}
+static void high_prio_work_q_start(void)
+{
+	static const struct k_work_queue_config cfg = {
+		.name = "app_event_manager_hp",
+	};
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
-				h->hook(aeh);
-			}
-		}
+	k_work_queue_start(&high_prio_work_q, high_prio_work_q_stack,
+			   K_THREAD_STACK_SIZEOF(high_prio_work_q_stack),
+			   CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_QUEUE_THREAD_PRIORITY, &cfg);
 
-		app_event_manager_free(aeh);
-	}
+	/* Process high priority events submitted before initialization. */
+	k_work_submit_to_queue(&high_prio_work_q, &event_processor_high_prio);
 }
+#endif /* CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_QUEUE */
 
 void _event_submit(struct app_event_header *aeh)
 {
 	__ASSERT_NO_MSG(aeh);
 	APP_EVENT_ASSERT_ID(aeh->type_id);
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_QUEUE)
+	bool high_prio = app_event_get_type_flag(aeh->type_id,
+						 APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY);
+	sys_slist_t *queue = high_prio ? &eventq_high_prio : &eventq;
+#else
+	sys_slist_t *queue = &eventq;
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
+	if (event_coalesce_merge(aeh)) {
+		k_spin_unlock(&lock, key);
+
+		/* The pending event is already queued for processing. */
+		event_free(aeh);
+		return;
+	}
+
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
 		STRUCT_SECTION_FOREACH(event_submit_hook, h) {
 			h->hook(aeh);
 		}
 	}
-	sys_slist_append(&eventq, &aeh->node);
+	sys_slist_append(queue, &aeh->node);
 	k_spin_unlock(&lock, key);
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_QUEUE)
+	if (high_prio) {
+		k_work_submit_to_queue(&high_prio_work_q, &event_processor_high_prio);
+		return;
+	}
+#endif
 	k_work_submit(&event_processor);
 }
 
@@ -230,6 +671,12 @@ int app_event_manager_init(void)
 			CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT);
 
 	log_event_init();
+	event_pool_init();
+	event_coalesce_init();
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_QUEUE)
+	high_prio_work_q_start();
+#endif
 
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTINIT_HOOK)) {
 		STRUCT_SECTION_FOREACH(app_event_manager_postinit_hook, h) {
@@ -119,6 +119,18 @@ extern "C" {
 #define _EVENT_ID(ename) (&_CONCAT(__event_type_, ename))
 
 
+/* Allocate memory for an event of the given ename type. If event pools are
+ * enabled, the memory is taken from the pool defined for the event type.
+ */
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+#define _APP_EVENT_ALLOC(ename, size) \
+	_app_event_manager_pool_alloc(_EVENT_ID(ename), (size))
+#else
+#define _APP_EVENT_ALLOC(ename, size) \
+	app_event_manager_alloc(size)
+#endif
+
+
 /* Macro generates a function of name new_ename where ename is provided as
  * an argument. Allocator function is used to create an event of the given
  * ename type.
@@ -127,7 +139,7 @@ extern "C" {
 	static inline struct ename *_CONCAT(new_, ename)(void)			\
 	{									\
 		struct ename *event =						\
-			(struct ename *)app_event_manager_alloc(sizeof(*event));\
+			(struct ename *)_APP_EVENT_ALLOC(ename, sizeof(*event));\
 		BUILD_ASSERT(offsetof(struct ename, header) == 0,		\
 				 "");						\
 		if (event != NULL) {						\
@@ -145,7 +157,7 @@ extern "C" {
 	static inline struct ename *_CONCAT(new_, ename)(size_t size)			\
 	{										\
 		struct ename *event =							\
-			(struct ename *)app_event_manager_alloc(sizeof(*event) + size);	\
+			(struct ename *)_APP_EVENT_ALLOC(ename, sizeof(*event) + size);	\
 		BUILD_ASSERT((offsetof(struct ename, dyndata) +				\
 				  sizeof(event->dyndata.size)) ==			\
 				 sizeof(*event), "");					\
@@ -188,11 +200,25 @@ extern "C" {
 
 
 /* Declarations and definitions - for more details refer to public API. */
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS)
 #define _APP_EVENT_LISTENER(lname, notification_fn)					\
+	static struct app_event_listener_stats _CONCAT(__event_listener_stats_, lname);	\
 	STRUCT_SECTION_ITERABLE(event_listener, _CONCAT(__event_listener_, lname)) = {	\
 		.name = STRINGIFY(lname),						\
 		.notification = (notification_fn),					\
+		.stats = &_CONCAT(__event_listener_stats_, lname),			\
 	}
+#else
+#define _APP_EVENT_LISTENER(lname, notification_fn)					\
+	STRUCT_SECTION_ITERABLE(event_listener, _CONCAT(__event_listener_, lname)) = {	\
+		.name = STRINGIFY(lname),						\
+		.notification = (notification_fn),					\
+	}
+#endif
+
+
+/* Pointer to event listener definition. */
+#define _EVENT_LISTENER_ID(lname) (&_CONCAT(__event_listener_, lname))
 
 
 #define _APP_EVENT_TYPE_DECLARE_COMMON(ename)						\
@@ -374,6 +400,33 @@ struct event_dyndata {
 };
 
 
+/* Number of buckets in the histogram of listener notification times. */
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS)
+#define _APP_EVENT_LISTENER_HIST_BUCKETS CONFIG_APP_EVENT_MANAGER_LISTENER_STATS_HIST_BUCKETS
+#else
+#define _APP_EVENT_LISTENER_HIST_BUCKETS 1
+#endif
+
+/** @brief Execution time statistics of an event listener.
+ *
+ * Bucket n of the histogram counts the notifications that took from 2^n to
+ * 2^(n+1) - 1 CPU cycles. Bucket 0 also counts notifications that took
+ * no cycles, and the last bucket also counts all longer notifications.
+ */
+struct app_event_listener_stats {
+	/** Number of notifications. */
+	uint32_t call_cnt;
+
+	/** Longest notification time in CPU cycles. */
+	uint32_t max_cycles;
+
+	/** Total notification time in CPU cycles. */
+	uint64_t total_cycles;
+
+	/** Histogram of notification times. */
+	uint32_t hist[_APP_EVENT_LISTENER_HIST_BUCKETS];
+};
+
 /** @brief Event listener.
  *
  * All event listeners must be defined using @ref APP_EVENT_LISTENER.
@@ -387,6 +440,11 @@ struct event_listener {
 	 * not propagated to further listeners, or false, otherwise.
 	 */
 	bool (*notification)(const struct app_event_header *aeh);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS)
+	/** Execution time statistics of the listener. */
+	struct app_event_listener_stats *stats;
+#endif
 };
 
 
@@ -427,6 +485,138 @@ struct event_postprocess_hook {
 
 
 
+/** @brief Event pool statistics.
+ */
+struct app_event_pool_stats {
+	/** Number of events allocated from the pool. */
+	uint32_t alloc_cnt;
+
+	/** Number of allocations that fell back to app_event_manager_alloc. */
+	uint32_t fallback_cnt;
+
+	/** Number of pool blocks currently in use. */
+	uint16_t used;
+
+	/** Maximum number of pool blocks that were in use at the same time. */
+	uint16_t max_used;
+};
+
+/** @brief Memory pool of an event type.
+ *
+ * All event pools must be defined using @ref APP_EVENT_POOL_DEFINE or
+ * @ref APP_EVENT_POOL_DYNDATA_DEFINE.
+ */
+struct app_event_pool {
+	/** Pointer to the event type object. */
+	const struct event_type *type_id;
+
+	/** Memory slab holding the pool blocks. */
+	struct k_mem_slab *slab;
+
+	/** Memory buffer of the slab. */
+	char *buffer;
+
+	/** Size of a single pool block. */
+	size_t block_size;
+
+	/** Number of pool blocks. */
+	uint32_t block_cnt;
+
+	/** Pool statistics. */
+	struct app_event_pool_stats *stats;
+};
+
+/* Alignment of the event pool blocks. */
+#define _APP_EVENT_POOL_ALIGN 8
+
+#define _APP_EVENT_POOL_DEFINE(ename, size, cnt)					\
+	BUILD_ASSERT(IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS),			\
+		     "Enable APP_EVENT_MANAGER_EVENT_POOLS before usage");		\
+	BUILD_ASSERT((cnt) > 0, "Event pool cannot be empty");				\
+	static char __aligned(_APP_EVENT_POOL_ALIGN)					\
+		_CONCAT(__event_pool_buf_, ename)[ROUND_UP((size), _APP_EVENT_POOL_ALIGN) * (cnt)];\
+	static struct k_mem_slab _CONCAT(__event_pool_slab_, ename);			\
+	static struct app_event_pool_stats _CONCAT(__event_pool_stats_, ename);	\
+	STRUCT_SECTION_ITERABLE(app_event_pool, _CONCAT(__event_pool_, ename)) = {	\
+		.type_id    = _EVENT_ID(ename),						\
+		.slab       = &_CONCAT(__event_pool_slab_, ename),			\
+		.buffer     = _CONCAT(__event_pool_buf_, ename),			\
+		.block_size = ROUND_UP((size), _APP_EVENT_POOL_ALIGN),			\
+		.block_cnt  = (cnt),							\
+		.stats      = &_CONCAT(__event_pool_stats_, ename),			\
+	}
+
+/** @brief Event coalescing statistics.
+ */
+struct app_event_coalesce_stats {
+	/** Number of events added to the event queue. */
+	uint32_t queued_cnt;
+
+	/** Number of events merged into the event pending in the event queue. */
+	uint32_t merged_cnt;
+};
+
+/** @brief Function merging a submitted event into the pending event of the same type.
+ *
+ * @param pending  Pointer to the application event header of the pending event.
+ * @param aeh      Pointer to the application event header of the submitted event.
+ */
+typedef void (*app_event_merge_fn)(struct app_event_header *pending,
+				   const struct app_event_header *aeh);
+
+/** @brief Runtime state of the coalescing of an event type.
+ */
+struct app_event_coalesce_state {
+	/** Event of the type that is pending in the event queue. */
+	struct app_event_header *pending;
+
+	/** Coalescing statistics. */
+	struct app_event_coalesce_stats stats;
+};
+
+/** @brief Coalescing policy of an event type.
+ *
+ * All coalescing policies must be defined using @ref APP_EVENT_COALESCE_DEFINE.
+ */
+struct app_event_coalesce {
+	/** Pointer to the event type object. */
+	const struct event_type *type_id;
+
+	/** Function merging the events, NULL if the latest event wins. */
+	app_event_merge_fn merge;
+
+	/** Size of the event structure. */
+	size_t size;
+
+	/** Coalescing state. */
+	struct app_event_coalesce_state *state;
+};
+
+#define _APP_EVENT_COALESCE_DEFINE(ename, merge_fn)					\
+	BUILD_ASSERT(IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING),		\
+		     "Enable APP_EVENT_MANAGER_EVENT_COALESCING before usage");		\
+	BUILD_ASSERT(!_CONCAT(ename, _HAS_DYNDATA),					\
+		     "Events with dynamic data cannot be coalesced");			\
+	static struct app_event_coalesce_state _CONCAT(__event_coalesce_state_, ename);	\
+	STRUCT_SECTION_ITERABLE(app_event_coalesce, _CONCAT(__event_coalesce_, ename)) = {\
+		.type_id = _EVENT_ID(ename),						\
+		.merge   = (merge_fn),							\
+		.size    = sizeof(struct ename),					\
+		.state   = &_CONCAT(__event_coalesce_state_, ename),			\
+	}
+
+/** @brief Allocate an event of given type.
+ *
+ * The event is allocated from the memory pool of the event type if the pool is defined and has
+ * a free block large enough. Otherwise, the event is allocated using app_event_manager_alloc.
+ *
+ * @param type_id  Pointer to the event type object.
+ * @param size     Size of the event (in bytes).
+ * @retval Address of the allocated memory if successful, otherwise NULL.
+ */
+void *_app_event_manager_pool_alloc(const struct event_type *type_id, size_t size);
+
+
 /** @brief Submit an event to the Application Event Manager.
  *
  * @param aeh  Pointer to the application event header element in the event object.
@@ -81,6 +81,98 @@ static int show_subscribers(const struct shell *shell, size_t argc,
 	return 0;
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS)
+static int show_listener_stats(const struct shell *shell, size_t argc,
+		char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "Listener statistics (CPU cycles):\n");
+
+	STRUCT_SECTION_FOREACH(event_listener, el) {
+		struct app_event_listener_stats stats;
+
+		app_event_manager_listener_stats_get(el, &stats);
+
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "|\t[L:%s] calls: %u, avg: %llu, max: %u\n", el->name,
+			      stats.call_cnt,
+			      stats.call_cnt ? (stats.total_cycles / stats.call_cnt) : 0,
+			      stats.max_cycles);
+
+		for (size_t i = 0; i < ARRAY_SIZE(stats.hist); i++) {
+			if (stats.hist[i]) {
+				shell_fprintf(shell, SHELL_NORMAL,
+					      "|\t\t>= %lu: %u\n", BIT(i), stats.hist[i]);
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int reset_listener_stats(const struct shell *shell, size_t argc,
+		char **argv)
+{
+	app_event_manager_listener_stats_reset();
+	shell_fprintf(shell, SHELL_NORMAL, "Listener statistics reset\n");
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_LISTENER_STATS */
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+static int show_pools(const struct shell *shell, size_t argc,
+		char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "Event pools:\n");
+
+	STRUCT_SECTION_FOREACH(app_event_pool, pool) {
+		struct app_event_pool_stats stats;
+		int err = app_event_manager_pool_stats_get(pool->type_id, &stats);
+
+		if (err) {
+			shell_error(shell, "|\t[E:%s] pool not initialized",
+				    pool->type_id->name);
+			continue;
+		}
+
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "|\t[E:%s] block size: %zu, blocks: %u, used: %u, "
+			      "max used: %u, allocated: %u, fallback: %u\n",
+			      pool->type_id->name, pool->block_size, pool->block_cnt,
+			      stats.used, stats.max_used, stats.alloc_cnt,
+			      stats.fallback_cnt);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_POOLS */
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING)
+static int show_coalescing(const struct shell *shell, size_t argc,
+		char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "Coalesced events:\n");
+
+	STRUCT_SECTION_FOREACH(app_event_coalesce, co) {
+		struct app_event_coalesce_stats stats;
+		int err = app_event_manager_coalesce_stats_get(co->type_id, &stats);
+
+		if (err) {
+			shell_error(shell, "|\t[E:%s] coalescing not initialized",
+				    co->type_id->name);
+			continue;
+		}
+
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "|\t[E:%s] policy: %s, queued: %u, merged: %u\n",
+			      co->type_id->name, co->merge ? "merge" : "latest",
+			      stats.queued_cnt, stats.merged_cnt);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING */
+
 static void set_event_displaying(const struct shell *shell, size_t argc,
 				 char **argv, bool enable)
 {
@@ -155,6 +247,20 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_app_event_manager,
 	SHELL_CMD_ARG(show_subscribers, NULL, "Show subscribers",
 		      show_subscribers, 0, 0),
 	SHELL_CMD_ARG(show_events, NULL, "Show events", show_events, 0, 0),
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+	SHELL_CMD_ARG(show_pools, NULL, "Show event pools statistics",
+		      show_pools, 0, 0),
+#endif
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS)
+	SHELL_CMD_ARG(show_listener_stats, NULL, "Show listener execution time statistics",
+		      show_listener_stats, 0, 0),
+	SHELL_CMD_ARG(reset_listener_stats, NULL, "Reset listener execution time statistics",
+		      reset_listener_stats, 0, 0),
+#endif
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING)
+	SHELL_CMD_ARG(show_coalescing, NULL, "Show event coalescing statistics",
+		      show_coalescing, 0, 0),
+#endif
 	SHELL_CMD_ARG(disable, NULL, "Disable displaying event with given ID",
 		      disable_event_displaying, 0,
 		      sizeof(_app_event_manager_event_display_bm) * 8 - 1),
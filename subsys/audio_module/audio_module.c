@@ -133,6 +133,218 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 	return true;
 }
 
+/**
+ * @brief Helper function to get the audio data carried by a message.
+ *
+ * @param msg  [in]  Pointer to the message.
+ *
+ * @return Pointer to the audio data.
+ */
+static struct audio_data const *message_audio_data_get(struct audio_module_message const *msg)
+{
+	if (msg->block != NULL) {
+		return &msg->block->audio_data;
+	}
+
+	return &msg->audio_data;
+}
+
+#if CONFIG_AUDIO_MODULE_STATS
+/* List of the open modules, for the shell. */
+static sys_slist_t stats_list = SYS_SLIST_STATIC_INIT(&stats_list);
+static K_MUTEX_DEFINE(stats_list_mutex);
+
+/**
+ * @brief Get the cycle count to start a measurement from.
+ *
+ * @return The current cycle count.
+ */
+static inline uint32_t stats_cycles_get(void)
+{
+	return k_cycle_get_32();
+}
+
+/**
+ * @brief Record a call to the module's data_process function.
+ *
+ * @param handle  [in/out]  The handle for this modules instance.
+ * @param start   [in]      Cycle count from before the call.
+ * @param ret     [in]      Return value of the call.
+ */
+static void stats_process_record(struct audio_module_handle *handle, uint32_t start, int ret)
+{
+	uint32_t cycles = k_cycle_get_32() - start;
+	k_spinlock_key_t key = k_spin_lock(&handle->stats_lock);
+
+	if (ret) {
+		handle->stats.blocks_dropped++;
+	} else {
+		handle->stats.blocks_processed++;
+		handle->stats.process_cycles_total += cycles;
+		handle->stats.process_cycles_max = MAX(handle->stats.process_cycles_max, cycles);
+	}
+
+	k_spin_unlock(&handle->stats_lock, key);
+}
+
+/**
+ * @brief Record the latency of a message from being queued until it is released.
+ *
+ * @param handle  [in/out]  The handle of the module that released the message.
+ * @param msg     [in]      Pointer to the message.
+ */
+static void stats_latency_record(struct audio_module_handle *handle,
+				 struct audio_module_message const *msg)
+{
+	uint32_t cycles = k_cycle_get_32() - msg->tx_cycles;
+	k_spinlock_key_t key = k_spin_lock(&handle->stats_lock);
+
+	if (handle->stats.latency_cnt == 0 || cycles < handle->stats.latency_cycles_min) {
+		handle->stats.latency_cycles_min = cycles;
+	}
+
+	handle->stats.latency_cycles_max = MAX(handle->stats.latency_cycles_max, cycles);
+	handle->stats.latency_cycles_total += cycles;
+	handle->stats.latency_cnt++;
+
+	k_spin_unlock(&handle->stats_lock, key);
+}
+
+/**
+ * @brief Stamp a message with the time it is queued.
+ *
+ * @param msg  [in/out]  Pointer to the message.
+ */
+static inline void stats_msg_stamp(struct audio_module_message *msg)
+{
+	msg->tx_cycles = k_cycle_get_32();
+}
+
+/**
+ * @brief Update a FIFO high-water mark after a message has been queued.
+ *
+ * @param handle      [in/out]  The handle of the module owning the FIFO.
+ * @param fifo        [in]      Pointer to the FIFO.
+ * @param high_water  [in/out]  Pointer to the high-water mark to update.
+ */
+static void stats_fifo_record(struct audio_module_handle *handle, struct data_fifo *fifo,
+			      uint32_t *high_water)
+{
+	uint32_t alloced_num = 0;
+	uint32_t locked_num = 0;
+	k_spinlock_key_t key;
+
+	if (data_fifo_num_used_get(fifo, &alloced_num, &locked_num)) {
+		return;
+	}
+
+	key = k_spin_lock(&handle->stats_lock);
+	*high_water = MAX(*high_water, locked_num);
+	k_spin_unlock(&handle->stats_lock, key);
+}
+
+/**
+ * @brief Update the data slab high-water mark after a block has been allocated.
+ *
+ * @param handle  [in/out]  The handle for this modules instance.
+ */
+static void stats_slab_record(struct audio_module_handle *handle)
+{
+	uint32_t used = k_mem_slab_num_used_get(handle->thread.data_slab);
+	k_spinlock_key_t key = k_spin_lock(&handle->stats_lock);
+
+	handle->stats.data_slab_high_water = MAX(handle->stats.data_slab_high_water, used);
+
+	k_spin_unlock(&handle->stats_lock, key);
+}
+
+/**
+ * @brief Record an audio data item dropped by or on the way into a module.
+ *
+ * @param handle  [in/out]  The handle of the module.
+ */
+static void stats_drop_record(struct audio_module_handle *handle)
+{
+	k_spinlock_key_t key = k_spin_lock(&handle->stats_lock);
+
+	handle->stats.blocks_dropped++;
+
+	k_spin_unlock(&handle->stats_lock, key);
+}
+
+#define STATS_FIFO_RECORD(handle, fifo, field)                                                     \
+	stats_fifo_record((handle), (fifo), &(handle)->stats.field)
+
+#else
+static inline uint32_t stats_cycles_get(void)
+{
+	return 0;
+}
+
+static inline void stats_process_record(struct audio_module_handle *handle, uint32_t start,
+					int ret)
+{
+}
+
+static inline void stats_latency_record(struct audio_module_handle *handle,
+					struct audio_module_message const *msg)
+{
+}
+
+static inline void stats_msg_stamp(struct audio_module_message *msg)
+{
+}
+
+static inline void stats_slab_record(struct audio_module_handle *handle)
+{
+}
+
+static inline void stats_drop_record(struct audio_module_handle *handle)
+{
+}
+
+#define STATS_FIFO_RECORD(handle, fifo, field)
+#endif /* CONFIG_AUDIO_MODULE_STATS */
+
+/**
+ * @brief Allocate a block for sharing an audio data item with the destinations.
+ *
+ * @param handle  [in/out]  The handle of the sending modules instance.
+ *
+ * @return Pointer to the block if successful, NULL otherwise.
+ */
+static struct audio_module_block *block_alloc(struct audio_module_handle *handle)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(handle->blocks); i++) {
+		if (!atomic_test_and_set_bit(handle->blocks_used, i)) {
+			return &handle->blocks[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Release a single reference to a block. When the last reference is released,
+ *        the audio data memory and the block are freed.
+ *
+ * @param handle  [in/out]  The handle of the sending modules instance.
+ * @param block   [in/out]  Pointer to the block to release.
+ */
+static void block_release(struct audio_module_handle *handle, struct audio_module_block *block)
+{
+	if (atomic_dec(&block->ref_count) != 1) {
+		return;
+	}
+
+	LOG_DBG("Audio data has been consumed in module %s", handle->name);
+
+	/* Audio data has been consumed by all modules so now can free the data memory. */
+	k_mem_slab_free(handle->thread.data_slab, (void *)block->audio_data.data);
+
+	atomic_clear_bit(handle->blocks_used, block - handle->blocks);
+}
+
 /**
  * @brief General callback for releasing the data when inter-module data
  *        passing.
@@ -143,36 +355,31 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 static void audio_data_release_cb(struct audio_module_handle_private *handle,
 				  struct audio_data const *const audio_data)
 {
-	int ret;
 	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct audio_module_block *block =
+		CONTAINER_OF(audio_data, struct audio_module_block, audio_data);
 
-	ret = k_sem_take(&hdl->sem, K_NO_WAIT);
-	if (ret) {
-		LOG_ERR("Failed to take semaphore for data release callback function");
-		return;
-	}
-
-	if (k_sem_count_get(&hdl->sem) == 0) {
-		LOG_DBG("Audio data has been consumed in module %s", hdl->name);
-
-		/* Audio data has been consumed by all modules so now can free the data memory. */
-		k_mem_slab_free(hdl->thread.data_slab, (void *)audio_data->data);
-	}
+	block_release(hdl, block);
 }
 
 /**
  * @brief Send an audio data item to a module, all data is consumed by the module.
  *
+ * @note If block is not NULL, only a pointer to the block is passed to the module.
+ *       Otherwise, the audio data is copied into the message.
+ *
  * @param tx_handle            [in/out]  The handle for the sending module instance.
  * @param rx_handle            [in/out]  The handle for the receiving module instance.
  * @param audio_data           [in]      Pointer to the audio data to send to the module.
+ * @param block                [in]      Pointer to the shared block holding the audio data,
+ *                                       can be NULL.
  * @param data_in_response_cb  [in]      A pointer to a callback to run when the buffer is
  *                                       fully consumed.
  *
  * @return 0 if successful, error otherwise.
  */
 static int data_tx(struct audio_module_handle *tx_handle, struct audio_module_handle *rx_handle,
-		   struct audio_data const *const audio_data,
+		   struct audio_data const *const audio_data, struct audio_module_block *block,
 		   audio_module_response_cb data_in_response_cb)
 {
 	int ret;
@@ -182,25 +389,35 @@ static int data_tx(struct audio_module_handle *tx_handle, struct audio_module_ha
 		ret = data_fifo_pointer_first_vacant_get(rx_handle->thread.msg_rx,
 							 (void **)&data_msg_rx, K_NO_WAIT);
 		if (ret) {
+			stats_drop_record(rx_handle);
+
 			LOG_ERR("Module %s no free data buffer, ret %d", rx_handle->name, ret);
 			return ret;
 		}
 
-		/* Copy. The audio data itself will remain in its original location. */
-		memcpy(&(data_msg_rx->audio_data), audio_data, sizeof(struct audio_data));
+		if (block == NULL) {
+			/* Copy. The audio data itself will remain in its original location. */
+			memcpy(&(data_msg_rx->audio_data), audio_data, sizeof(struct audio_data));
+		}
+
+		data_msg_rx->block = block;
 		data_msg_rx->tx_handle = tx_handle;
 		data_msg_rx->response_cb = data_in_response_cb;
+		stats_msg_stamp(data_msg_rx);
 
 		ret = data_fifo_block_lock(rx_handle->thread.msg_rx, (void **)&data_msg_rx,
 					   sizeof(struct audio_module_message));
 		if (ret) {
 			data_fifo_block_free(rx_handle->thread.msg_rx, (void *)data_msg_rx);
+			stats_drop_record(rx_handle);
 
 			LOG_WRN("Module %s failed to queue audio data, ret %d", rx_handle->name,
 				ret);
 			return ret;
 		}
 
+		STATS_FIFO_RECORD(rx_handle, rx_handle->thread.msg_rx, rx_fifo_high_water);
+
 		LOG_DBG("Audio data sent to module %s", rx_handle->name);
 
 	} else {
@@ -215,13 +432,12 @@ static int data_tx(struct audio_module_handle *tx_handle, struct audio_module_ha
 /**
  * @brief Send audio data item to the module's TX FIFO.
  *
- * @param handle      [in/out]  The handle for this modules instance.
- * @param audio_data  [in]      A pointer to the audio data.
+ * @param handle  [in/out]  The handle for this modules instance.
+ * @param block   [in]      A pointer to the shared block holding the audio data.
  *
  * @return 0 if successful, error otherwise.
  */
-static int tx_fifo_put(struct audio_module_handle *handle,
-		       struct audio_data const *const audio_data)
+static int tx_fifo_put(struct audio_module_handle *handle, struct audio_module_block *block)
 {
 	int ret;
 	struct audio_module_message *data_msg_tx;
@@ -230,12 +446,14 @@ static int tx_fifo_put(struct audio_module_handle *handle,
 	ret = data_fifo_pointer_first_vacant_get(handle->thread.msg_tx, (void **)&data_msg_tx,
 						 K_NO_WAIT);
 	if (ret) {
+		stats_drop_record(handle);
+
 		LOG_WRN("No free space in TX FIFO for module %s, ret %d", handle->name, ret);
 		return ret;
 	}
 
 	/* Configure audio data. */
-	memcpy(&data_msg_tx->audio_data, audio_data, sizeof(struct audio_data));
+	data_msg_tx->block = block;
 	data_msg_tx->tx_handle = handle;
 	data_msg_tx->response_cb = audio_data_release_cb;
 
@@ -247,15 +465,13 @@ static int tx_fifo_put(struct audio_module_handle *handle,
 			ret);
 
 		data_fifo_block_free(handle->thread.msg_tx, (void *)data_msg_tx);
-
-		ret = k_sem_take(&handle->sem, K_NO_WAIT);
-		if (ret) {
-			LOG_ERR("Failed to take semaphore for TX FIFO put");
-		}
+		stats_drop_record(handle);
 
 		return ret;
 	}
 
+	STATS_FIFO_RECORD(handle, handle->thread.msg_tx, tx_fifo_high_water);
+
 	LOG_DBG("Sent audio data to output of module %s", handle->name);
 
 	return 0;
@@ -264,6 +480,10 @@ static int tx_fifo_put(struct audio_module_handle *handle,
 /**
  * @brief Send the audio data item to all connected modules.
  *
+ * @note The audio data is placed in a single reference counted block and only a pointer to
+ *       the block is passed to each destination. The audio data memory is released by
+ *       the last destination to consume it.
+ *
  * @param handle      [in/out]  The handle for this modules instance.
  * @param audio_data  [in]      A pointer to the audio data.
  *
@@ -273,9 +493,20 @@ static int send_to_connected_modules(struct audio_module_handle *handle,
 				     struct audio_data const *const audio_data)
 {
 	int ret;
+	int err = 0;
 	struct audio_module_handle *handle_to;
+	struct audio_module_block *block;
+
+	ret = k_mutex_lock(&handle->dest_mutex, LOCK_TIMEOUT_US);
+	if (ret) {
+		LOG_ERR("Failed to take MUTEX lock in time");
+		k_mem_slab_free(handle->thread.data_slab, (void *)audio_data->data);
+		return ret;
+	}
 
 	if (handle->dest_count == 0) {
+		k_mutex_unlock(&handle->dest_mutex);
+
 		LOG_WRN("Nowhere to send the audio data from module %s so releasing it",
 			handle->name);
 
@@ -284,63 +515,66 @@ static int send_to_connected_modules(struct audio_module_handle *handle,
 		return 0;
 	}
 
-	/* We need to ensure that all receiving modules have got the audio data.
-	 * This is so the first receiver cannot free the audio data before all receivers
-	 * have all gotten the audio data.
-	 */
-	ret = k_mutex_lock(&handle->dest_mutex, LOCK_TIMEOUT_US);
-	if (ret) {
-		LOG_ERR("Failed to take MUTEX lock in time");
-		return ret;
+	block = block_alloc(handle);
+	if (block == NULL) {
+		k_mutex_unlock(&handle->dest_mutex);
+		stats_drop_record(handle);
+
+		LOG_ERR("No free block in module %s, dropping audio data", handle->name);
+
+		k_mem_slab_free(handle->thread.data_slab, (void *)audio_data->data);
+
+		return -ENOMEM;
 	}
 
-	/* Here the semaphore is used as a count of the number of audio data items out in the
-	 * connected modules.
+	block->audio_data = *audio_data;
+
+	/* Every destination holds a reference until it has consumed the audio data. All the
+	 * references are taken up front, so the first receiver cannot free the audio data before
+	 * all the receivers have gotten it.
 	 */
-	ret = k_sem_init(&handle->sem, handle->dest_count, handle->dest_count);
-	if (ret) {
-		LOG_ERR("Failed to initiate semaphore");
-		return ret;
-	}
+	atomic_set(&block->ref_count, handle->dest_count);
 
 	/* Send to all internally connected modules. */
 	SYS_SLIST_FOR_EACH_CONTAINER(&handle->handle_dest_list, handle_to, node) {
-		ret = data_tx(handle, handle_to, audio_data, &audio_data_release_cb);
+		ret = data_tx(handle, handle_to, audio_data, block, &audio_data_release_cb);
 		if (ret) {
 			LOG_ERR("Failed to send audio data to module %s from %s, ret %d",
 				handle_to->name, handle->name, ret);
 
-			return ret;
+			block_release(handle, block);
+			err = ret;
 		}
 	}
 
-	ret = k_mutex_unlock(&handle->dest_mutex);
-	if (ret) {
-		LOG_ERR("Failed to release MUTEX");
-		return ret;
-	}
-
 	/* Send to this module's TX FIFO for extraction by an external
 	 * process with audio_module_rx().
 	 */
-	if (handle->use_tx_queue && handle->thread.msg_tx) {
-		ret = tx_fifo_put(handle, audio_data);
+	if (handle->use_tx_queue) {
+		ret = -ECANCELED;
+
+		if (handle->thread.msg_tx) {
+			ret = tx_fifo_put(handle, block);
+		}
+
 		if (ret) {
 			LOG_ERR("Failed to send audio data on module %s TX message queue",
 				handle->name);
 
-			ret = k_sem_take(&handle->sem, K_NO_WAIT);
-			if (ret) {
-				LOG_ERR("Failed to take semaphore");
-			}
-
-			return ret;
+			block_release(handle, block);
+			err = ret;
+		} else {
+			LOG_DBG("Sent audio data to TX message queue for module %s", handle->name);
 		}
+	}
 
-		LOG_DBG("Sent audio data to TX message queue for module %s", handle->name);
+	ret = k_mutex_unlock(&handle->dest_mutex);
+	if (ret) {
+		LOG_ERR("Failed to release MUTEX");
+		return ret;
 	}
 
-	return 0;
+	return err;
 }
 
 /**
@@ -359,6 +593,7 @@ static void module_thread_input(struct audio_module_handle *handle, void *p2, vo
 	int ret;
 	struct audio_data audio_data;
 	void *data;
+	uint32_t start;
 
 	__ASSERT(handle != NULL, "Module task has NULL handle");
 	__ASSERT(handle->description->functions->data_process != NULL,
@@ -375,13 +610,17 @@ static void module_thread_input(struct audio_module_handle *handle, void *p2, vo
 		ret = k_mem_slab_alloc(handle->thread.data_slab, (void **)&data, K_NO_WAIT);
 		__ASSERT(ret == 0, "No free data for module %s, ret %d", handle->name, ret);
 
+		stats_slab_record(handle);
+
 		/* Configure new audio data. */
 		audio_data.data = data;
 		audio_data.data_size = handle->thread.data_size;
 
 		/* Process the input audio data */
+		start = stats_cycles_get();
 		ret = handle->description->functions->data_process(
 			(struct audio_module_handle_private *)handle, NULL, &audio_data);
+		stats_process_record(handle, start, ret);
 		if (ret) {
 			k_mem_slab_free(handle->thread.data_slab, (void *)(data));
 
@@ -414,7 +653,9 @@ static void module_thread_output(struct audio_module_handle *handle, void *p2, v
 	int ret;
 
 	struct audio_module_message *msg_rx;
+	struct audio_data const *audio_data_rx;
 	size_t size;
+	uint32_t start;
 
 	__ASSERT(handle != NULL, "Module task has NULL handle");
 	__ASSERT(handle->description->functions->data_process != NULL,
@@ -436,14 +677,19 @@ static void module_thread_output(struct audio_module_handle *handle, void *p2, v
 
 		LOG_DBG("Module %s new audio data received", handle->name);
 
+		audio_data_rx = message_audio_data_get(msg_rx);
+
 		/* Process the input audio data and output from the audio system. */
+		start = stats_cycles_get();
 		ret = handle->description->functions->data_process(
-			(struct audio_module_handle_private *)handle, &msg_rx->audio_data, NULL);
+			(struct audio_module_handle_private *)handle, audio_data_rx, NULL);
+		stats_process_record(handle, start, ret);
+		stats_latency_record(handle, msg_rx);
 		if (ret) {
 			if (msg_rx->response_cb != NULL) {
 				msg_rx->response_cb(
 					(struct audio_module_handle_private *)msg_rx->tx_handle,
-					&msg_rx->audio_data);
+					audio_data_rx);
 			}
 
 			LOG_ERR("Data process error in module %s, ret %d", handle->name, ret);
@@ -452,7 +698,7 @@ static void module_thread_output(struct audio_module_handle *handle, void *p2, v
 
 		if (msg_rx->response_cb != NULL) {
 			msg_rx->response_cb((struct audio_module_handle_private *)msg_rx->tx_handle,
-					    &msg_rx->audio_data);
+					    audio_data_rx);
 		}
 
 		data_fifo_block_free(handle->thread.msg_rx, (void *)msg_rx);
@@ -475,9 +721,11 @@ static void module_thread_in_out(struct audio_module_handle *handle, void *p2, v
 {
 	int ret;
 	struct audio_module_message *msg_rx;
+	struct audio_data const *audio_data_rx;
 	struct audio_data audio_data;
 	void *data;
 	size_t size;
+	uint32_t start;
 
 	__ASSERT(handle != NULL, "Module task has NULL handle");
 	__ASSERT(handle->description->functions->data_process != NULL,
@@ -500,19 +748,26 @@ static void module_thread_in_out(struct audio_module_handle *handle, void *p2, v
 		__ASSERT(ret == 0, "No free data buffer for module %s, dropping input, ret %d",
 			 handle->name, ret);
 
+		stats_slab_record(handle);
+
 		/* Configure new audio audio_data. */
 		audio_data.data = data;
 		audio_data.data_size = handle->thread.data_size;
 
+		audio_data_rx = message_audio_data_get(msg_rx);
+
 		/* Process the input audio data into the output audio data. */
+		start = stats_cycles_get();
 		ret = handle->description->functions->data_process(
-			(struct audio_module_handle_private *)handle, &msg_rx->audio_data,
-			&audio_data);
+			(struct audio_module_handle_private *)handle, audio_data_rx, &audio_data);
+		stats_process_record(handle, start, ret);
 		if (ret) {
+			stats_latency_record(handle, msg_rx);
+
 			if (msg_rx->response_cb != NULL) {
 				msg_rx->response_cb(
 					(struct audio_module_handle_private *)(msg_rx->tx_handle),
-					&msg_rx->audio_data);
+					audio_data_rx);
 			}
 
 			data_fifo_block_free(handle->thread.msg_rx, (void *)(msg_rx));
@@ -526,9 +781,11 @@ static void module_thread_in_out(struct audio_module_handle *handle, void *p2, v
 		/* Send processed audio data to next module(s). */
 		send_to_connected_modules(handle, &audio_data);
 
+		stats_latency_record(handle, msg_rx);
+
 		if (msg_rx->response_cb != NULL) {
 			msg_rx->response_cb((struct audio_module_handle_private *)msg_rx->tx_handle,
-					    &msg_rx->audio_data);
+					    audio_data_rx);
 		}
 
 		data_fifo_block_free(handle->thread.msg_rx, (void *)msg_rx);
@@ -654,6 +911,12 @@ int audio_module_open(struct audio_module_parameters const *const parameters,
 
 	handle->state = AUDIO_MODULE_STATE_CONFIGURED;
 
+#if CONFIG_AUDIO_MODULE_STATS
+	k_mutex_lock(&stats_list_mutex, K_FOREVER);
+	sys_slist_append(&stats_list, &handle->stats_node);
+	k_mutex_unlock(&stats_list_mutex);
+#endif /* CONFIG_AUDIO_MODULE_STATS */
+
 	k_thread_start(handle->thread_id);
 
 	LOG_DBG("Thread started");
@@ -700,6 +963,12 @@ int audio_module_close(struct audio_module_handle *handle)
 
 	k_thread_abort(handle->thread_id);
 
+#if CONFIG_AUDIO_MODULE_STATS
+	k_mutex_lock(&stats_list_mutex, K_FOREVER);
+	sys_slist_find_and_remove(&stats_list, &handle->stats_node);
+	k_mutex_unlock(&stats_list_mutex);
+#endif /* CONFIG_AUDIO_MODULE_STATS */
+
 	/* Ensure module handle data is fully cleared. */
 	memset(handle, 0, sizeof(struct audio_module_handle));
 
@@ -1047,7 +1316,7 @@ int audio_module_data_tx(struct audio_module_handle *handle,
 		return -EINVAL;
 	}
 
-	return data_tx((void *)NULL, handle, audio_data, response_cb);
+	return data_tx((void *)NULL, handle, audio_data, NULL, response_cb);
 }
 
 int audio_module_data_rx(struct audio_module_handle *handle, struct audio_data *audio_data,
@@ -1056,6 +1325,7 @@ int audio_module_data_rx(struct audio_module_handle *handle, struct audio_data *
 	int ret;
 
 	struct audio_module_message *msg_rx = NULL;
+	struct audio_data const *msg_audio_data;
 	size_t msg_rx_size = 0;
 
 	if (handle == NULL || audio_data == NULL) {
@@ -1091,18 +1361,20 @@ int audio_module_data_rx(struct audio_module_handle *handle, struct audio_data *
 		return -ECANCELED;
 	}
 
+	msg_audio_data = message_audio_data_get(msg_rx);
+
 	if (audio_data->data_size != 0) {
-		if (msg_rx->audio_data.data_size > audio_data->data_size) {
+		if (msg_audio_data->data_size > audio_data->data_size) {
 			LOG_ERR("Not enough room for buffer from module %s", handle->name);
 			ret = -ECANCELED;
 		} else if (audio_data->data == NULL) {
 			LOG_WRN("Data pointer to buffer is NULL");
 		} else {
-			memcpy(&audio_data->meta, &msg_rx->audio_data.meta,
+			memcpy(&audio_data->meta, &msg_audio_data->meta,
 			       sizeof(struct audio_metadata));
-			memcpy((uint8_t *)audio_data->data, (uint8_t *)msg_rx->audio_data.data,
-			       msg_rx->audio_data.data_size);
-			audio_data->data_size = msg_rx->audio_data.data_size;
+			memcpy((uint8_t *)audio_data->data, (uint8_t *)msg_audio_data->data,
+			       msg_audio_data->data_size);
+			audio_data->data_size = msg_audio_data->data_size;
 		}
 	} else {
 		LOG_WRN("Data buffer size is 0");
@@ -1110,7 +1382,7 @@ int audio_module_data_rx(struct audio_module_handle *handle, struct audio_data *
 
 	if (msg_rx->response_cb != NULL) {
 		msg_rx->response_cb((struct audio_module_handle_private *)msg_rx->tx_handle,
-				    &msg_rx->audio_data);
+				    msg_audio_data);
 	}
 
 	data_fifo_block_free(handle->thread.msg_tx, (void *)msg_rx);
@@ -1125,6 +1397,7 @@ int audio_module_data_tx_rx(struct audio_module_handle *handle_tx,
 {
 	int ret;
 	struct audio_module_message *msg_rx;
+	struct audio_data const *msg_audio_data;
 	size_t msg_rx_size;
 
 	if (handle_tx == NULL || handle_rx == NULL) {
@@ -1158,7 +1431,7 @@ int audio_module_data_tx_rx(struct audio_module_handle *handle_tx,
 		return -EINVAL;
 	}
 
-	ret = data_tx(NULL, handle_rx, audio_data_tx, NULL);
+	ret = data_tx(NULL, handle_rx, audio_data_tx, NULL, NULL);
 	if (ret) {
 		LOG_ERR("Failed to send audio data to module %s, ret %d", handle_tx->name, ret);
 		return ret;
@@ -1172,18 +1445,20 @@ int audio_module_data_tx_rx(struct audio_module_handle *handle_tx,
 		return ret;
 	}
 
+	msg_audio_data = message_audio_data_get(msg_rx);
+
 	if (audio_data_rx->data_size != 0) {
-		if (msg_rx->audio_data.data_size > audio_data_rx->data_size) {
+		if (msg_audio_data->data_size > audio_data_rx->data_size) {
 			LOG_ERR("Not enough room for buffer from module %s", handle_rx->name);
 			ret = -ECANCELED;
 		} else if (audio_data_rx->data == NULL) {
 			LOG_WRN("Data pointer to buffer is NULL");
 		} else {
-			memcpy(&audio_data_rx->meta, &msg_rx->audio_data.meta,
+			memcpy(&audio_data_rx->meta, &msg_audio_data->meta,
 			       sizeof(struct audio_metadata));
-			memcpy((uint8_t *)audio_data_rx->data, (uint8_t *)msg_rx->audio_data.data,
-			       msg_rx->audio_data.data_size);
-			audio_data_rx->data_size = msg_rx->audio_data.data_size;
+			memcpy((uint8_t *)audio_data_rx->data, (uint8_t *)msg_audio_data->data,
+			       msg_audio_data->data_size);
+			audio_data_rx->data_size = msg_audio_data->data_size;
 		}
 	} else {
 		LOG_WRN("Data buffer size is 0");
@@ -1191,7 +1466,7 @@ int audio_module_data_tx_rx(struct audio_module_handle *handle_tx,
 
 	if (msg_rx->response_cb != NULL) {
 		msg_rx->response_cb((struct audio_module_handle_private *)msg_rx->tx_handle,
-				    &msg_rx->audio_data);
+				    msg_audio_data);
 	}
 
 	data_fifo_block_free(handle_rx->thread.msg_tx, (void *)msg_rx);
@@ -1237,6 +1512,61 @@ int audio_module_state_get(struct audio_module_handle const *const handle,
 	return 0;
 };
 
+int audio_module_stats_get(struct audio_module_handle *handle, struct audio_module_stats *stats)
+{
+#if CONFIG_AUDIO_MODULE_STATS
+	k_spinlock_key_t key;
+
+	if (handle == NULL || stats == NULL) {
+		LOG_ERR("Input parameter is NULL");
+		return -EINVAL;
+	}
+
+	if (!state_not_undefined(handle->state)) {
+		LOG_WRN("Module state is invalid");
+		return -ECANCELED;
+	}
+
+	key = k_spin_lock(&handle->stats_lock);
+	*stats = handle->stats;
+	k_spin_unlock(&handle->stats_lock, key);
+
+	return 0;
+#else
+	ARG_UNUSED(handle);
+	ARG_UNUSED(stats);
+
+	return -ENOTSUP;
+#endif /* CONFIG_AUDIO_MODULE_STATS */
+}
+
+int audio_module_stats_reset(struct audio_module_handle *handle)
+{
+#if CONFIG_AUDIO_MODULE_STATS
+	k_spinlock_key_t key;
+
+	if (handle == NULL) {
+		LOG_ERR("Module handle is NULL");
+		return -EINVAL;
+	}
+
+	if (!state_not_undefined(handle->state)) {
+		LOG_WRN("Module state is invalid");
+		return -ECANCELED;
+	}
+
+	key = k_spin_lock(&handle->stats_lock);
+	memset(&handle->stats, 0, sizeof(handle->stats));
+	k_spin_unlock(&handle->stats_lock, key);
+
+	return 0;
+#else
+	ARG_UNUSED(handle);
+
+	return -ENOTSUP;
+#endif /* CONFIG_AUDIO_MODULE_STATS */
+}
+
 int audio_module_number_channels_calculate(uint32_t locations, int8_t *number_channels)
 {
 	if (number_channels == NULL) {
@@ -1254,3 +1584,66 @@ int audio_module_number_channels_calculate(uint32_t locations, int8_t *number_ch
 
 	return 0;
 }
+
+#if CONFIG_AUDIO_MODULE_STATS && CONFIG_SHELL
+static int cmd_stats(const struct shell *shell, size_t argc, char **argv)
+{
+	struct audio_module_handle *handle;
+	struct audio_module_stats stats;
+
+	k_mutex_lock(&stats_list_mutex, K_FOREVER);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&stats_list, handle, stats_node) {
+		if (audio_module_stats_get(handle, &stats)) {
+			continue;
+		}
+
+		shell_print(shell, "%s (%s):", handle->name, handle->description->name);
+		shell_print(shell, "\tBlocks: %u processed, %u dropped", stats.blocks_processed,
+			    stats.blocks_dropped);
+		shell_print(shell, "\tProcess: avg %u us, max %u us",
+			    (uint32_t)k_cyc_to_us_floor64(stats.process_cycles_total /
+							  MAX(stats.blocks_processed, 1)),
+			    k_cyc_to_us_floor32(stats.process_cycles_max));
+		shell_print(shell, "\tLatency: min %u us, avg %u us, max %u us",
+			    k_cyc_to_us_floor32(stats.latency_cycles_min),
+			    (uint32_t)k_cyc_to_us_floor64(stats.latency_cycles_total /
+							  MAX(stats.latency_cnt, 1)),
+			    k_cyc_to_us_floor32(stats.latency_cycles_max));
+		shell_print(shell, "\tHigh-water: RX FIFO %u, TX FIFO %u, data slab %u",
+			    stats.rx_fifo_high_water, stats.tx_fifo_high_water,
+			    stats.data_slab_high_water);
+	}
+
+	k_mutex_unlock(&stats_list_mutex);
+
+	return 0;
+}
+
+static int cmd_stats_reset(const struct shell *shell, size_t argc, char **argv)
+{
+	struct audio_module_handle *handle;
+
+	k_mutex_lock(&stats_list_mutex, K_FOREVER);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&stats_list, handle, stats_node) {
+		(void)audio_module_stats_reset(handle);
+	}
+
+	k_mutex_unlock(&stats_list_mutex);
+
+	shell_print(shell, "Statistics reset");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(audio_module_cmd,
+			       SHELL_CMD(stats, NULL, "Show the statistics of all open modules",
+					 cmd_stats),
+			       SHELL_CMD(stats_reset, NULL,
+					 "Reset the statistics of all open modules",
+					 cmd_stats_reset),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(audio_module, &audio_module_cmd, "Audio module commands", NULL);
+#endif /* CONFIG_AUDIO_MODULE_STATS && CONFIG_SHELL */
@@ -22,6 +22,89 @@ static struct bt_mesh_rpl replay_list[CONFIG_BT_MESH_CRPL];
 
 EMDS_STATIC_ENTRY_DEFINE(rpl_store, CONFIG_BT_MESH_RPL_INDEX, replay_list, sizeof(replay_list));
 
+/* Hash index of the replay list by source address, so that received messages
+ * don't need a search through the whole list. The index is kept in RAM only, and
+ * is built again from the replay list when needed. Each slot holds the position
+ * in the replay list plus one, so that zero marks an empty slot.
+ */
+#define RPL_INDEX_BITS (LOG2CEIL(CONFIG_BT_MESH_CRPL) + 1)
+#define RPL_INDEX_SIZE BIT(RPL_INDEX_BITS)
+/* Slots left behind by replaced entries are cleaned up by building the index
+ * again, before the probe sequences get long.
+ */
+#define RPL_INDEX_USED_MAX (RPL_INDEX_SIZE - RPL_INDEX_SIZE / 4)
+
+BUILD_ASSERT(CONFIG_BT_MESH_CRPL < UINT16_MAX);
+
+static uint16_t rpl_index[RPL_INDEX_SIZE];
+static size_t rpl_index_used;
+/* Number of entries in use. Used entries are always at the start of the list. */
+static size_t rpl_count;
+
+static size_t rpl_index_slot(uint16_t addr)
+{
+	return ((uint32_t)addr * 0x9e3779b1U) >> (32 - RPL_INDEX_BITS);
+}
+
+static void rpl_index_insert(size_t pos)
+{
+	size_t slot = rpl_index_slot(replay_list[pos].src);
+
+	while (rpl_index[slot] != 0) {
+		slot = (slot + 1) & (RPL_INDEX_SIZE - 1);
+	}
+
+	rpl_index[slot] = pos + 1;
+	rpl_index_used++;
+}
+
+static void rpl_index_build(void)
+{
+	(void)memset(rpl_index, 0, sizeof(rpl_index));
+	rpl_index_used = 0;
+
+	for (rpl_count = 0; rpl_count < ARRAY_SIZE(replay_list); rpl_count++) {
+		if (!replay_list[rpl_count].src) {
+			break;
+		}
+
+		rpl_index_insert(rpl_count);
+	}
+}
+
+static struct bt_mesh_rpl *rpl_index_find(uint16_t addr)
+{
+	size_t slot = rpl_index_slot(addr);
+
+	for (size_t i = 0; (i < RPL_INDEX_SIZE) && (rpl_index[slot] != 0); i++) {
+		struct bt_mesh_rpl *rpl = &replay_list[rpl_index[slot] - 1];
+
+		/* The slot may belong to an entry that got a new source address. */
+		if (rpl->src == addr) {
+			return rpl;
+		}
+
+		slot = (slot + 1) & (RPL_INDEX_SIZE - 1);
+	}
+
+	return NULL;
+}
+
+static struct bt_mesh_rpl *rpl_find(uint16_t addr)
+{
+	struct bt_mesh_rpl *rpl = rpl_index_find(addr);
+
+	/* Entries after the last known one mean that the replay list has been
+	 * restored from EMDS after the index was built.
+	 */
+	if (!rpl && (rpl_count < ARRAY_SIZE(replay_list)) && replay_list[rpl_count].src) {
+		rpl_index_build();
+		rpl = rpl_index_find(addr);
+	}
+
+	return rpl;
+}
+
 void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		struct bt_mesh_net_rx *rx)
 {
@@ -32,7 +115,20 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		rpl->seg = 0;
 	}
 
-	rpl->src = rx->ctx.addr;
+	if (rpl->src != rx->ctx.addr) {
+		if (!rpl->src) {
+			rpl_count++;
+		}
+
+		rpl->src = rx->ctx.addr;
+
+		if (rpl_index_used < RPL_INDEX_USED_MAX) {
+			rpl_index_insert(rpl - replay_list);
+		} else {
+			rpl_index_build();
+		}
+	}
+
 	rpl->seq = rx->seq;
 	rpl->old_iv = rx->old_iv;
 }
@@ -45,7 +141,7 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		struct bt_mesh_rpl **match, bool bridge)
 {
-	int i;
+	struct bt_mesh_rpl *rpl;
 
 	/* Don't bother checking messages from ourselves */
 	if (rx->net_if == BT_MESH_NET_IF_LOCAL) {
@@ -57,48 +153,47 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		return false;
 	}
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		struct bt_mesh_rpl *rpl = &replay_list[i];
+	rpl = rpl_find(rx->ctx.addr);
+	if (!rpl) {
+		if (rpl_count == ARRAY_SIZE(replay_list)) {
+			LOG_ERR("RPL is full!");
+			return true;
+		}
 
 		/* Empty slot */
-		if (!rpl->src) {
-			if (match) {
-				*match = rpl;
-			} else {
-				bt_mesh_rpl_update(rpl, rx);
-			}
-
-			return false;
+		rpl = &replay_list[rpl_count];
+		if (match) {
+			*match = rpl;
+		} else {
+			bt_mesh_rpl_update(rpl, rx);
 		}
 
-		/* Existing slot for given address */
-		if (rpl->src == rx->ctx.addr) {
-			if (rx->old_iv && !rpl->old_iv) {
-				return true;
-			}
+		return false;
+	}
 
-			if ((!rx->old_iv && rpl->old_iv) ||
-			    rpl->seq < rx->seq) {
-				if (match) {
-					*match = rpl;
-				} else {
-					bt_mesh_rpl_update(rpl, rx);
-				}
+	/* Existing slot for given address */
+	if (rx->old_iv && !rpl->old_iv) {
+		return true;
+	}
 
-				return false;
-			} else {
-				return true;
-			}
+	if ((!rx->old_iv && rpl->old_iv) ||
+	    rpl->seq < rx->seq) {
+		if (match) {
+			*match = rpl;
+		} else {
+			bt_mesh_rpl_update(rpl, rx);
 		}
+
+		return false;
 	}
 
-	LOG_ERR("RPL is full!");
 	return true;
 }
 
 void bt_mesh_rpl_clear(void)
 {
 	(void)memset(replay_list, 0, sizeof(replay_list));
+	rpl_index_build();
 }
 
 void bt_mesh_rpl_reset(void)
@@ -130,6 +225,8 @@ void bt_mesh_rpl_reset(void)
 	}
 
 	(void) memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+
+	rpl_index_build();
 }
 
 void bt_mesh_rpl_pending_store(uint16_t addr)
@@ -18,18 +18,45 @@ LOG_MODULE_REGISTER(nrf_bt_scan, CONFIG_BT_SCAN_LOG_LEVEL);
 	BT_SCAN_SHORT_NAME_FILTER | BT_SCAN_APPEARANCE_FILTER | \
 	BT_SCAN_UUID_FILTER | BT_SCAN_MANUFACTURER_DATA_FILTER)
 
+/* Filters checked against the advertising data, not the address. */
+#define AD_FILTERS (MODE_CHECK & ~BT_SCAN_ADDR_FILTER)
+
+/* Size of the hash table for a number of filters. A power of two larger than
+ * twice the count, so that probe sequences stay short and always end on an
+ * empty slot.
+ */
+#define FILTER_TABLE_SIZE(cnt)                                                   \
+	(((cnt) < 2) ? 4 : ((cnt) < 4) ? 8 : ((cnt) < 8) ? 16 : ((cnt) < 16) ? 32 : \
+	 ((cnt) < 32) ? 64 : ((cnt) < 64) ? 128 : ((cnt) < 128) ? 256 :            \
+	 ((cnt) < 256) ? 512 : ((cnt) < 512) ? 1024 : 2048)
+
+/* Bitmap of the first characters of the name filters. */
+#define FIRST_CHAR_WORDS (256 / 32)
+
+#if CONFIG_BT_SCAN_BLOCKLIST
+BUILD_ASSERT(CONFIG_BT_SCAN_BLOCKLIST_LEN < 1024, "Blocklist too long for its hash table");
+#endif /* CONFIG_BT_SCAN_BLOCKLIST */
+
 /* Scan filter mutex. */
 K_MUTEX_DEFINE(scan_mutex);
 
+/* Filter update sequence number. It is odd while the filters or the blocklist
+ * are being updated, so that the receive path can check advertising reports
+ * without taking the mutex and only fall back to it when an update overlaps.
+ */
+static atomic_t filters_seq;
+
 /* Scanning control structure used to
  * compare matching filters, their mode and event generation.
  */
 struct bt_scan_control {
-	/* Number of active filters. */
-	uint8_t filter_cnt;
+	/* Active filters. */
+	uint8_t filter_mask;
 
-	/* Number of matched filters. */
-	uint8_t filter_match_cnt;
+	/* Matched filters. Each filter type is counted once, even if
+	 * several advertising data structures match it.
+	 */
+	uint8_t filter_match_mask;
 
 	/* Indicates whether at least one filter has been fitted. */
 	bool filter_match;
@@ -40,6 +67,9 @@ struct bt_scan_control {
 	/* Inform that device is connectable. */
 	bool connectable;
 
+	/* Device is on the blocklist. */
+	bool blocked;
+
 	/* Data needed to establish connection and advertising information. */
 	struct bt_scan_device_info device_info;
 
@@ -55,6 +85,12 @@ struct bt_scan_name_filter {
 	 */
 	char target_name[CONFIG_BT_SCAN_NAME_CNT][CONFIG_BT_SCAN_NAME_MAX_LEN];
 
+	/* Length of each name. */
+	uint8_t target_len[CONFIG_BT_SCAN_NAME_CNT];
+
+	/* First characters of the names, to skip most non-matching names. */
+	uint32_t first_char[FIRST_CHAR_WORDS];
+
 	/* Name filter counter. */
 	uint8_t cnt;
 
@@ -74,8 +110,14 @@ struct bt_scan_short_name_filter {
 
 		/* Minimum length of the short name. */
 		uint8_t min_len;
+
+		/* Length of the short name. */
+		uint8_t target_len;
 	} name[CONFIG_BT_SCAN_SHORT_NAME_CNT];
 
+	/* First characters of the names, to skip most non-matching names. */
+	uint32_t first_char[FIRST_CHAR_WORDS];
+
 	/* Short name filter counter. */
 	uint8_t cnt;
 
@@ -89,6 +131,9 @@ struct bt_scan_addr_filter {
 	/* Addresses advertised by the peripherals. */
 	bt_addr_le_t target_addr[CONFIG_BT_SCAN_ADDRESS_CNT];
 
+	/* Hash table of the addresses. */
+	uint16_t table[FILTER_TABLE_SIZE(CONFIG_BT_SCAN_ADDRESS_CNT)];
+
 	/* Address filter counter. */
 	uint8_t cnt;
 
@@ -120,6 +165,14 @@ struct bt_scan_uuid_filter {
 	 */
 	struct bt_scan_uuid uuid[CONFIG_BT_SCAN_UUID_CNT];
 
+	/* The UUIDs in 128-bit little-endian form, which UUIDs of any size
+	 * are converted to when compared.
+	 */
+	uint8_t uuid_128[CONFIG_BT_SCAN_UUID_CNT][BT_SCAN_UUID_128_SIZE];
+
+	/* Hash table of the 128-bit UUIDs. */
+	uint16_t table[FILTER_TABLE_SIZE(CONFIG_BT_SCAN_UUID_CNT)];
+
 	/* UUID filter counter. */
 	uint8_t cnt;
 
@@ -133,6 +186,9 @@ struct bt_scan_appearance_filter {
 	 */
 	uint16_t appearance[CONFIG_BT_SCAN_APPEARANCE_CNT];
 
+	/* Hash table of the appearances. */
+	uint16_t table[FILTER_TABLE_SIZE(CONFIG_BT_SCAN_APPEARANCE_CNT)];
+
 	/* Appearance filter counter. */
 	uint8_t cnt;
 
@@ -194,6 +250,11 @@ struct bt_scan_filters {
 	 * matched to generate an event.
 	 */
 	bool all_mode;
+
+	/* Filters that are enabled and have a filter entry slot,
+	 * set when the filters are enabled or disabled.
+	 */
+	uint8_t enabled_mask;
 };
 
 #if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
@@ -225,6 +286,9 @@ struct conn_blocklist {
 	/* Array of the blocklist devices. */
 	bt_addr_le_t addr[CONFIG_BT_SCAN_BLOCKLIST_LEN];
 
+	/* Hash table of the blocklist devices. */
+	uint16_t table[FILTER_TABLE_SIZE(CONFIG_BT_SCAN_BLOCKLIST_LEN)];
+
 	/* Blocklist device count. */
 	uint32_t count;
 };
@@ -330,24 +394,89 @@ static void notify_connecting_error(struct bt_scan_device_info *device_info)
 }
 #endif /* CONFIG_BT_CENTRAL */
 
-#if CONFIG_BT_SCAN_BLOCKLIST
-static bool blocklist_device_check(const bt_addr_le_t *addr)
+static void filters_update_begin(void)
 {
-	bool blocklist_device = false;
-
 	k_mutex_lock(&scan_mutex, K_FOREVER);
+	atomic_inc(&filters_seq);
+}
 
-	for (size_t i = 0; i < bt_scan.blocklist.count; i++) {
-		if (bt_addr_le_cmp(&bt_scan.blocklist.addr[i], addr) == 0) {
-			blocklist_device = true;
+static void filters_update_end(void)
+{
+	atomic_inc(&filters_seq);
+	k_mutex_unlock(&scan_mutex);
+}
 
-			break;
+/* Multiplicative hash of a filter key, taking four bytes at a time. */
+static uint32_t filter_hash(const void *key, size_t key_size)
+{
+	const uint8_t *data = key;
+	uint32_t hash = key_size;
+	size_t i = 0;
+
+	for (; (i + sizeof(uint32_t)) <= key_size; i += sizeof(uint32_t)) {
+		hash = (hash ^ sys_get_le32(&data[i])) * 0x9e3779b1U;
+		hash ^= hash >> 15;
+	}
+
+	for (; i < key_size; i++) {
+		hash = (hash ^ data[i]) * 0x9e3779b1U;
+	}
+
+	return hash ^ (hash >> 16);
+}
+
+/* The hash tables use linear probing and store the index of the key in the
+ * filter array plus one, so that zero marks an empty slot.
+ */
+static void filter_table_insert(uint16_t *table, size_t table_size,
+				const void *key, size_t key_size, size_t idx)
+{
+	size_t slot = filter_hash(key, key_size) & (table_size - 1);
+
+	while (table[slot] != 0) {
+		slot = (slot + 1) & (table_size - 1);
+	}
+
+	table[slot] = idx + 1;
+}
+
+static int filter_table_find(const uint16_t *table, size_t table_size,
+			     const void *keys, size_t key_size, const void *key)
+{
+	size_t slot = filter_hash(key, key_size) & (table_size - 1);
+
+	/* The probe count is bounded in case the table is being updated. */
+	for (size_t i = 0; (i < table_size) && (table[slot] != 0); i++) {
+		size_t idx = table[slot] - 1;
+
+		if (memcmp((const uint8_t *)keys + idx * key_size, key, key_size) == 0) {
+			return idx;
 		}
+
+		slot = (slot + 1) & (table_size - 1);
 	}
 
-	k_mutex_unlock(&scan_mutex);
+	return -ENOENT;
+}
 
-	return blocklist_device;
+static void first_char_set(uint32_t *first_char, uint8_t c)
+{
+	first_char[c / 32] |= BIT(c % 32);
+}
+
+static bool first_char_test(const uint32_t *first_char, uint8_t c)
+{
+	return (first_char[c / 32] & BIT(c % 32)) != 0;
+}
+
+#if CONFIG_BT_SCAN_BLOCKLIST
+/* Called without the mutex, see filters_seq. */
+static bool blocklist_device_check(const bt_addr_le_t *addr)
+{
+	return filter_table_find(bt_scan.blocklist.table,
+				 ARRAY_SIZE(bt_scan.blocklist.table),
+				 bt_scan.blocklist.addr, sizeof(bt_addr_le_t),
+				 addr) >= 0;
 }
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
@@ -456,12 +585,6 @@ static bool conn_attempts_exceeded(const bt_addr_le_t *addr)
 
 static bool scan_device_filter_check(const bt_addr_le_t *addr)
 {
-#if CONFIG_BT_SCAN_BLOCKLIST
-	if (blocklist_device_check(addr)) {
-		return false;
-	}
-#endif /* CONFIG_BT_SCAN_BLOCKLIST */
-
 #if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
 	if (conn_attempts_exceeded(addr)) {
 		return false;
@@ -509,19 +632,21 @@ static void scan_connect_with_target(struct bt_scan_control *control,
 static bool adv_addr_compare(const bt_addr_le_t *target_addr,
 			     struct bt_scan_control *control)
 {
-	const bt_addr_le_t *addr =
-			bt_scan.scan_filters.addr.target_addr;
-	uint8_t counter = bt_scan.scan_filters.addr.cnt;
-
-	for (size_t i = 0; i < counter; i++) {
-		if (bt_addr_le_cmp(target_addr, &addr[i]) == 0) {
-			control->filter_status.addr.addr = &addr[i];
+	const struct bt_scan_addr_filter *addr_filter =
+			&bt_scan.scan_filters.addr;
+	int idx;
 
-			return true;
-		}
+	idx = filter_table_find(addr_filter->table,
+				ARRAY_SIZE(addr_filter->table),
+				addr_filter->target_addr, sizeof(bt_addr_le_t),
+				target_addr);
+	if (idx < 0) {
+		return false;
 	}
 
-	return false;
+	control->filter_status.addr.addr = &addr_filter->target_addr[idx];
+
+	return true;
 }
 
 static bool is_addr_filter_enabled(void)
@@ -534,7 +659,7 @@ static void check_addr(struct bt_scan_control *control,
 {
 	if (is_addr_filter_enabled()) {
 		if (adv_addr_compare(addr, control)) {
-			control->filter_match_cnt++;
+			control->filter_match_mask |= BT_SCAN_ADDR_FILTER;
 
 			/* Information about the filters matched. */
 			control->filter_status.addr.match = true;
@@ -564,6 +689,9 @@ static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 
 	/* Add target address to filter. */
 	bt_addr_le_copy(&addr_filter[counter], target_addr);
+	filter_table_insert(bt_scan.scan_filters.addr.table,
+			    ARRAY_SIZE(bt_scan.scan_filters.addr.table),
+			    &addr_filter[counter], sizeof(bt_addr_le_t), counter);
 
 	LOG_DBG("Filter set on address type %i",
 		addr_filter[counter].type);
@@ -578,11 +706,27 @@ static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 	return 0;
 }
 
+/* Same result as strncmp(target_name, data, data_len) == 0,
+ * without going through the target name to find its end.
+ */
 static bool adv_name_cmp(const uint8_t *data,
 			 uint8_t data_len,
-			 const char *target_name)
+			 const char *target_name,
+			 uint8_t target_len)
 {
-	return strncmp(target_name, data, data_len) == 0;
+	const uint8_t *end = memchr(data, '\0', data_len);
+
+	if (end) {
+		/* The names must end at the same place. */
+		data_len = end - data;
+		if (target_len != data_len) {
+			return false;
+		}
+	} else if (target_len < data_len) {
+		return false;
+	}
+
+	return memcmp(target_name, data, data_len) == 0;
 }
 
 static bool adv_name_compare(const struct bt_data *data,
@@ -593,11 +737,17 @@ static bool adv_name_compare(const struct bt_data *data,
 	uint8_t counter = bt_scan.scan_filters.name.cnt;
 	uint8_t data_len = data->data_len;
 
+	if ((data_len > 0) && (data->data[0] != '\0') &&
+	    !first_char_test(name_filter->first_char, data->data[0])) {
+		return false;
+	}
+
 	/* Compare the name found with the name filter. */
 	for (size_t i = 0; i < counter; i++) {
 		if (adv_name_cmp(data->data,
 				 data_len,
-				 name_filter->target_name[i])) {
+				 name_filter->target_name[i],
+				 name_filter->target_len[i])) {
 
 			control->filter_status.name.name =
 				name_filter->target_name[i];
@@ -620,7 +770,7 @@ static void name_check(struct bt_scan_control *control,
 {
 	if (is_name_filter_enabled()) {
 		if (adv_name_compare(data, control)) {
-			control->filter_match_cnt++;
+			control->filter_match_mask |= BT_SCAN_NAME_FILTER;
 
 			/* Information about the filters matched. */
 			control->filter_status.name.match = true;
@@ -656,6 +806,8 @@ static int scan_name_filter_add(const char *name)
 	/* Add name to filter. */
 	memcpy(bt_scan.scan_filters.name.target_name[counter],
 	       name, name_len);
+	bt_scan.scan_filters.name.target_len[counter] = name_len;
+	first_char_set(bt_scan.scan_filters.name.first_char, name[0]);
 
 	bt_scan.scan_filters.name.cnt++;
 
@@ -667,10 +819,11 @@ static int scan_name_filter_add(const char *name)
 static bool adv_short_name_cmp(const uint8_t *data,
 			       uint8_t data_len,
 			       const char *target_name,
+			       uint8_t target_len,
 			       uint8_t short_name_min_len)
 {
 	if ((data_len >= short_name_min_len) &&
-	    (strncmp(target_name, data, data_len) == 0)) {
+	    adv_name_cmp(data, data_len, target_name, target_len)) {
 		return true;
 	}
 
@@ -685,11 +838,17 @@ static bool adv_short_name_compare(const struct bt_data *data,
 	uint8_t counter = bt_scan.scan_filters.short_name.cnt;
 	uint8_t data_len = data->data_len;
 
+	if ((data_len > 0) && (data->data[0] != '\0') &&
+	    !first_char_test(name_filter->first_char, data->data[0])) {
+		return false;
+	}
+
 	/* Compare the name found with the name filters. */
 	for (size_t i = 0; i < counter; i++) {
 		if (adv_short_name_cmp(data->data,
 				       data_len,
 				       name_filter->name[i].target_name,
+				       name_filter->name[i].target_len,
 				       name_filter->name[i].min_len)) {
 
 			control->filter_status.short_name.name =
@@ -713,7 +872,7 @@ static void short_name_check(struct bt_scan_control *control,
 {
 	if (is_short_name_filter_enabled()) {
 		if (adv_short_name_compare(data, control)) {
-			control->filter_match_cnt++;
+			control->filter_match_mask |= BT_SCAN_SHORT_NAME_FILTER;
 
 			/* Information about the filters matched. */
 			control->filter_status.short_name.match = true;
@@ -753,9 +912,11 @@ static int scan_short_name_filter_add(const struct bt_scan_short_name *short_nam
 
 	/* Add name to the filter. */
 	short_name_filter->name[counter].min_len = short_name->min_len;
+	short_name_filter->name[counter].target_len = name_len;
 	memcpy(short_name_filter->name[counter].target_name,
 	       short_name->name,
 	       name_len);
+	first_char_set(short_name_filter->first_char, short_name->name[0]);
 
 	bt_scan.scan_filters.short_name.cnt++;
 
@@ -764,43 +925,44 @@ static int scan_short_name_filter_add(const struct bt_scan_short_name *short_nam
 	return 0;
 }
 
-static bool find_uuid(const uint8_t *data,
-		      uint8_t data_len,
-		      uint8_t uuid_type,
-		      const struct bt_scan_uuid *target_uuid)
-{
-	uint8_t uuid_len;
+/* Bluetooth Base UUID, in little-endian order. 16-bit and 32-bit UUIDs
+ * are stored in its last four bytes.
+ */
+static const uint8_t uuid_128_base[BT_SCAN_UUID_128_SIZE] = {
+	0xfb, 0x34, 0x9b, 0x5f, 0x80, 0x00, 0x00, 0x80,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
 
+static uint8_t uuid_size_get(uint8_t uuid_type)
+{
 	switch (uuid_type) {
 	case BT_UUID_TYPE_16:
-		uuid_len = sizeof(uint16_t);
-		break;
+		return sizeof(uint16_t);
 
 	case BT_UUID_TYPE_32:
-		uuid_len = sizeof(uint32_t);
-		break;
+		return sizeof(uint32_t);
 
 	case BT_UUID_TYPE_128:
-		uuid_len = BT_SCAN_UUID_128_SIZE * sizeof(uint8_t);
-		break;
+		return BT_SCAN_UUID_128_SIZE * sizeof(uint8_t);
 
 	default:
-		return false;
+		return 0;
 	}
+}
 
-	for (size_t i = 0; i < data_len; i += uuid_len) {
-		struct bt_uuid_128 uuid;
-
-		if (!bt_uuid_create(&uuid.uuid, &data[i], uuid_len)) {
-			return false;
-		}
-
-		if (bt_uuid_cmp(&uuid.uuid, target_uuid->uuid) == 0) {
-			return true;
-		}
+/* Convert a little-endian UUID of any size to the 128-bit form,
+ * the same way bt_uuid_cmp() does for UUIDs of different types.
+ */
+static void uuid_128_convert(const uint8_t *data, uint8_t uuid_len,
+			     uint8_t *uuid_128)
+{
+	if (uuid_len == BT_SCAN_UUID_128_SIZE) {
+		memcpy(uuid_128, data, BT_SCAN_UUID_128_SIZE);
+		return;
 	}
 
-	return false;
+	memcpy(uuid_128, uuid_128_base, sizeof(uuid_128_base));
+	memcpy(&uuid_128[12], data, uuid_len);
 }
 
 static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
@@ -810,27 +972,55 @@ static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
 			&bt_scan.scan_filters.uuid;
 	const bool all_filters_mode = bt_scan.scan_filters.all_mode;
 	const uint8_t counter = bt_scan.scan_filters.uuid.cnt;
+	const uint8_t uuid_len = uuid_size_get(uuid_type);
 	uint8_t data_len = data->data_len;
 	uint8_t uuid_match_cnt = 0;
+	uint32_t found[(CONFIG_BT_SCAN_UUID_CNT / 32) + 1] = {0};
+	size_t first_found = SIZE_MAX;
 
-	for (size_t i = 0; i < counter; i++) {
+	if (uuid_len == 0) {
+		return false;
+	}
 
-		if (find_uuid(data->data, data_len, uuid_type,
-			      &uuid_filter->uuid[i])) {
-			control->filter_status.uuid.uuid[uuid_match_cnt] =
-				uuid_filter->uuid[i].uuid;
+	/* Look up each advertised UUID instead of searching the advertising
+	 * data for each UUID filter.
+	 */
+	for (size_t i = 0; (i + uuid_len) <= data_len; i += uuid_len) {
+		uint8_t uuid[BT_SCAN_UUID_128_SIZE];
+		int idx;
+
+		uuid_128_convert(&data->data[i], uuid_len, uuid);
+
+		idx = filter_table_find(uuid_filter->table,
+					ARRAY_SIZE(uuid_filter->table),
+					uuid_filter->uuid_128,
+					sizeof(uuid_filter->uuid_128[0]), uuid);
+		if (idx < 0) {
+			continue;
+		}
 
-			uuid_match_cnt++;
+		found[idx / 32] |= BIT(idx % 32);
+		first_found = MIN(first_found, idx);
+	}
 
-			/* In the normal filter mode,
-			 * only one UUID is needed to match.
-			 */
-			if (!all_filters_mode) {
+	if (!all_filters_mode) {
+		/* In the normal filter mode, only one UUID is needed to match.
+		 * It is the first filter found, in the order they were added.
+		 */
+		if (first_found != SIZE_MAX) {
+			control->filter_status.uuid.uuid[uuid_match_cnt] =
+				uuid_filter->uuid[first_found].uuid;
+			uuid_match_cnt++;
+		}
+	} else {
+		for (size_t i = 0; i < counter; i++) {
+			if (!(found[i / 32] & BIT(i % 32))) {
 				break;
 			}
 
-		} else if (all_filters_mode) {
-			break;
+			control->filter_status.uuid.uuid[uuid_match_cnt] =
+				uuid_filter->uuid[i].uuid;
+			uuid_match_cnt++;
 		}
 	}
 
@@ -858,7 +1048,7 @@ static void uuid_check(struct bt_scan_control *control,
 {
 	if (is_uuid_filter_enabled()) {
 		if (adv_uuid_compare(data, type, control)) {
-			control->filter_match_cnt++;
+			control->filter_match_mask |= BT_SCAN_UUID_FILTER;
 
 			/* Information about the filters matched. */
 			control->filter_status.uuid.match = true;
@@ -874,6 +1064,8 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 	struct bt_uuid_16 *uuid_16;
 	struct bt_uuid_32 *uuid_32;
 	struct bt_uuid_128 *uuid_128;
+	uint8_t *key = bt_scan.scan_filters.uuid.uuid_128[counter];
+	uint8_t uuid_le[sizeof(uint32_t)];
 
 	/* If no memory. */
 	if (counter >= CONFIG_BT_SCAN_UUID_CNT) {
@@ -895,6 +1087,9 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		uuid_filter[counter].uuid_data.uuid_16 = *uuid_16;
 		uuid_filter[counter].uuid =
 				(struct bt_uuid *)&uuid_filter[counter].uuid_data.uuid_16;
+
+		sys_put_le16(uuid_16->val, uuid_le);
+		uuid_128_convert(uuid_le, sizeof(uint16_t), key);
 		break;
 
 	case BT_UUID_TYPE_32:
@@ -903,6 +1098,9 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		uuid_filter[counter].uuid_data.uuid_32 = *uuid_32;
 		uuid_filter[counter].uuid =
 				(struct bt_uuid *)&uuid_filter[counter].uuid_data.uuid_32;
+
+		sys_put_le32(uuid_32->val, uuid_le);
+		uuid_128_convert(uuid_le, sizeof(uint32_t), key);
 		break;
 
 	case BT_UUID_TYPE_128:
@@ -911,61 +1109,53 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		uuid_filter[counter].uuid_data.uuid_128 = *uuid_128;
 		uuid_filter[counter].uuid =
 				(struct bt_uuid *)&uuid_filter[counter].uuid_data.uuid_128;
+
+		uuid_128_convert(uuid_128->val, BT_SCAN_UUID_128_SIZE, key);
 		break;
 
 	default:
 		return -EINVAL;
 	}
 
+	filter_table_insert(bt_scan.scan_filters.uuid.table,
+			    ARRAY_SIZE(bt_scan.scan_filters.uuid.table),
+			    key, BT_SCAN_UUID_128_SIZE, counter);
+
 	bt_scan.scan_filters.uuid.cnt++;
 	LOG_DBG("Added filter on UUID type %x", uuid->type);
 
 	return 0;
 }
 
-static bool find_appearance(const uint8_t *data,
-			    uint8_t data_len,
-			    const uint16_t *appearance)
-{
-	if (data_len != sizeof(uint16_t)) {
-		return false;
-	}
-
-	uint16_t decoded_appearance = sys_get_le16(data);
-
-	if (decoded_appearance == *appearance) {
-		return true;
-	}
-
-	/* Could not find the appearance among the encoded data. */
-	return false;
-}
-
 static bool adv_appearance_compare(const struct bt_data *data,
 				   struct bt_scan_control *control)
 {
 	const struct bt_scan_appearance_filter *appearance_filter =
 			&bt_scan.scan_filters.appearance;
-	const uint8_t counter =
-			bt_scan.scan_filters.appearance.cnt;
-	uint8_t data_len = data->data_len;
+	uint16_t decoded_appearance;
+	int idx;
+
+	if (data->data_len != sizeof(uint16_t)) {
+		return false;
+	}
+
+	decoded_appearance = sys_get_le16(data->data);
 
 	/* Verify if the advertised appearance matches
 	 * the provided appearance.
 	 */
-	for (size_t i = 0; i < counter; i++) {
-		if (find_appearance(data->data,
-				    data_len,
-				    &appearance_filter->appearance[i])) {
-
-			control->filter_status.appearance.appearance =
-					&appearance_filter->appearance[i];
-
-			return true;
-		}
+	idx = filter_table_find(appearance_filter->table,
+				ARRAY_SIZE(appearance_filter->table),
+				appearance_filter->appearance, sizeof(uint16_t),
+				&decoded_appearance);
+	if (idx < 0) {
+		return false;
 	}
 
-	return false;
+	control->filter_status.appearance.appearance =
+			&appearance_filter->appearance[idx];
+
+	return true;
 }
 
 static inline bool is_appearance_filter_enabled(void)
@@ -978,7 +1168,7 @@ static void appearance_check(struct bt_scan_control *control,
 {
 	if (is_appearance_filter_enabled()) {
 		if (adv_appearance_compare(data, control)) {
-			control->filter_match_cnt++;
+			control->filter_match_mask |= BT_SCAN_APPEARANCE_FILTER;
 
 			/* Information about the filters matched. */
 			control->filter_status.appearance.match = true;
@@ -1006,6 +1196,9 @@ static int scan_appearance_filter_add(uint16_t appearance)
 
 	/* Add appearance to the filter. */
 	appearance_filter[counter] = appearance;
+	filter_table_insert(bt_scan.scan_filters.appearance.table,
+			    ARRAY_SIZE(bt_scan.scan_filters.appearance.table),
+			    &appearance_filter[counter], sizeof(uint16_t), counter);
 	bt_scan.scan_filters.appearance.cnt++;
 
 	LOG_DBG("Added filter on appearance %x", appearance);
@@ -1065,7 +1258,7 @@ static void manufacturer_data_check(struct bt_scan_control *control,
 {
 	if (is_manufacturer_data_filter_enabled()) {
 		if (adv_manufacturer_data_compare(data, control)) {
-			control->filter_match_cnt++;
+			control->filter_match_mask |= BT_SCAN_MANUFACTURER_DATA_FILTER;
 
 			/* Information about the filters matched. */
 			control->filter_status.manufacturer_data.match = true;
@@ -1171,7 +1364,7 @@ int bt_scan_filter_add(enum bt_scan_filter_type type,
 		return -EINVAL;
 	}
 
-	k_mutex_lock(&scan_mutex, K_FOREVER);
+	filters_update_begin();
 
 	switch (type) {
 	case BT_SCAN_FILTER_TYPE_NAME:
@@ -1209,43 +1402,83 @@ int bt_scan_filter_add(enum bt_scan_filter_type type,
 		break;
 	}
 
-	k_mutex_unlock(&scan_mutex);
+	filters_update_end();
 
 	return err;
 }
 
 void bt_scan_filter_remove_all(void)
 {
-	k_mutex_lock(&scan_mutex, K_FOREVER);
+	filters_update_begin();
 
 	struct bt_scan_name_filter *name_filter =
 			&bt_scan.scan_filters.name;
 	name_filter->cnt = 0;
+	memset(name_filter->first_char, 0, sizeof(name_filter->first_char));
 
 	struct bt_scan_short_name_filter *short_name_filter =
 			&bt_scan.scan_filters.short_name;
 	short_name_filter->cnt = 0;
+	memset(short_name_filter->first_char, 0,
+	       sizeof(short_name_filter->first_char));
 
 	struct bt_scan_addr_filter *addr_filter =
 			&bt_scan.scan_filters.addr;
 	addr_filter->cnt = 0;
+	memset(addr_filter->table, 0, sizeof(addr_filter->table));
 
 	struct bt_scan_uuid_filter *uuid_filter =
 			&bt_scan.scan_filters.uuid;
 	uuid_filter->cnt = 0;
+	memset(uuid_filter->table, 0, sizeof(uuid_filter->table));
 
 	struct bt_scan_appearance_filter *appearance_filter =
 			&bt_scan.scan_filters.appearance;
 	appearance_filter->cnt = 0;
+	memset(appearance_filter->table, 0, sizeof(appearance_filter->table));
 
 	struct bt_scan_manufacturer_data_filter *manufacturer_data_filter =
 		&bt_scan.scan_filters.manufacturer_data;
 	manufacturer_data_filter->cnt = 0;
 
-	k_mutex_unlock(&scan_mutex);
+	filters_update_end();
 }
 
-void bt_scan_filter_disable(void)
+/* Work out which filters are checked for each advertising report,
+ * so that it is not done again for every report.
+ */
+static void enabled_filters_compile(void)
+{
+	struct bt_scan_filters *filters = &bt_scan.scan_filters;
+
+	filters->enabled_mask = 0;
+
+	if (is_addr_filter_enabled()) {
+		filters->enabled_mask |= BT_SCAN_ADDR_FILTER;
+	}
+
+	if (is_name_filter_enabled()) {
+		filters->enabled_mask |= BT_SCAN_NAME_FILTER;
+	}
+
+	if (is_short_name_filter_enabled()) {
+		filters->enabled_mask |= BT_SCAN_SHORT_NAME_FILTER;
+	}
+
+	if (is_uuid_filter_enabled()) {
+		filters->enabled_mask |= BT_SCAN_UUID_FILTER;
+	}
+
+	if (is_appearance_filter_enabled()) {
+		filters->enabled_mask |= BT_SCAN_APPEARANCE_FILTER;
+	}
+
+	if (is_manufacturer_data_filter_enabled()) {
+		filters->enabled_mask |= BT_SCAN_MANUFACTURER_DATA_FILTER;
+	}
+}
+
+static void scan_filters_disable(void)
 {
 	/* Disable all filters. */
 	bt_scan.scan_filters.name.enabled = false;
@@ -1256,6 +1489,14 @@ void bt_scan_filter_disable(void)
 	bt_scan.scan_filters.manufacturer_data.enabled = false;
 }
 
+void bt_scan_filter_disable(void)
+{
+	filters_update_begin();
+	scan_filters_disable();
+	enabled_filters_compile();
+	filters_update_end();
+}
+
 int bt_scan_filter_enable(uint8_t mode, bool match_all)
 {
 	/* Check if the mode is correct. */
@@ -1263,8 +1504,10 @@ int bt_scan_filter_enable(uint8_t mode, bool match_all)
 		return -EINVAL;
 	}
 
+	filters_update_begin();
+
 	/* Disable filters. */
-	bt_scan_filter_disable();
+	scan_filters_disable();
 
 	struct bt_scan_filters *filters = &bt_scan.scan_filters;
 
@@ -1296,6 +1539,10 @@ int bt_scan_filter_enable(uint8_t mode, bool match_all)
 	/* Select the filter mode. */
 	filters->all_mode = match_all;
 
+	enabled_filters_compile();
+
+	filters_update_end();
+
 	return 0;
 }
 
@@ -1379,35 +1626,6 @@ void bt_scan_update_init_conn_params(struct bt_le_conn_param *new_conn_param)
 	bt_scan.conn_param = *new_conn_param;
 }
 
-static void check_enabled_filters(struct bt_scan_control *control)
-{
-	control->filter_cnt = 0;
-
-	if (is_addr_filter_enabled()) {
-		control->filter_cnt++;
-	}
-
-	if (is_name_filter_enabled()) {
-		control->filter_cnt++;
-	}
-
-	if (is_short_name_filter_enabled()) {
-		control->filter_cnt++;
-	}
-
-	if (is_uuid_filter_enabled()) {
-		control->filter_cnt++;
-	}
-
-	if (is_appearance_filter_enabled()) {
-		control->filter_cnt++;
-	}
-
-	if (is_manufacturer_data_filter_enabled()) {
-		control->filter_cnt++;
-	}
-}
-
 static bool adv_data_found(struct bt_data *data, void *user_data)
 {
 	struct bt_scan_control *scan_control =
@@ -1461,12 +1679,12 @@ static bool adv_data_found(struct bt_data *data, void *user_data)
 static void filter_state_check(struct bt_scan_control *control,
 			       const bt_addr_le_t *addr)
 {
-	if (!scan_device_filter_check(addr)) {
+	if (control->blocked || !scan_device_filter_check(addr)) {
 		return;
 	}
 
 	if (control->all_mode &&
-	    (control->filter_match_cnt == control->filter_cnt)) {
+	    (control->filter_match_mask == control->filter_mask)) {
 		notify_filter_matched(&control->device_info,
 				      &control->filter_status,
 				      control->connectable);
@@ -1491,31 +1709,71 @@ static void filter_state_check(struct bt_scan_control *control,
 	}
 }
 
-static void scan_recv(const struct bt_le_scan_recv_info *info,
-		      struct net_buf_simple *ad)
+static void filters_check(struct bt_scan_control *control,
+			  const struct bt_le_scan_recv_info *info,
+			  struct net_buf_simple *ad)
 {
-	struct bt_scan_control scan_control;
+	const struct bt_scan_filters *filters = &bt_scan.scan_filters;
 	struct net_buf_simple_state state;
 
-	memset(&scan_control, 0, sizeof(scan_control));
-
-	scan_control.all_mode = bt_scan.scan_filters.all_mode;
+	memset(control, 0, sizeof(*control));
 
-	check_enabled_filters(&scan_control);
+#if CONFIG_BT_SCAN_BLOCKLIST
+	if (blocklist_device_check(info->addr)) {
+		control->blocked = true;
+		return;
+	}
+#endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
-	/* Check id device is connectable. */
-	scan_control.connectable =
-		(info->adv_props & BT_GAP_ADV_PROP_CONNECTABLE) != 0;
+	control->all_mode = filters->all_mode;
+	control->filter_mask = filters->enabled_mask;
 
 	/* Check the address filter. */
-	check_addr(&scan_control, info->addr);
+	check_addr(control, info->addr);
+
+	/* In the multifilter mode, the advertising data cannot make up for
+	 * an address that does not match.
+	 */
+	if (control->all_mode && (control->filter_mask & BT_SCAN_ADDR_FILTER) &&
+	    !(control->filter_match_mask & BT_SCAN_ADDR_FILTER)) {
+		return;
+	}
+
+	if (!(control->filter_mask & AD_FILTERS)) {
+		return;
+	}
 
 	/* Save advertising buffer state to transfer it
 	 * data to application if futher processing is needed.
 	 */
 	net_buf_simple_save(ad, &state);
-	bt_data_parse(ad, adv_data_found, (void *)&scan_control);
+	bt_data_parse(ad, adv_data_found, (void *)control);
 	net_buf_simple_restore(ad, &state);
+}
+
+static void scan_recv(const struct bt_le_scan_recv_info *info,
+		      struct net_buf_simple *ad)
+{
+	struct bt_scan_control scan_control;
+	atomic_val_t seq;
+
+	/* Check the filters without the mutex, unless they are updated
+	 * at the same time.
+	 */
+	seq = atomic_get(&filters_seq);
+	if (!(seq & 1)) {
+		filters_check(&scan_control, info, ad);
+	}
+
+	if ((seq & 1) || (atomic_get(&filters_seq) != seq)) {
+		k_mutex_lock(&scan_mutex, K_FOREVER);
+		filters_check(&scan_control, info, ad);
+		k_mutex_unlock(&scan_mutex);
+	}
+
+	/* Check id device is connectable. */
+	scan_control.connectable =
+		(info->adv_props & BT_GAP_ADV_PROP_CONNECTABLE) != 0;
 
 	scan_control.device_info.recv_info = info;
 	scan_control.device_info.conn_param = &bt_scan.conn_param;
@@ -1586,7 +1844,7 @@ int bt_scan_blocklist_device_add(const bt_addr_le_t *addr)
 
 	bt_addr_le_to_str(addr, addr_str, sizeof(addr_str));
 
-	k_mutex_lock(&scan_mutex, K_FOREVER);
+	filters_update_begin();
 
 	/* Check if the device is already on the blocklist. */
 	for (size_t i = 0; i < ARRAY_SIZE(bt_scan.blocklist.addr); i++) {
@@ -1604,21 +1862,25 @@ int bt_scan_blocklist_device_add(const bt_addr_le_t *addr)
 	} else {
 		bt_addr_le_copy(&bt_scan.blocklist.addr[bt_scan.blocklist.count],
 				addr);
+		filter_table_insert(bt_scan.blocklist.table,
+				    ARRAY_SIZE(bt_scan.blocklist.table),
+				    &bt_scan.blocklist.addr[bt_scan.blocklist.count],
+				    sizeof(bt_addr_le_t), bt_scan.blocklist.count);
 		bt_scan.blocklist.count++;
 		LOG_INF("Device %s added to the scanning blocklist", addr_str);
 	}
 
 out:
-	k_mutex_unlock(&scan_mutex);
+	filters_update_end();
 
 	return err;
 }
 
 void bt_scan_blocklist_clear(void)
 {
-	k_mutex_lock(&scan_mutex, K_FOREVER);
+	filters_update_begin();
 	memset(&bt_scan.blocklist, 0, sizeof(bt_scan.blocklist));
-	k_mutex_unlock(&scan_mutex);
+	filters_update_end();
 }
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
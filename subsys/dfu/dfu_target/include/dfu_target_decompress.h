@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef DFU_TARGET_DECOMPRESS_H__
+#define DFU_TARGET_DECOMPRESS_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+/** Magic word at the start of a compressed image, "DFLZ" in little endian byte order. */
+#define DFU_TARGET_DECOMPRESS_MAGIC 0x5a4c4644
+
+/** Version of the compressed image header. */
+#define DFU_TARGET_DECOMPRESS_VERSION 1
+
+/** The image was run through the ARM thumb BCJ filter before being compressed. */
+#define DFU_TARGET_DECOMPRESS_FLAG_ARM_THUMB BIT(0)
+
+/**
+ * @brief Header prepended to a compressed image, all fields are little endian.
+ *
+ * The header is followed by the LZMA compressed image, starting with the
+ * LZMA properties expected by the nRF compression library.
+ */
+struct dfu_target_decompress_header {
+	/** DFU_TARGET_DECOMPRESS_MAGIC */
+	uint32_t magic;
+	/** DFU_TARGET_DECOMPRESS_VERSION */
+	uint8_t version;
+	/** DFU_TARGET_DECOMPRESS_FLAG_* */
+	uint8_t flags;
+	/** Size of the header, the compressed data starts at this offset. */
+	uint16_t header_size;
+	/** Size of the image once decompressed. */
+	uint32_t image_size;
+} __packed;
+
+/**
+ * @brief Check if a buffer starts with a compressed image header.
+ *
+ * @param buf Buffer holding at least the first 4 bytes of the image.
+ *
+ * @return true if the buffer starts with the compressed image magic word.
+ */
+bool dfu_target_decompress_identify(const void *const buf);
+
+/**
+ * @brief Start decompressing an image into the DFU target stream.
+ *
+ * The DFU target stream must be initialized before writing any data.
+ *
+ * @param file_size Size of the compressed file, header included.
+ * @param max_image_size Largest decompressed image that fits the target.
+ *
+ * @return 0 on success, negative errno code otherwise.
+ */
+int dfu_target_decompress_start(size_t file_size, size_t max_image_size);
+
+/**
+ * @brief Decompress a fragment of the compressed file into the DFU target stream.
+ *
+ * @param buf Fragment of the compressed file.
+ * @param len Length of the fragment.
+ *
+ * @return 0 on success, negative errno code otherwise.
+ */
+int dfu_target_decompress_write(const uint8_t *buf, size_t len);
+
+/**
+ * @brief Get the number of compressed bytes written so far, header included.
+ *
+ * @return Offset into the compressed file.
+ */
+size_t dfu_target_decompress_offset(void);
+
+/**
+ * @brief Finish decompressing the image.
+ *
+ * @param successful Whether the whole file has been received.
+ *
+ * @return 0 on success, -EINVAL if the image did not decompress to the size
+ *	   announced in the header, negative errno code otherwise.
+ */
+int dfu_target_decompress_done(bool successful);
+
+/**
+ * @brief Drop any decompression state, the next image is taken as uncompressed
+ *	  until dfu_target_decompress_start is called again.
+ */
+void dfu_target_decompress_reset(void);
+
+/**
+ * @brief Check if an image is being decompressed.
+ *
+ * @return true between dfu_target_decompress_start and dfu_target_decompress_done.
+ */
+bool dfu_target_decompress_active(void);
+
+#endif /* DFU_TARGET_DECOMPRESS_H__ */
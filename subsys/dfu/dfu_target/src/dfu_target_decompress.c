@@ -0,0 +1,433 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <nrf_compress/implementation.h>
+#include <dfu/dfu_target_stream.h>
+#include <dfu_target_decompress.h>
+
+LOG_MODULE_REGISTER(dfu_target_decompress, CONFIG_DFU_TARGET_LOG_LEVEL);
+
+#define CHUNK_SIZE CONFIG_NRF_COMPRESS_CHUNK_SIZE
+
+/* The ARM thumb filter needs 4 bytes to tell if a position holds a BL instruction */
+#define THUMB_INSN_SIZE 4
+
+static struct nrf_compress_implementation *lzma;
+static struct nrf_compress_implementation *thumb;
+
+static bool active;
+static bool complete;
+static size_t file_size;
+static size_t max_image_size;
+
+/* The header is collected here in case it is split across writes */
+static uint8_t hdr_buf[sizeof(struct dfu_target_decompress_header)];
+static size_t hdr_size;
+static size_t hdr_bytes;
+static uint8_t hdr_flags;
+
+static size_t payload_size;
+static size_t payload_bytes;
+static size_t image_size;
+static size_t image_bytes;
+
+/* Compressed input not yet consumed by the decompressor */
+static uint8_t in_buf[CHUNK_SIZE];
+static size_t in_len;
+
+#ifdef CONFIG_NRF_COMPRESS_ARM_THUMB
+/* Decompressed data waiting for the ARM thumb filter */
+static uint8_t thumb_buf[CHUNK_SIZE];
+static size_t thumb_len;
+#endif
+
+bool dfu_target_decompress_identify(const void *const buf)
+{
+	return sys_get_le32(buf) == DFU_TARGET_DECOMPRESS_MAGIC;
+}
+
+static int output_write(const uint8_t *buf, size_t len)
+{
+	int err;
+
+	if (len > image_size - image_bytes) {
+		LOG_ERR("Image decompresses to more than %zu bytes", image_size);
+		return -EFBIG;
+	}
+
+	err = dfu_target_stream_write(buf, len);
+	if (err != 0) {
+		return err;
+	}
+
+	image_bytes += len;
+
+	return 0;
+}
+
+#ifdef CONFIG_NRF_COMPRESS_ARM_THUMB
+/* Length of the longest prefix of buf that the ARM thumb filter can process
+ * on its own. The filter steps 2 bytes at a time, or 4 after converting a BL
+ * instruction, and needs 4 bytes at each step. Ending the chunk where the
+ * filter would step to keeps a BL instruction from being split across two
+ * chunks; the remaining bytes, at most 3, are carried over to the next chunk.
+ */
+static size_t thumb_boundary(const uint8_t *buf, size_t len)
+{
+	size_t i = 0;
+
+	while ((i + THUMB_INSN_SIZE) <= len) {
+		if ((buf[i + 1] & 0xF8) == 0xF0 && (buf[i + 3] & 0xF8) == 0xF8) {
+			i += 4;
+		} else {
+			i += 2;
+		}
+	}
+
+	return i;
+}
+
+static int thumb_flush(size_t len)
+{
+	int err;
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+
+	if (len == 0) {
+		return 0;
+	}
+
+	err = thumb->decompress(NULL, thumb_buf, len, false, &offset, &output, &output_size);
+	if (err != 0) {
+		LOG_ERR("ARM thumb filter failed: %d", err);
+		return err;
+	}
+
+	err = output_write(output, output_size);
+	if (err != 0) {
+		return err;
+	}
+
+	thumb_len -= offset;
+	memmove(thumb_buf, &thumb_buf[offset], thumb_len);
+
+	return 0;
+}
+#endif /* CONFIG_NRF_COMPRESS_ARM_THUMB */
+
+static int filter_write(const uint8_t *buf, size_t len)
+{
+#ifdef CONFIG_NRF_COMPRESS_ARM_THUMB
+	int err;
+	size_t copy;
+
+	if (!(hdr_flags & DFU_TARGET_DECOMPRESS_FLAG_ARM_THUMB)) {
+		return output_write(buf, len);
+	}
+
+	while (len > 0) {
+		copy = MIN(len, sizeof(thumb_buf) - thumb_len);
+		memcpy(&thumb_buf[thumb_len], buf, copy);
+		thumb_len += copy;
+		buf += copy;
+		len -= copy;
+
+		if (thumb_len < sizeof(thumb_buf)) {
+			break;
+		}
+
+		err = thumb_flush(thumb_boundary(thumb_buf, thumb_len));
+		if (err != 0) {
+			return err;
+		}
+	}
+
+	return 0;
+#else
+	return output_write(buf, len);
+#endif
+}
+
+static int filter_finish(void)
+{
+#ifdef CONFIG_NRF_COMPRESS_ARM_THUMB
+	if (hdr_flags & DFU_TARGET_DECOMPRESS_FLAG_ARM_THUMB) {
+		return thumb_flush(thumb_len);
+	}
+#endif
+
+	return 0;
+}
+
+/* Run the decompressor on the buffered input, keeping what it did not consume. On the last
+ * part the decompressor is called until all input is consumed so that the end of the
+ * dictionary is returned.
+ */
+static int lzma_feed(bool last)
+{
+	int err;
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+
+	do {
+		err = lzma->decompress(NULL, in_buf, in_len, last, &offset, &output,
+				       &output_size);
+		if (err != 0) {
+			LOG_ERR("Decompression failed: %d", err);
+			return err;
+		}
+
+		if (offset == 0 && output_size == 0) {
+			LOG_ERR("Decompression stalled with %zu bytes of input", in_len);
+			return -EINVAL;
+		}
+
+		if (output_size > 0) {
+			err = filter_write(output, output_size);
+			if (err != 0) {
+				return err;
+			}
+		}
+
+		in_len -= MIN(offset, in_len);
+		memmove(in_buf, &in_buf[offset], in_len);
+	} while (last && in_len > 0);
+
+	return 0;
+}
+
+static int payload_write(const uint8_t *buf, size_t len)
+{
+	int err;
+	size_t needed;
+	size_t copy;
+	bool last;
+
+	if (len > payload_size - payload_bytes) {
+		LOG_ERR("Write past the end of the compressed file");
+		return -EFBIG;
+	}
+
+	while (len > 0) {
+		needed = MIN(lzma->decompress_bytes_needed(NULL), sizeof(in_buf));
+		copy = MIN(len, needed - MIN(in_len, needed));
+
+		memcpy(&in_buf[in_len], buf, copy);
+		in_len += copy;
+		buf += copy;
+		len -= copy;
+		payload_bytes += copy;
+
+		last = (payload_bytes == payload_size);
+
+		if (in_len < needed && !last) {
+			break;
+		}
+
+		err = lzma_feed(last);
+		if (err != 0) {
+			return err;
+		}
+
+		if (last) {
+			err = filter_finish();
+			if (err != 0) {
+				return err;
+			}
+
+			if (image_bytes != image_size) {
+				LOG_ERR("Image decompressed to %zu bytes, expected %zu",
+					image_bytes, image_size);
+				return -EINVAL;
+			}
+
+			complete = true;
+		}
+	}
+
+	return 0;
+}
+
+static int header_parse(void)
+{
+	uint8_t version = hdr_buf[offsetof(struct dfu_target_decompress_header, version)];
+
+	hdr_flags = hdr_buf[offsetof(struct dfu_target_decompress_header, flags)];
+	hdr_size = sys_get_le16(&hdr_buf[offsetof(struct dfu_target_decompress_header,
+						  header_size)]);
+	image_size = sys_get_le32(&hdr_buf[offsetof(struct dfu_target_decompress_header,
+						    image_size)]);
+
+	if (version != DFU_TARGET_DECOMPRESS_VERSION || hdr_size < sizeof(hdr_buf)) {
+		LOG_ERR("Unsupported compressed image header, version %d size %zu", version,
+			hdr_size);
+		return -EINVAL;
+	}
+
+	if (hdr_flags & ~DFU_TARGET_DECOMPRESS_FLAG_ARM_THUMB) {
+		LOG_ERR("Unsupported compressed image flags 0x%02x", hdr_flags);
+		return -ENOTSUP;
+	}
+
+	if ((hdr_flags & DFU_TARGET_DECOMPRESS_FLAG_ARM_THUMB) && thumb == NULL) {
+		LOG_ERR("Image needs the ARM thumb filter, enable CONFIG_NRF_COMPRESS_ARM_THUMB");
+		return -ENOTSUP;
+	}
+
+	if (file_size <= hdr_size) {
+		LOG_ERR("Compressed file too small, %zu bytes", file_size);
+		return -EINVAL;
+	}
+
+	if (image_size > max_image_size) {
+		LOG_ERR("Decompressed image too big to fit in flash %zu > %zu", image_size,
+			max_image_size);
+		return -EFBIG;
+	}
+
+	payload_size = file_size - hdr_size;
+
+	LOG_INF("Decompressing %zu bytes into a %zu byte image", payload_size, image_size);
+
+	return 0;
+}
+
+int dfu_target_decompress_start(size_t size, size_t max_size)
+{
+	int err;
+
+	dfu_target_decompress_reset();
+
+	lzma = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZMA);
+	if (lzma == NULL) {
+		return -ENOTSUP;
+	}
+
+	thumb = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_ARM_THUMB);
+
+	err = lzma->init(NULL);
+	if (err != 0) {
+		LOG_ERR("Unable to initialize LZMA: %d", err);
+		return err;
+	}
+
+	if (thumb != NULL) {
+		err = thumb->init(NULL);
+		if (err != 0) {
+			LOG_ERR("Unable to initialize ARM thumb filter: %d", err);
+			(void)lzma->deinit(NULL);
+			return err;
+		}
+	}
+
+	file_size = size;
+	max_image_size = max_size;
+	active = true;
+
+	return 0;
+}
+
+int dfu_target_decompress_write(const uint8_t *buf, size_t len)
+{
+	int err;
+	size_t copy;
+
+	if (!active) {
+		return -EPERM;
+	}
+
+	if (complete && len > 0) {
+		LOG_ERR("Write past the end of the compressed file");
+		return -EFBIG;
+	}
+
+	/* The header, including any part of it this version does not know about */
+	while (len > 0 && (hdr_size == 0 || hdr_bytes < hdr_size)) {
+		if (hdr_bytes < sizeof(hdr_buf)) {
+			copy = MIN(len, sizeof(hdr_buf) - hdr_bytes);
+			memcpy(&hdr_buf[hdr_bytes], buf, copy);
+		} else {
+			copy = MIN(len, hdr_size - hdr_bytes);
+		}
+
+		hdr_bytes += copy;
+		buf += copy;
+		len -= copy;
+
+		if (hdr_size == 0 && hdr_bytes == sizeof(hdr_buf)) {
+			if (!dfu_target_decompress_identify(hdr_buf)) {
+				return -EINVAL;
+			}
+
+			err = header_parse();
+			if (err != 0) {
+				return err;
+			}
+		}
+	}
+
+	if (len == 0) {
+		return 0;
+	}
+
+	return payload_write(buf, len);
+}
+
+size_t dfu_target_decompress_offset(void)
+{
+	return hdr_bytes + payload_bytes;
+}
+
+int dfu_target_decompress_done(bool successful)
+{
+	int err = 0;
+
+	if (successful && !complete) {
+		LOG_ERR("Compressed file incomplete, %zu of %zu bytes",
+			dfu_target_decompress_offset(), file_size);
+		err = -EINVAL;
+	}
+
+	dfu_target_decompress_reset();
+
+	return err;
+}
+
+void dfu_target_decompress_reset(void)
+{
+	if (active) {
+		(void)lzma->deinit(NULL);
+
+		if (thumb != NULL) {
+			(void)thumb->deinit(NULL);
+		}
+	}
+
+	active = false;
+	complete = false;
+	hdr_size = 0;
+	hdr_bytes = 0;
+	hdr_flags = 0;
+	payload_size = 0;
+	payload_bytes = 0;
+	image_size = 0;
+	image_bytes = 0;
+	in_len = 0;
+#ifdef CONFIG_NRF_COMPRESS_ARM_THUMB
+	thumb_len = 0;
+#endif
+}
+
+bool dfu_target_decompress_active(void)
+{
+	return active;
+}
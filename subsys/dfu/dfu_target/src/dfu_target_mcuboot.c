@@ -24,6 +24,9 @@
 #include <dfu/dfu_target_stream.h>
 #include <zephyr/devicetree.h>
 #include <dfu_stream_flatten.h>
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DECOMPRESS
+#include <dfu_target_decompress.h>
+#endif
 
 LOG_MODULE_REGISTER(dfu_target_mcuboot, CONFIG_DFU_TARGET_LOG_LEVEL);
 
@@ -86,6 +89,10 @@ static const char *const target_id_name[] = {
 	LIST_DROP_EMPTY(LISTIFY(TARGET_IMAGE_COUNT, _STR_TARGET_NAME, (,)))
 };
 
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DECOMPRESS
+static size_t curr_file_size;
+#endif
+
 static uint8_t *stream_buf;
 static size_t stream_buf_len;
 static size_t stream_buf_bytes;
@@ -93,6 +100,12 @@ static uint8_t curr_sec_img;
 
 bool dfu_target_mcuboot_identify(const void *const buf)
 {
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DECOMPRESS
+	if (dfu_target_decompress_identify(buf)) {
+		return true;
+	}
+#endif
+
 	/* MCUBoot headers starts with 4 byte magic word */
 	return *((const uint32_t *)buf) == MCUBOOT_HEADER_MAGIC;
 }
@@ -113,6 +126,19 @@ int dfu_target_mcuboot_set_buf(uint8_t *buf, size_t len)
 	return 0;
 }
 
+static int stream_init(int img_num, bool no_save_progress)
+{
+	return dfu_target_stream_init(&(struct dfu_target_stream_init){
+		.id = target_id_name[img_num],
+		.fdev = secondary_dev[img_num],
+		.buf = stream_buf,
+		.len = stream_buf_len,
+		.offset = secondary_address[img_num],
+		.size = secondary_size[img_num],
+		.cb = NULL,
+		.no_save_progress = no_save_progress });
+}
+
 int dfu_target_mcuboot_init(size_t file_size, int img_num, dfu_target_callback_t cb)
 {
 	ARG_UNUSED(cb);
@@ -120,6 +146,10 @@ int dfu_target_mcuboot_init(size_t file_size, int img_num, dfu_target_callback_t
 	int err;
 
 	stream_buf_bytes = 0;
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DECOMPRESS
+	dfu_target_decompress_reset();
+	curr_file_size = file_size;
+#endif
 
 	if (stream_buf == NULL) {
 		LOG_ERR("Missing stream_buf, call '..set_buf' before '..init");
@@ -139,14 +169,7 @@ int dfu_target_mcuboot_init(size_t file_size, int img_num, dfu_target_callback_t
 		return -EFAULT;
 	}
 
-	err = dfu_target_stream_init(&(struct dfu_target_stream_init){
-		.id = target_id_name[img_num],
-		.fdev = flash_dev,
-		.buf = stream_buf,
-		.len = stream_buf_len,
-		.offset = secondary_address[img_num],
-		.size = secondary_size[img_num],
-		.cb = NULL });
+	err = stream_init(img_num, false);
 	if (err < 0) {
 		LOG_ERR("dfu_target_stream_init failed %d", err);
 		return err;
@@ -160,6 +183,13 @@ int dfu_target_mcuboot_offset_get(size_t *out)
 {
 	int err = 0;
 
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DECOMPRESS
+	if (dfu_target_decompress_active()) {
+		*out = dfu_target_decompress_offset();
+		return 0;
+	}
+#endif
+
 	err = dfu_target_stream_offset_get(out);
 	if (err == 0) {
 		*out += stream_buf_bytes;
@@ -168,8 +198,52 @@ int dfu_target_mcuboot_offset_get(size_t *out)
 	return err;
 }
 
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DECOMPRESS
+/* Restart the stream from scratch, without saving its progress. The stream
+ * offset then counts decompressed bytes, which can not be used to resume the
+ * download, and the decompressor state can not be restored anyway.
+ */
+static int decompress_start(void)
+{
+	int err;
+
+	err = dfu_target_stream_reset();
+	if (err != 0) {
+		return err;
+	}
+
+	err = stream_init(curr_sec_img, true);
+	if (err != 0) {
+		return err;
+	}
+
+	return dfu_target_decompress_start(curr_file_size, secondary_size[curr_sec_img]);
+}
+#endif
+
 int dfu_target_mcuboot_write(const void *const buf, size_t len)
 {
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DECOMPRESS
+	int err;
+	size_t offset;
+
+	if (!dfu_target_decompress_active() && len >= sizeof(uint32_t) &&
+	    dfu_target_decompress_identify(buf)) {
+		err = dfu_target_mcuboot_offset_get(&offset);
+		if (err == 0 && offset == 0) {
+			err = decompress_start();
+			if (err != 0) {
+				LOG_ERR("Unable to start decompression: %d", err);
+				return err;
+			}
+		}
+	}
+
+	if (dfu_target_decompress_active()) {
+		return dfu_target_decompress_write(buf, len);
+	}
+#endif
+
 	stream_buf_bytes = (stream_buf_bytes + len) % stream_buf_len;
 
 	return dfu_target_stream_write(buf, len);
@@ -179,6 +253,16 @@ int dfu_target_mcuboot_done(bool successful)
 {
 	int err = 0;
 
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DECOMPRESS
+	if (dfu_target_decompress_active()) {
+		err = dfu_target_decompress_done(successful);
+		if (err != 0) {
+			(void)dfu_target_stream_done(false);
+			return err;
+		}
+	}
+#endif
+
 	err = dfu_target_stream_done(successful);
 	if (err != 0) {
 		LOG_ERR("dfu_target_stream_done error %d", err);
@@ -237,5 +321,8 @@ int dfu_target_mcuboot_schedule_update(int img_num)
 int dfu_target_mcuboot_reset(void)
 {
 	stream_buf_bytes = 0;
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DECOMPRESS
+	dfu_target_decompress_reset();
+#endif
 	return dfu_target_stream_reset();
 }
@@ -15,6 +15,7 @@
 #define MODULE "dfu"
 #define DFU_STREAM_OFFSET "stream/offset"
 #include <zephyr/settings/settings.h>
+#include <zephyr/sys/crc.h>
 #endif /* CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS */
 
 LOG_MODULE_REGISTER(dfu_target_stream, CONFIG_DFU_TARGET_LOG_LEVEL);
@@ -25,6 +26,23 @@ static const char *current_id;
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
 
 static char current_name_key[32];
+/* Whether the progress of the current stream is stored to settings */
+static bool save_progress;
+
+/* Progress as stored to settings. Progress stored by older versions only
+ * holds the number of bytes written.
+ */
+struct stream_progress {
+	size_t bytes_written;
+	/* CRC32 of the bytes written to flash */
+	uint32_t crc;
+};
+
+/* CRC32 of the bytes written to flash so far */
+static uint32_t stream_crc;
+/* Whether the restored progress came with a CRC */
+static bool stream_crc_restored;
+static stream_flash_callback_t user_cb;
 
 /**
  * @brief Store the information stored in the stream_flash instance so that it
@@ -33,10 +51,16 @@ static char current_name_key[32];
 static int store_progress(void)
 {
 	int err;
-	size_t bytes_written = stream_flash_bytes_written(&stream);
+	struct stream_progress progress = {
+		.bytes_written = stream_flash_bytes_written(&stream),
+		.crc = stream_crc,
+	};
 
-	err = settings_save_one(current_name_key, &bytes_written,
-				sizeof(bytes_written));
+	if (!save_progress) {
+		return 0;
+	}
+
+	err = settings_save_one(current_name_key, &progress, sizeof(progress));
 
 	if (err) {
 		LOG_ERR("Problem storing offset (err %d)", err);
@@ -54,18 +78,23 @@ static int store_progress(void)
 static int settings_set(const char *key, size_t len_rd,
 			settings_read_cb read_cb, void *cb_arg)
 {
-	if (current_id && !strcmp(key, current_id)) {
+	if (save_progress && current_id && !strcmp(key, current_id)) {
 		int err;
 		off_t absolute_offset;
 		struct flash_pages_info page;
-		ssize_t len = read_cb(cb_arg, &stream.bytes_written,
-				      sizeof(stream.bytes_written));
+		struct stream_progress progress;
+		ssize_t len = read_cb(cb_arg, &progress, sizeof(progress));
 
-		if (len != sizeof(stream.bytes_written)) {
+		if (len == sizeof(progress)) {
+			stream_crc = progress.crc;
+			stream_crc_restored = true;
+		} else if (len != sizeof(progress.bytes_written)) {
 			LOG_ERR("Can't read stream.bytes_written from storage");
 			return len;
 		}
 
+		stream.bytes_written = progress.bytes_written;
+
 		/* Zero bytes written - set last erased page to its default. */
 		if (stream.bytes_written == 0) {
 			stream.last_erased_page_start_offset = -1;
@@ -90,6 +119,59 @@ static int settings_set(const char *key, size_t len_rd,
 
 	return 0;
 }
+
+/**
+ * @brief Keep the CRC of the data written to flash up to date. The data is read
+ *	  back from flash by stream_flash before this is called.
+ */
+static int stream_flash_cb(uint8_t *buf, size_t len, size_t offset)
+{
+	stream_crc = crc32_ieee_update(stream_crc, buf, len);
+
+	if (user_cb) {
+		return user_cb(buf, len, offset);
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Check the data already in flash against the restored progress, so that
+ *	  a download is not resumed on top of data that did not make it to flash.
+ *	  The progress is discarded if the data does not match.
+ */
+static int progress_verify(uint8_t *buf, size_t buf_len)
+{
+	int err;
+	size_t off = 0;
+	size_t len;
+	uint32_t crc = 0;
+
+	while (off < stream.bytes_written) {
+		len = MIN(buf_len, stream.bytes_written - off);
+
+		err = flash_read(stream.fdev, stream.offset + off, buf, len);
+		if (err) {
+			LOG_ERR("flash_read failed (err %d)", err);
+			return err;
+		}
+
+		crc = crc32_ieee_update(crc, buf, len);
+		off += len;
+	}
+
+	if (stream_crc_restored && crc != stream_crc) {
+		LOG_WRN("Stored data does not match progress, restarting from offset 0");
+		stream.bytes_written = 0;
+		stream.last_erased_page_start_offset = -1;
+		crc = 0;
+	}
+
+	/* Progress stored without a CRC is trusted, carry on with the CRC of the data */
+	stream_crc = crc;
+
+	return 0;
+}
 #endif /* CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS */
 
 struct stream_flash_ctx *dfu_target_stream_get_stream(void)
@@ -112,14 +194,28 @@ int dfu_target_stream_init(const struct dfu_target_stream_init *init)
 
 	current_id = init->id;
 
+#ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
+	stream_crc = 0;
+	stream_crc_restored = false;
+	save_progress = !init->no_save_progress;
+	user_cb = init->cb;
+
+	err = stream_flash_init(&stream, init->fdev, init->buf, init->len,
+				init->offset, init->size, stream_flash_cb);
+#else
 	err = stream_flash_init(&stream, init->fdev, init->buf, init->len,
-				init->offset, init->size, NULL);
+				init->offset, init->size, init->cb);
+#endif /* CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS */
 	if (err) {
 		LOG_ERR("stream_flash_init failed (err %d)", err);
 		return err;
 	}
 
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
+	if (!save_progress) {
+		return 0;
+	}
+
 	err = snprintf(current_name_key, sizeof(current_name_key), "%s/%s",
 		       MODULE, current_id);
 	if (err < 0 || err >= sizeof(current_name_key)) {
@@ -150,6 +246,12 @@ int dfu_target_stream_init(const struct dfu_target_stream_init *init)
 		LOG_ERR("settings_load failed (err %d)", err);
 		return err;
 	}
+
+	/* The buffer is empty until the first write, use it to read back the flash */
+	err = progress_verify(init->buf, init->len);
+	if (err) {
+		return err;
+	}
 #endif /* CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS */
 
 	return 0;
@@ -197,9 +299,11 @@ int dfu_target_stream_done(bool successful)
 		/* Delete state so that a new call to 'init' will
 		 * start with offset 0.
 		 */
-		err = settings_delete(current_name_key);
-		if (err != 0) {
-			LOG_ERR("setting_delete error %d", err);
+		if (save_progress) {
+			err = settings_delete(current_name_key);
+			if (err != 0) {
+				LOG_ERR("setting_delete error %d", err);
+			}
 		}
 
 	} else {
@@ -226,9 +330,13 @@ int dfu_target_stream_reset(void)
 	stream.bytes_written = 0;
 
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
-	err = settings_delete(current_name_key);
-	if (err != 0) {
-		LOG_ERR("settings_delete error %d", err);
+	stream_crc = 0;
+
+	if (save_progress) {
+		err = settings_delete(current_name_key);
+		if (err != 0) {
+			LOG_ERR("settings_delete error %d", err);
+		}
 	}
 #endif
 
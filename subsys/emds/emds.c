@@ -67,6 +67,18 @@ static int emds_fs_init(void)
 }
 
 
+static uint32_t emds_entry_size(size_t len)
+{
+	size_t block_size = emds_flash.flash_params->write_block_size;
+
+	if (IS_ENABLED(CONFIG_EMDS_BATCHED_WRITE)) {
+		return EMDS_FLASH_RECORD_HDR_SIZE + len;
+	}
+
+	return DIV_ROUND_UP(len, block_size) * block_size +
+	       DIV_ROUND_UP(emds_flash.ate_size, block_size) * block_size;
+}
+
 static int emds_entries_size(uint32_t *size)
 {
 	size_t block_size = emds_flash.flash_params->write_block_size;
@@ -75,22 +87,35 @@ static int emds_entries_size(uint32_t *size)
 	*size = 0;
 
 	STRUCT_SECTION_FOREACH(emds_entry, ch) {
-		*size += DIV_ROUND_UP(ch->len, block_size) * block_size;
-		*size += DIV_ROUND_UP(emds_flash.ate_size, block_size) * block_size;
+		*size += emds_entry_size(ch->len);
 		entries++;
 	}
 
 	struct emds_dynamic_entry *ch;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
-		*size += DIV_ROUND_UP(ch->entry.len, block_size) * block_size;
-		*size += DIV_ROUND_UP(emds_flash.ate_size, block_size) * block_size;
+		*size += emds_entry_size(ch->entry.len);
 		entries++;
 	}
 
+	if (IS_ENABLED(CONFIG_EMDS_BATCHED_WRITE)) {
+		/* All entries share one allocation table entry */
+		*size = DIV_ROUND_UP(*size, block_size) * block_size +
+			DIV_ROUND_UP(emds_flash.ate_size, block_size) * block_size;
+	}
+
 	return entries;
 }
 
+static ssize_t emds_entry_write(uint16_t id, const void *data, size_t len)
+{
+	if (IS_ENABLED(CONFIG_EMDS_BATCHED_WRITE)) {
+		return emds_flash_record_write(&emds_flash, id, data, len);
+	}
+
+	return emds_flash_write(&emds_flash, id, data, len);
+}
+
 int emds_init(emds_store_cb_t cb)
 {
 	int rc;
@@ -152,8 +177,7 @@ int emds_store(void)
 	LOG_DBG("Emergency Data Storeage released");
 
 	STRUCT_SECTION_FOREACH(emds_entry, ch) {
-		ssize_t len = emds_flash_write(&emds_flash,
-					       ch->id, ch->data, ch->len);
+		ssize_t len = emds_entry_write(ch->id, ch->data, ch->len);
 		if (len < 0) {
 			LOG_ERR("Write static entry: (%d) error (%d)",
 				ch->id, len);
@@ -166,8 +190,7 @@ int emds_store(void)
 	struct emds_dynamic_entry *ch;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
-		ssize_t len = emds_flash_write(&emds_flash,
-					       ch->entry.id, ch->entry.data, ch->entry.len);
+		ssize_t len = emds_entry_write(ch->entry.id, ch->entry.data, ch->entry.len);
 		if (len < 0) {
 			LOG_ERR("Write dynamic entry: (%d) error (%d).",
 				ch->entry.id, len);
@@ -178,6 +201,14 @@ int emds_store(void)
 		}
 	}
 
+	if (IS_ENABLED(CONFIG_EMDS_BATCHED_WRITE)) {
+		int rc = emds_flash_record_end(&emds_flash);
+
+		if (rc) {
+			LOG_ERR("Write record: error (%d)", rc);
+		}
+	}
+
 	emds_ready = false;
 
 	/* Unlock all interrupts */
@@ -257,6 +288,13 @@ int emds_prepare(void)
 		return rc;
 	}
 
+	if (IS_ENABLED(CONFIG_EMDS_BATCHED_WRITE)) {
+		rc = emds_flash_record_prepare(&emds_flash, size);
+		if (rc) {
+			return rc;
+		}
+	}
+
 	emds_ready = true;
 
 	return 0;
@@ -267,6 +305,16 @@ uint32_t emds_store_time_get(void)
 	size_t block_size = emds_flash.flash_params->write_block_size;
 	uint32_t store_time_us = CONFIG_EMDS_FLASH_TIME_BASE_OVERHEAD_US;
 
+	if (IS_ENABLED(CONFIG_EMDS_BATCHED_WRITE)) {
+		uint32_t size;
+
+		/* The record is written in one go, with only one allocation table entry */
+		(void)emds_entries_size(&size);
+
+		return store_time_us +
+		       DIV_ROUND_UP(size, block_size) * CONFIG_EMDS_FLASH_TIME_WRITE_ONE_WORD_US +
+		       CONFIG_EMDS_FLASH_TIME_ENTRY_OVERHEAD_US;
+	}
 
 	STRUCT_SECTION_FOREACH(emds_entry, ch) {
 		store_time_us += DIV_ROUND_UP(ch->len, block_size) *
@@ -50,6 +50,19 @@ enum ate_type {
 BUILD_ASSERT(offsetof(struct emds_ate, crc8) == sizeof(struct emds_ate) - sizeof(uint8_t),
 	     "crc8 must be the last member");
 
+/* Header in front of each entry in a record */
+struct emds_record_hdr {
+	uint16_t id; /* data id */
+	uint16_t len; /* data len */
+} __packed;
+
+BUILD_ASSERT(sizeof(struct emds_record_hdr) == EMDS_FLASH_RECORD_HDR_SIZE);
+
+/* Start of the last write block of the record being written, which is written when it is full
+ * or when the record ends.
+ */
+static uint8_t record_buf[EMDS_FLASH_BLOCK_SIZE];
+
 #define SOC_NV_FLASH_NODE DT_INST(0, soc_nv_flash)
 
 #if NRF52_ERRATA_242_PRESENT
@@ -336,6 +349,120 @@ static int entry_wrt(struct emds_fs *fs, uint16_t id, const void *data, size_t l
 	return 0;
 }
 
+static int record_data_wrt(struct emds_fs *fs, const void *data, size_t len)
+{
+	const uint8_t *data8 = (const uint8_t *)data;
+	size_t block_size = fs->flash_params->write_block_size;
+	size_t buf_len = fs->record_len & (block_size - 1U);
+	off_t offset = fs->offset + fs->record_offset + fs->record_len - buf_len;
+	size_t blen;
+	int rc;
+
+	fs->record_crc8 = crc8_ccitt(fs->record_crc8, data, len);
+	fs->record_len += len;
+
+	if (buf_len) {
+		blen = MIN(len, block_size - buf_len);
+		(void)memcpy(&record_buf[buf_len], data8, blen);
+
+		buf_len += blen;
+		data8 += blen;
+		len -= blen;
+
+		if (buf_len < block_size) {
+			return 0;
+		}
+
+		rc = flash_direct_write(fs->flash_dev, offset, record_buf, block_size);
+		if (rc) {
+			return rc;
+		}
+
+		offset += block_size;
+	}
+
+	blen = len & ~(block_size - 1U);
+	if (blen > 0) {
+		rc = flash_direct_write(fs->flash_dev, offset, data8, blen);
+		if (rc) {
+			return rc;
+		}
+
+		data8 += blen;
+		len -= blen;
+	}
+
+	(void)memcpy(record_buf, data8, len);
+	return 0;
+}
+
+static int record_crc_check(struct emds_fs *fs, const struct emds_ate *entry)
+{
+	uint8_t buf[32];
+	uint8_t crc8 = 0xff;
+	uint32_t addr = fs->offset + entry->offset;
+	size_t len = entry->len;
+	size_t bytes_to_read;
+	int rc;
+
+	while (len) {
+		bytes_to_read = MIN(sizeof(buf), len);
+		rc = flash_read(fs->flash_dev, addr, buf, bytes_to_read);
+		if (rc) {
+			return rc;
+		}
+
+		crc8 = crc8_ccitt(crc8, buf, bytes_to_read);
+		len -= bytes_to_read;
+		addr += bytes_to_read;
+	}
+
+	return (crc8 == entry->crc8_data) ? 0 : -EFAULT;
+}
+
+static ssize_t record_read(struct emds_fs *fs, const struct emds_ate *entry, uint16_t id,
+			   void *data, size_t len)
+{
+	uint32_t addr = fs->offset + entry->offset;
+	uint32_t end = addr + entry->len;
+	struct emds_record_hdr hdr;
+	int rc;
+
+	rc = record_crc_check(fs, entry);
+	if (rc) {
+		return rc;
+	}
+
+	while (end - addr >= sizeof(hdr)) {
+		rc = flash_read(fs->flash_dev, addr, &hdr, sizeof(hdr));
+		if (rc) {
+			return rc;
+		}
+
+		addr += sizeof(hdr);
+		if (hdr.len > end - addr) {
+			return -EFAULT;
+		}
+
+		if (hdr.id == id) {
+			if (len < hdr.len) {
+				return -ENOMEM;
+			}
+
+			rc = flash_read(fs->flash_dev, addr, data, hdr.len);
+			if (rc) {
+				return rc;
+			}
+
+			return hdr.len;
+		}
+
+		addr += hdr.len;
+	}
+
+	return -ENXIO;
+}
+
 static enum ate_type ate_check(struct emds_fs *fs, uint32_t addr, struct emds_ate *entry)
 {
 	uint8_t read_buf[fs->ate_size];
@@ -534,6 +661,98 @@ ssize_t emds_flash_write(struct emds_fs *fs, uint16_t id, const void *data, size
 	return len;
 }
 
+int emds_flash_record_prepare(struct emds_fs *fs, size_t byte_size)
+{
+	if (!fs->is_initialized || !fs->is_prepeared) {
+		LOG_ERR("EMDS flash not initialized or not ready for write");
+		return -EACCES;
+	}
+
+	if (byte_size < fs->ate_size) {
+		return -EINVAL;
+	}
+
+	if (byte_size > emds_flash_free_space_get(fs)) {
+		return -ENOMEM;
+	}
+
+	fs->record_offset = fs->data_wra_offset;
+	fs->record_size = byte_size - fs->ate_size;
+	fs->record_len = 0;
+	fs->record_crc8 = 0xff;
+	return 0;
+}
+
+ssize_t emds_flash_record_write(struct emds_fs *fs, uint16_t id, const void *data, size_t len)
+{
+	struct emds_record_hdr hdr = {
+		.id = id,
+		.len = len,
+	};
+	int rc;
+
+	if (!fs->is_initialized || !fs->is_prepeared) {
+		LOG_ERR("EMDS flash not initialized or not ready for write");
+		return -EACCES;
+	}
+
+	if (sizeof(hdr) + len > fs->record_size - fs->record_len) {
+		return -ENOMEM;
+	}
+
+	rc = record_data_wrt(fs, &hdr, sizeof(hdr));
+	if (rc) {
+		return rc;
+	}
+
+	rc = record_data_wrt(fs, data, len);
+	if (rc) {
+		return rc;
+	}
+
+	return len;
+}
+
+int emds_flash_record_end(struct emds_fs *fs)
+{
+	size_t block_size = fs->flash_params->write_block_size;
+	size_t buf_len = fs->record_len & (block_size - 1U);
+	struct emds_ate entry;
+	int rc;
+
+	if (!fs->is_initialized || !fs->is_prepeared) {
+		LOG_ERR("EMDS flash not initialized or not ready for write");
+		return -EACCES;
+	}
+
+	if (!fs->record_len) {
+		return 0;
+	}
+
+	if (buf_len) {
+		(void)memset(&record_buf[buf_len], fs->flash_params->erase_value,
+			     block_size - buf_len);
+		rc = flash_direct_write(fs->flash_dev,
+					fs->offset + fs->record_offset + fs->record_len - buf_len,
+					record_buf, block_size);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	entry.id = EMDS_FLASH_RECORD_ID;
+	entry.offset = fs->record_offset;
+	entry.len = fs->record_len;
+	entry.crc8_data = fs->record_crc8;
+	entry.crc8 = crc8_ccitt(0xff, &entry, offsetof(struct emds_ate, crc8));
+
+	fs->data_wra_offset = fs->record_offset + align_size(fs, fs->record_len);
+	fs->record_size = 0;
+	fs->record_len = 0;
+
+	return ate_wrt(fs, &entry);
+}
+
 ssize_t emds_flash_read(struct emds_fs *fs, uint16_t id, void *data, size_t len)
 {
 	if (!fs->is_initialized) {
@@ -551,8 +770,15 @@ ssize_t emds_flash_read(struct emds_fs *fs, uint16_t id, void *data, size_t len)
 			return rc;
 		}
 
-		if ((wlk_ate.id == id) && (is_ate_valid(&wlk_ate))) {
-			break;
+		if (is_ate_valid(&wlk_ate)) {
+			if (wlk_ate.id == EMDS_FLASH_RECORD_ID) {
+				rc = record_read(fs, &wlk_ate, id, data, len);
+				if (rc != -ENXIO) {
+					return rc;
+				}
+			} else if (wlk_ate.id == id) {
+				break;
+			}
 		}
 
 		wlk_addr += fs->ate_size;
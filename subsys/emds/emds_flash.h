@@ -31,6 +31,10 @@ extern "C" {
  * @param flash_dev Pointer to flash device runtime structure
  * @param flash_params Pointer to flash memory parameters structure
  * @param force_erase Force erase flag
+ * @param record_offset Data offset of the record being written
+ * @param record_size Space reserved for the record being written
+ * @param record_len Number of bytes added to the record being written
+ * @param record_crc8 crc8 of the bytes added to the record being written
  */
 struct emds_fs {
 	off_t offset;
@@ -45,8 +49,18 @@ struct emds_fs {
 	const struct device *flash_dev;
 	const struct flash_parameters *flash_params;
 	bool force_erase;
+	uint16_t record_offset;
+	uint16_t record_size;
+	uint16_t record_len;
+	uint8_t record_crc8;
 };
 
+/** Entry ID of records written with @ref emds_flash_record_write. */
+#define EMDS_FLASH_RECORD_ID 0xFFFF
+
+/** Size of the header in front of each entry in a record. */
+#define EMDS_FLASH_RECORD_HDR_SIZE 4
+
 /**
  * @brief Initialize emergency data storage flash.
  *
@@ -82,10 +96,54 @@ int emds_flash_clear(struct emds_fs *fs);
  */
 ssize_t emds_flash_write(struct emds_fs *fs, uint16_t id, const void *data, size_t len);
 
+/**
+ * @brief Prepare a record for the next write events.
+ *
+ * A record holds several entries after each other, followed by a single allocation table
+ * entry. This takes less time to write than writing each entry with
+ * @ref emds_flash_write. The record starts at the current write position, so this should be
+ * called after @ref emds_flash_prepare. The entries are added with
+ * @ref emds_flash_record_write, and the record is completed with @ref emds_flash_record_end.
+ *
+ * @param fs Pointer to file system
+ * @param byte_size Total number of bytes of the record, including the allocation table entry
+ * and a header of @ref EMDS_FLASH_RECORD_HDR_SIZE bytes for each entry
+ *
+ * @retval 0 on success or negative error code
+ */
+int emds_flash_record_prepare(struct emds_fs *fs, size_t byte_size);
+
+/**
+ * @brief Add an entry to the record being written.
+ *
+ * The entry can't be read before the record is completed with @ref emds_flash_record_end.
+ *
+ * @param fs Pointer to file system
+ * @param id Id of the entry to be written
+ * @param data Pointer to the data to be written
+ * @param len Number of bytes to be written
+ *
+ * @return Number of bytes written. On success, it will be equal to the number of bytes requested
+ * to be written. On error, returns negative value of errno.h defined error codes.
+ */
+ssize_t emds_flash_record_write(struct emds_fs *fs, uint16_t id, const void *data, size_t len);
+
+/**
+ * @brief Complete the record being written.
+ *
+ * Writes the allocation table entry of the record, which makes its entries readable.
+ *
+ * @param fs Pointer to file system
+ *
+ * @retval 0 on success or negative error code
+ */
+int emds_flash_record_end(struct emds_fs *fs);
+
 /**
  * @brief Read an entry from the EMDS file system.
  *
- * Read an entry from the file system.
+ * Read an entry from the file system. Entries written with @ref emds_flash_write and entries
+ * in records are both found.
  *
  * @param fs Pointer to file system
  * @param id Id of the entry to be read
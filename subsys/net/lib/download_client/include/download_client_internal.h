@@ -15,6 +15,7 @@ int url_parse_host(const char *url, char *host, size_t len);
 int url_parse_file(const char *url, char *file, size_t len);
 int http_parse(struct download_client *client, size_t len);
 int http_get_request_send(struct download_client *client);
+int http_pipeline_continue(struct download_client *client, size_t frag_len);
 
 int coap_block_init(struct download_client *client, size_t from);
 int coap_get_recv_timeout(struct download_client *dl);
@@ -22,6 +23,6 @@ int coap_initiate_retransmission(struct download_client *dl);
 int coap_parse(struct download_client *client, size_t len);
 int coap_request_send(struct download_client *client);
 
-int socket_send(const struct download_client *client, size_t len, int timeout);
+int socket_send(const struct download_client *client, size_t off, size_t len, int timeout);
 
 #endif /* DOWNLOAD_CLIENT_INTERNAL_H */
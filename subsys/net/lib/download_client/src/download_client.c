@@ -465,11 +465,10 @@ cleanup:
 	return err;
 }
 
-int socket_send(const struct download_client *client, size_t len, int timeout)
+int socket_send(const struct download_client *client, size_t off, size_t len, int timeout)
 {
 	int err;
 	int sent;
-	size_t off = 0;
 
 	err = set_snd_socket_timeout(client->fd, timeout);
 	if (err) {
@@ -687,6 +686,7 @@ static int handle_socket_error(struct download_client *dl, ssize_t len)
 static int handle_received(struct download_client *dl, ssize_t len)
 {
 	int rc;
+	size_t frag_len;
 
 	LOG_DBG("Read %d bytes from socket", len);
 
@@ -725,6 +725,8 @@ static int handle_received(struct download_client *dl, ssize_t len)
 		LOG_INF("Downloaded %u bytes", dl->progress);
 	}
 
+	frag_len = dl->offset;
+
 	/* Send fragment to application.
 	 * If the application callback returns non-zero, stop.
 	 */
@@ -758,6 +760,9 @@ static int handle_received(struct download_client *dl, ssize_t len)
 			error_evt_send(dl, EHOSTDOWN);
 			rc = -1;
 		}
+	} else if (rc == 0 && dl->http.in_flight > 0) {
+		/* Pipelined responses are on their way, keep on receiving */
+		rc = http_pipeline_continue(dl, frag_len);
 	}
 	return rc;
 }
@@ -857,6 +862,19 @@ void download_thread(void *client, void *a, void *b)
 				break;
 			}
 
+			if (dl->http.parse_pending) {
+				/* Parse the data received along with the previous response */
+				dl->http.parse_pending = false;
+				rc = handle_received(dl, 0);
+				if (rc < 0) {
+					break;
+				} else if (rc == 0) {
+					/* Send request again */
+					send_request = true;
+				}
+				continue;
+			}
+
 			LOG_DBG("Receiving up to %d bytes at %p...", (sizeof(dl->buf) - dl->offset),
 				(void *)(dl->buf + dl->offset));
 
@@ -993,6 +1011,12 @@ int download_client_start(struct download_client *client, const char *file,
 	client->progress = from;
 	client->offset = 0;
 	client->http.has_header = false;
+	client->http.parse_pending = false;
+	client->http.in_flight = 0;
+	if (from == 0) {
+		/* Keep the ETag when resuming, to detect a change of the file */
+		client->http.etag = 0;
+	}
 	if (is_idle(client)) {
 		set_state(client, DOWNLOAD_CLIENT_CONNECTING);
 	} else {
@@ -1048,6 +1072,19 @@ int download_client_file_size_get(struct download_client *client, size_t *size)
 	return 0;
 }
 
+int download_client_etag_get(struct download_client *client, uint32_t *etag)
+{
+	if (!client || !etag) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&client->mutex, K_FOREVER);
+	*etag = client->http.etag;
+	k_mutex_unlock(&client->mutex);
+
+	return 0;
+}
+
 int download_client_downloaded_size_get(struct download_client *client, size_t *size)
 {
 	if (!client || !size) {
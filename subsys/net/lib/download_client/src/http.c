@@ -10,6 +10,7 @@
 #include <string.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/__assert.h>
+#include <zephyr/sys/crc.h>
 #include <net/download_client.h>
 #include "download_client_internal.h"
 
@@ -43,36 +44,28 @@ LOG_MODULE_DECLARE(download_client, CONFIG_DOWNLOAD_CLIENT_LOG_LEVEL);
 
 extern char *strnstr(const char *haystack, const char *needle, size_t haystack_sz);
 
-int http_get_request_send(struct download_client *client)
+static size_t http_frag_size(const struct download_client *client)
+{
+	if (client->config.frag_size_override) {
+		return client->config.frag_size_override;
+	}
+
+	return CONFIG_DOWNLOAD_CLIENT_HTTP_FRAG_SIZE;
+}
+
+/* Build a request for the next range in the free part of the buffer, after any
+ * received data that is yet to be parsed, and send it.
+ */
+static int http_request_send(struct download_client *client, const char *file, const char *host)
 {
 	int err;
 	int len;
 	size_t off;
-	char host[HOSTNAME_SIZE];
-	char file[FILENAME_SIZE];
-
-	__ASSERT_NO_MSG(client->host);
-	__ASSERT_NO_MSG(client->file);
-
-	client->http.has_header = false;
-
-	err = url_parse_host(client->host, host, sizeof(host));
-	if (err) {
-		return err;
-	}
-
-	err = url_parse_file(client->file, file, sizeof(file));
-	if (err) {
-		return err;
-	}
+	char *buf = client->buf + client->offset;
+	size_t buf_len = sizeof(client->buf) - client->offset;
 
 	/* Offset of last byte in range (Content-Range) */
-	if (client->config.frag_size_override) {
-		off = client->progress + client->config.frag_size_override - 1;
-	} else {
-		off = client->progress +
-			CONFIG_DOWNLOAD_CLIENT_HTTP_FRAG_SIZE - 1;
-	}
+	off = client->http.requested + http_frag_size(client) - 1;
 
 	if (client->file_size != 0) {
 		/* Don't request bytes past the end of file */
@@ -81,40 +74,144 @@ int http_get_request_send(struct download_client *client)
 
 	if (client->proto == IPPROTO_TLS_1_2
 	   || IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_RANGE_REQUESTS)) {
-		len = snprintf(client->buf,
-			CONFIG_DOWNLOAD_CLIENT_BUF_SIZE,
-			HTTP_GET_RANGE, file, host, client->progress, off);
+		len = snprintf(buf, buf_len,
+			HTTP_GET_RANGE, file, host, client->http.requested, off);
 		client->http.ranged = true;
 	} else if (client->progress) {
-		len = snprintf(client->buf,
-			CONFIG_DOWNLOAD_CLIENT_BUF_SIZE,
+		len = snprintf(buf, buf_len,
 			HTTP_GET_OFFSET, file, host, client->progress);
 		client->http.ranged = false;
 	} else {
-		len = snprintf(client->buf,
-			CONFIG_DOWNLOAD_CLIENT_BUF_SIZE,
+		len = snprintf(buf, buf_len,
 			HTTP_GET, file, host);
 		client->http.ranged = false;
 	}
 
-	if (len < 0 || len > CONFIG_DOWNLOAD_CLIENT_BUF_SIZE) {
+	if (len < 0 || len >= buf_len) {
+		if (client->offset) {
+			/* Try again when more of the buffer is free */
+			return -ENOBUFS;
+		}
+
 		LOG_ERR("Cannot create GET request, buffer too small");
 		return -ENOMEM;
 	}
 
 	if (IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_LOG_HEADERS)) {
-		LOG_HEXDUMP_DBG(client->buf, len, "HTTP request");
+		LOG_HEXDUMP_DBG(buf, len, "HTTP request");
 	}
 
-	err = socket_send(client, len, 0);
+	err = socket_send(client, client->offset, len, 0);
 	if (err) {
 		LOG_ERR("Failed to send HTTP request, errno %d", errno);
 		return err;
 	}
 
+	if (client->http.ranged) {
+		client->http.requested = off + 1;
+		client->http.in_flight++;
+	}
+
 	return 0;
 }
 
+/* Send ranged requests ahead until the pipeline is full. The file size must be known
+ * so that no range past the end of the file is requested.
+ */
+static int http_pipeline_fill(struct download_client *client, const char *file, const char *host)
+{
+	int err;
+
+	while (client->http.ranged && client->file_size != 0 &&
+	       client->http.requested < client->file_size &&
+	       client->http.in_flight < CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINE_DEPTH) {
+		err = http_request_send(client, file, host);
+		if (err == -ENOBUFS) {
+			break;
+		} else if (err) {
+			return err;
+		}
+
+		LOG_DBG("Pipelined request, %u in flight", client->http.in_flight);
+	}
+
+	return 0;
+}
+
+int http_get_request_send(struct download_client *client)
+{
+	int err;
+	char host[HOSTNAME_SIZE];
+	char file[FILENAME_SIZE];
+
+	__ASSERT_NO_MSG(client->host);
+	__ASSERT_NO_MSG(client->file);
+
+	/* Any response that was in flight is lost, start over from the current progress */
+	client->http.has_header = false;
+	client->http.parse_pending = false;
+	client->http.in_flight = 0;
+	client->http.excess = 0;
+	client->http.requested = client->progress;
+
+	err = url_parse_host(client->host, host, sizeof(host));
+	if (err) {
+		return err;
+	}
+
+	err = url_parse_file(client->file, file, sizeof(file));
+	if (err) {
+		return err;
+	}
+
+	err = http_request_send(client, file, host);
+	if (err) {
+		return err;
+	}
+
+	return http_pipeline_fill(client, file, host);
+}
+
+/* Returns:
+ *  1 to keep on receiving the responses in flight
+ *  0 to send a new request
+ */
+int http_pipeline_continue(struct download_client *client, size_t frag_len)
+{
+	int err;
+	char host[HOSTNAME_SIZE];
+	char file[FILENAME_SIZE];
+
+	if (client->http.excess) {
+		/* Move the start of the next response to the beginning of the buffer */
+		memmove(client->buf, client->buf + frag_len, client->http.excess);
+		client->offset = client->http.excess;
+		client->http.excess = 0;
+		client->http.parse_pending = true;
+	}
+
+	if (CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINE_DEPTH == 1) {
+		return 1;
+	}
+
+	err = url_parse_host(client->host, host, sizeof(host));
+	if (!err) {
+		err = url_parse_file(client->file, file, sizeof(file));
+	}
+
+	if (!err) {
+		err = http_pipeline_fill(client, file, host);
+	}
+
+	if (err) {
+		/* Start over with a new request */
+		LOG_WRN("Failed to pipeline HTTP request, err %d", err);
+		return 0;
+	}
+
+	return 1;
+}
+
 /* Returns:
  *  1 while the header is being received
  *  0 if the header has been fully received
@@ -128,8 +225,9 @@ static int http_header_parse(struct download_client *client, size_t *hdr_len)
 
 	const unsigned int expected_status = (client->http.ranged || client->progress) ? 206 : 200;
 
-	p = strnstr(client->buf, "\r\n\r\n", sizeof(client->buf));
-	if (!p || p > client->buf + client->offset) {
+	/* Only look at the received data, the rest of the buffer may hold a request */
+	p = strnstr(client->buf, "\r\n\r\n", client->offset);
+	if (!p) {
 		/* Waiting full HTTP header */
 		LOG_DBG("Waiting full header in response");
 		return 1;
@@ -220,6 +318,29 @@ static int http_header_parse(struct download_client *client, size_t *hdr_len)
 		LOG_DBG("File size = %u", client->file_size);
 	}
 
+	p = IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_ETAG) ?
+		strnstr(client->buf, "\r\netag:", *hdr_len) : NULL;
+	if (p) {
+		uint32_t etag;
+
+		p += strlen("\r\netag:");
+		while (*p == ' ') {
+			p++;
+		}
+
+		/* The header ends with an empty line, the end of line is always found */
+		q = strnstr(p, "\r\n", *hdr_len - (p - client->buf));
+		etag = crc32_ieee((const uint8_t *)p, q - p);
+
+		/* Ranges of another version of the file must not be mixed in */
+		if (client->http.etag && client->http.etag != etag) {
+			LOG_ERR("File changed on the server during download");
+			return -EBADMSG;
+		}
+
+		client->http.etag = etag;
+	}
+
 	p = strnstr(client->buf, "\r\nconnection: close", *hdr_len);
 	if (p) {
 		LOG_WRN("Peer closed connection, will re-connect");
@@ -272,30 +393,43 @@ int http_parse(struct download_client *client, size_t len)
 			 */
 			client->offset = 0;
 		}
+
+		/* Only the bytes after the header are payload */
+		len = client->offset;
+
+		if (client->http.ranged) {
+			/* The range is clipped at the end of the file by the server */
+			client->http.frag_left = MIN(http_frag_size(client),
+						     client->file_size - client->progress);
+		}
 	}
 
-	/* Accumulate overall file progress.
-	 * If the last recv() call read an HTTP header,
-	 * `offset` has been moved at the end of any trailing
-	 * payload bytes by http_header_parse(). In this case,
-	 * `offset` is less than `len` and it represents
-	 * the actual payload bytes.
-	 */
-	client->progress += MIN(client->offset, len);
+	if (client->http.ranged) {
+		/* Bytes past the end of this response belong to the next pipelined response */
+		client->http.excess = len - MIN(len, client->http.frag_left);
+		client->offset -= client->http.excess;
+		len -= client->http.excess;
+		client->http.frag_left -= len;
+	}
+
+	/* Accumulate overall file progress */
+	client->progress += len;
 
 	/* Have we received a whole fragment or the whole file? */
-	if (client->progress != client->file_size) {
-		if (client->http.ranged) {
-			if (client->offset < (client->config.frag_size_override != 0 ?
-						      client->config.frag_size_override :
-						      CONFIG_DOWNLOAD_CLIENT_HTTP_FRAG_SIZE)) {
-				/* Ranged query: read until a full fragment */
-				return 1;
-			}
-		} else {
-			/* Non-ranged query: just keep on reading, ignore fragment size */
+	if (client->http.ranged) {
+		if (client->http.frag_left) {
+			/* Ranged query: read until a full fragment */
 			return 1;
 		}
+
+		/* The next response starts with a header */
+		client->http.has_header = false;
+		if (client->http.in_flight) {
+			client->http.in_flight--;
+		}
+	} else if (client->progress != client->file_size) {
+		/* Non-ranged query: just keep on reading, ignore fragment size */
+		return 1;
 	}
 
 	/* Either we have a full file, or we need to request a next fragment */
@@ -13,6 +13,9 @@
 #include <zephyr/net/socket.h>
 
 #include "fota_download_util.h"
+#if defined(CONFIG_FOTA_DOWNLOAD_RESUME_SESSION)
+#include "fota_download_session.h"
+#endif
 
 #if defined(PM_S1_ADDRESS) || defined(CONFIG_DFU_TARGET_MCUBOOT)
 /* MCUBoot support is required */
@@ -56,6 +59,9 @@ enum flags_t {
 static atomic_t flags;
 static enum fota_download_error_cause error_state = FOTA_DOWNLOAD_ERROR_CAUSE_NO_ERROR;
 static bool initialized;
+#if defined(CONFIG_FOTA_DOWNLOAD_RESUME_SESSION)
+static struct fota_download_session session;
+#endif
 
 static void send_evt(enum fota_download_evt_id id)
 {
@@ -158,6 +164,52 @@ static int disconnect(void)
 	return download_client_disconnect(&dlc);
 }
 
+#if defined(CONFIG_FOTA_DOWNLOAD_RESUME_SESSION)
+/* Only resume if the file on the server is the one of the stored session,
+ * then store the session of the current download.
+ */
+static void session_update(size_t file_size)
+{
+	struct fota_download_session current = {
+		.host_hash = dl_host_hash,
+		.file_hash = dl_file_hash,
+		.file_size = file_size,
+	};
+
+	(void)download_client_etag_get(&dlc, &current.etag);
+
+	if (memcmp(&current, &session, sizeof(current)) == 0) {
+		return;
+	}
+
+	if (!atomic_test_and_set_bit(&flags, FLAG_NEW_URI)) {
+		LOG_INF("File changed on the server, not resuming");
+	}
+
+	session = current;
+	(void)fota_download_session_save(&session);
+}
+
+static void session_load(void)
+{
+	if (fota_download_session_load(&session) != 0) {
+		return;
+	}
+
+	/* Let the download of the same file resume after a reboot */
+	dl_host_hash = session.host_hash;
+	dl_file_hash = session.file_hash;
+
+	LOG_DBG("Download session restored, size %u", session.file_size);
+}
+
+static void session_clear(void)
+{
+	memset(&session, 0, sizeof(session));
+	(void)fota_download_session_clear();
+}
+#endif /* CONFIG_FOTA_DOWNLOAD_RESUME_SESSION */
+
 static int download_client_callback(const struct download_client_evt *event)
 {
 	static size_t file_size;
@@ -211,6 +263,10 @@ static int download_client_callback(const struct download_client_evt *event)
 				goto error_and_close;
 			}
 
+#if defined(CONFIG_FOTA_DOWNLOAD_RESUME_SESSION)
+			session_update(file_size);
+#endif
+
 			err = dfu_target_offset_get(&offset);
 			if (err != 0) {
 				LOG_DBG("unable to get dfu target offset err: "
@@ -303,6 +359,10 @@ static int download_client_callback(const struct download_client_evt *event)
 			goto error_and_close;
 		}
 
+#if defined(CONFIG_FOTA_DOWNLOAD_RESUME_SESSION)
+		session_clear();
+#endif
+
 		err = disconnect();
 		if (err != 0) {
 			set_error_state(FOTA_DOWNLOAD_ERROR_CAUSE_INTERNAL);
@@ -679,6 +739,10 @@ static int fota_download_object_init(void)
 
 	k_work_init_delayable(&dlc_with_offset_work, download_with_offset);
 
+#if defined(CONFIG_FOTA_DOWNLOAD_RESUME_SESSION)
+	session_load();
+#endif
+
 	err = download_client_init(&dlc, download_client_callback);
 	if (err != 0) {
 		return err;
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
+
+#include "fota_download_session.h"
+
+LOG_MODULE_DECLARE(fota_download, CONFIG_FOTA_DOWNLOAD_LOG_LEVEL);
+
+#define SETTINGS_SESSION "fota_dl/session"
+
+struct session_load_ctx {
+	struct fota_download_session *session;
+	bool found;
+};
+
+static int settings_load_handler(const char *key, size_t len, settings_read_cb read_cb,
+				 void *cb_arg, void *param)
+{
+	struct session_load_ctx *ctx = param;
+	ssize_t rd;
+
+	ARG_UNUSED(key);
+
+	if (len != sizeof(*ctx->session)) {
+		LOG_WRN("Ignoring stored download session of unexpected size %d", len);
+		return 0;
+	}
+
+	rd = read_cb(cb_arg, ctx->session, sizeof(*ctx->session));
+	if (rd != sizeof(*ctx->session)) {
+		return -EIO;
+	}
+
+	ctx->found = true;
+
+	return 0;
+}
+
+int fota_download_session_load(struct fota_download_session *session)
+{
+	int err;
+	struct session_load_ctx ctx = {
+		.session = session,
+	};
+
+	err = settings_subsys_init();
+	if (err) {
+		LOG_ERR("settings_subsys_init failed (err %d)", err);
+		return err;
+	}
+
+	err = settings_load_subtree_direct(SETTINGS_SESSION, settings_load_handler, &ctx);
+	if (err) {
+		LOG_ERR("Unable to load download session (err %d)", err);
+		return err;
+	}
+
+	return ctx.found ? 0 : -ENOENT;
+}
+
+int fota_download_session_save(const struct fota_download_session *session)
+{
+	int err;
+
+	err = settings_save_one(SETTINGS_SESSION, session, sizeof(*session));
+	if (err) {
+		LOG_ERR("Unable to store download session (err %d)", err);
+	}
+
+	return err;
+}
+
+int fota_download_session_clear(void)
+{
+	int err;
+
+	err = settings_delete(SETTINGS_SESSION);
+	if (err) {
+		LOG_ERR("Unable to delete download session (err %d)", err);
+	}
+
+	return err;
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef FOTA_DOWNLOAD_SESSION_H__
+#define FOTA_DOWNLOAD_SESSION_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Download session, identifying the file being downloaded.
+ *
+ * The download progress itself is kept by the DFU target.
+ */
+struct fota_download_session {
+	/** Hash of the host name. */
+	uint32_t host_hash;
+	/** Hash of the file name. */
+	uint32_t file_hash;
+	/** Size of the file on the server. */
+	uint32_t file_size;
+	/** CRC32 of the ETag of the file on the server, zero if none. */
+	uint32_t etag;
+};
+
+/** @brief Load the stored download session.
+ *
+ * @param[out] session Session.
+ *
+ * @retval 0 If successful.
+ * @retval -ENOENT If no session is stored.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int fota_download_session_load(struct fota_download_session *session);
+
+/** @brief Store a download session.
+ *
+ * @param[in] session Session.
+ *
+ * @retval 0 If successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int fota_download_session_save(const struct fota_download_session *session);
+
+/** @brief Delete the stored download session.
+ *
+ * @retval 0 If successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int fota_download_session_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FOTA_DOWNLOAD_SESSION_H__ */
@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <float.h>
+#include <limits.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_defs.h>
+#include <net/nrf_cloud_codec.h>
+
+#include "nrf_cloud_codec_internal.h"
+
+/* Same size as the number buffer of cJSON */
+#define JSON_NUM_BUF_SIZE 26
+
+/* Writes JSON text to a caller buffer as it goes, without building a cJSON tree first.
+ * The output is the same as cJSON_PrintUnformatted() for the same items.
+ * Writing continues past the end of the buffer to get the length of the whole text.
+ */
+struct json_writer {
+	char *buf;
+	size_t size;
+	size_t len;
+	/* No comma before the next item */
+	bool first;
+};
+
+static void json_writer_init(struct json_writer *w, char *buf, size_t size)
+{
+	w->buf = buf;
+	w->size = size;
+	w->len = 0;
+	w->first = true;
+}
+
+static void json_write(struct json_writer *w, const char *str, size_t len)
+{
+	/* Keep space for the null terminator */
+	if ((w->len + len) < w->size) {
+		memcpy(&w->buf[w->len], str, len);
+	}
+
+	w->len += len;
+}
+
+static void json_write_char(struct json_writer *w, char c)
+{
+	json_write(w, &c, 1);
+}
+
+/* Write a string with the escaping done by cJSON */
+static void json_write_str(struct json_writer *w, const char *str)
+{
+	const char *run = str;
+	char esc[sizeof("\\u0000")];
+
+	json_write_char(w, '"');
+
+	for (; *str != '\0'; str++) {
+		unsigned char c = *str;
+
+		if ((c >= ' ') && (c != '"') && (c != '\\')) {
+			continue;
+		}
+
+		json_write(w, run, str - run);
+		run = str + 1;
+
+		switch (c) {
+		case '"':
+		case '\\':
+			esc[0] = '\\';
+			esc[1] = c;
+			json_write(w, esc, 2);
+			break;
+		case '\b':
+			json_write(w, "\\b", 2);
+			break;
+		case '\f':
+			json_write(w, "\\f", 2);
+			break;
+		case '\n':
+			json_write(w, "\\n", 2);
+			break;
+		case '\r':
+			json_write(w, "\\r", 2);
+			break;
+		case '\t':
+			json_write(w, "\\t", 2);
+			break;
+		default:
+			json_write(w, esc, snprintf(esc, sizeof(esc), "\\u%04x", c));
+			break;
+		}
+	}
+
+	json_write(w, run, str - run);
+	json_write_char(w, '"');
+}
+
+static void json_write_key(struct json_writer *w, const char *key)
+{
+	if (!w->first) {
+		json_write_char(w, ',');
+	}
+
+	w->first = false;
+
+	if (key) {
+		json_write_str(w, key);
+		json_write_char(w, ':');
+	}
+}
+
+static void json_obj_start(struct json_writer *w, const char *key)
+{
+	json_write_key(w, key);
+	json_write_char(w, '{');
+	w->first = true;
+}
+
+static void json_obj_end(struct json_writer *w)
+{
+	json_write_char(w, '}');
+	w->first = false;
+}
+
+static void json_str_add(struct json_writer *w, const char *key, const char *val)
+{
+	json_write_key(w, key);
+	json_write_str(w, val);
+}
+
+/* Write a number the way cJSON prints it */
+static void json_num_add(struct json_writer *w, const char *key, double val)
+{
+	char num[JSON_NUM_BUF_SIZE];
+	int int_val;
+	int len;
+
+	json_write_key(w, key);
+
+	if (isnan(val) || isinf(val)) {
+		json_write(w, "null", 4);
+		return;
+	}
+
+	int_val = (val >= INT_MAX) ? INT_MAX : (val <= (double)INT_MIN) ? INT_MIN : (int)val;
+
+	if (val == (double)int_val) {
+		len = snprintf(num, sizeof(num), "%d", int_val);
+	} else {
+		/* Use 15 digits if the number reads back the same, 17 otherwise */
+		len = snprintf(num, sizeof(num), "%1.15g", val);
+
+		double test = strtod(num, NULL);
+
+		if (fabs(test - val) > (MAX(fabs(test), fabs(val)) * DBL_EPSILON)) {
+			len = snprintf(num, sizeof(num), "%1.17g", val);
+		}
+	}
+
+	json_write(w, num, len);
+}
+
+static int json_writer_finish(struct json_writer *w, size_t *len)
+{
+	*len = w->len;
+
+	if (w->len >= w->size) {
+		return -ENOBUFS;
+	}
+
+	w->buf[w->len] = '\0';
+
+	return 0;
+}
+
+static void json_msg_header_add(struct json_writer *w, const char *app_id, int64_t ts_ms)
+{
+	json_str_add(w, NRF_CLOUD_JSON_APPID_KEY, app_id);
+	json_str_add(w, NRF_CLOUD_JSON_MSG_TYPE_KEY, NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	if (ts_ms != NRF_CLOUD_NO_TIMESTAMP) {
+		json_num_add(w, NRF_CLOUD_MSG_TIMESTAMP_KEY, ts_ms);
+	}
+}
+
+static void json_pvt_add(struct json_writer *w, const struct nrf_cloud_gnss_pvt *pvt)
+{
+	json_obj_start(w, NRF_CLOUD_JSON_DATA_KEY);
+	json_num_add(w, NRF_CLOUD_JSON_GNSS_PVT_KEY_LON, pvt->lon);
+	json_num_add(w, NRF_CLOUD_JSON_GNSS_PVT_KEY_LAT, pvt->lat);
+	json_num_add(w, NRF_CLOUD_JSON_GNSS_PVT_KEY_ACCURACY, pvt->accuracy);
+	if (pvt->has_alt) {
+		json_num_add(w, NRF_CLOUD_JSON_GNSS_PVT_KEY_ALTITUDE, pvt->alt);
+	}
+	if (pvt->has_speed) {
+		json_num_add(w, NRF_CLOUD_JSON_GNSS_PVT_KEY_SPEED, pvt->speed);
+	}
+	if (pvt->has_heading) {
+		json_num_add(w, NRF_CLOUD_JSON_GNSS_PVT_KEY_HEADING, pvt->heading);
+	}
+	json_obj_end(w);
+}
+
+int nrf_cloud_sensor_data_json_write(const struct nrf_cloud_sensor_data *const sensor,
+				     char *const buf, const size_t buf_size, size_t *const len)
+{
+	struct json_writer w;
+	const char *app_id;
+
+	if (!sensor || !sensor->data.ptr || !len || (!buf && buf_size)) {
+		return -EINVAL;
+	}
+
+	app_id = nrf_cloud_sensor_app_id_lookup(sensor->type);
+	if (!app_id) {
+		return -EINVAL;
+	}
+
+	json_writer_init(&w, buf, buf_size);
+
+	/* Same member order as nrf_cloud_sensor_data_encode() used with cJSON */
+	json_obj_start(&w, NULL);
+	json_str_add(&w, NRF_CLOUD_JSON_APPID_KEY, app_id);
+	json_str_add(&w, NRF_CLOUD_JSON_DATA_KEY, sensor->data.ptr);
+	json_str_add(&w, NRF_CLOUD_JSON_MSG_TYPE_KEY, NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	if (sensor->ts_ms != NRF_CLOUD_NO_TIMESTAMP) {
+		json_num_add(&w, NRF_CLOUD_MSG_TIMESTAMP_KEY, sensor->ts_ms);
+	}
+	json_obj_end(&w);
+
+	return json_writer_finish(&w, len);
+}
+
+int nrf_cloud_gnss_msg_json_write(const struct nrf_cloud_gnss_data *const gnss,
+				  char *const buf, const size_t buf_size, size_t *const len)
+{
+	struct json_writer w;
+
+	if (!gnss || !len || (!buf && buf_size)) {
+		return -EINVAL;
+	}
+
+	json_writer_init(&w, buf, buf_size);
+	json_obj_start(&w, NULL);
+	json_msg_header_add(&w, NRF_CLOUD_JSON_APPID_VAL_GNSS, gnss->ts_ms);
+
+	switch (gnss->type) {
+	case NRF_CLOUD_GNSS_TYPE_PVT:
+		json_pvt_add(&w, &gnss->pvt);
+		break;
+	case NRF_CLOUD_GNSS_TYPE_MODEM_PVT:
+	{
+#if defined(CONFIG_NRF_MODEM)
+		if (!gnss->mdm_pvt) {
+			return -EINVAL;
+		}
+
+		struct nrf_cloud_gnss_pvt pvt = {
+			.lon =		gnss->mdm_pvt->longitude,
+			.lat =		gnss->mdm_pvt->latitude,
+			.accuracy =	gnss->mdm_pvt->accuracy,
+			.alt =		gnss->mdm_pvt->altitude,
+			.has_alt =	1,
+			.speed =	gnss->mdm_pvt->speed,
+			.has_speed =	1,
+			.heading =	gnss->mdm_pvt->heading,
+			.has_heading =	1
+		};
+
+		json_pvt_add(&w, &pvt);
+		break;
+#else
+		return -ENOSYS;
+#endif
+	}
+	case NRF_CLOUD_GNSS_TYPE_MODEM_NMEA:
+	case NRF_CLOUD_GNSS_TYPE_NMEA:
+	{
+		const char *nmea = NULL;
+
+		if (gnss->type == NRF_CLOUD_GNSS_TYPE_MODEM_NMEA) {
+#if defined(CONFIG_NRF_MODEM)
+			if (gnss->mdm_nmea) {
+				nmea = gnss->mdm_nmea->nmea_str;
+			}
+#endif
+		} else {
+			nmea = gnss->nmea.sentence;
+		}
+
+		if (nmea == NULL) {
+			return -EINVAL;
+		}
+
+		if (memchr(nmea, '\0', NRF_MODEM_GNSS_NMEA_MAX_LEN) == NULL) {
+			return -EFBIG;
+		}
+
+		json_str_add(&w, NRF_CLOUD_JSON_DATA_KEY, nmea);
+		break;
+	}
+	default:
+		return -EPROTO;
+	}
+
+	json_obj_end(&w);
+
+	return json_writer_finish(&w, len);
+}
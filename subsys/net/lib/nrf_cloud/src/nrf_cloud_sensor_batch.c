@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_codec.h>
+#include <net/nrf_cloud_sensor_batch.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <date_time.h>
+#if defined(CONFIG_NRF_CLOUD_COAP)
+#include <net/nrf_cloud_coap.h>
+#endif
+
+LOG_MODULE_REGISTER(nrf_cloud_sensor_batch, CONFIG_NRF_CLOUD_LOG_LEVEL);
+
+/* The samples form a JSON array of device messages, as the bulk topic requires. The array
+ * is opened with the first sample and closed when the batch is sent.
+ */
+static char batch_buf[CONFIG_NRF_CLOUD_SENSOR_BATCH_BUF_SIZE];
+static size_t batch_len;
+static size_t batch_count;
+static K_MUTEX_DEFINE(batch_lock);
+
+static void batch_age_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(batch_age_work, batch_age_work_fn);
+
+static int batch_append(const struct nrf_cloud_sensor_data *sample)
+{
+	/* Leave room for the separator before the sample and the closing bracket after it */
+	size_t offset = batch_len + 1;
+	size_t len;
+	int err;
+
+	if ((offset + 1) >= sizeof(batch_buf)) {
+		return -ENOBUFS;
+	}
+
+	err = nrf_cloud_sensor_data_json_write(sample, &batch_buf[offset],
+					       sizeof(batch_buf) - offset - 1, &len);
+	if (err) {
+		return err;
+	}
+
+	batch_buf[batch_len] = (batch_count == 0) ? '[' : ',';
+	batch_len = offset + len;
+	batch_count++;
+
+	return 0;
+}
+
+static int batch_send(void)
+{
+	int err;
+
+	batch_buf[batch_len] = ']';
+	batch_buf[batch_len + 1] = '\0';
+
+#if defined(CONFIG_NRF_CLOUD_MQTT)
+	struct nrf_cloud_tx_data output = {
+		.qos = MQTT_QOS_1_AT_LEAST_ONCE,
+		.topic_type = NRF_CLOUD_TOPIC_BULK,
+		.data.ptr = batch_buf,
+		.data.len = batch_len + 1
+	};
+
+	err = nrf_cloud_send(&output);
+#elif defined(CONFIG_NRF_CLOUD_COAP)
+	err = nrf_cloud_coap_json_message_send(batch_buf, true, true);
+#else
+	err = -ENODEV;
+#endif
+
+	return err;
+}
+
+/* Must be called with batch_lock held. */
+static int batch_flush(void)
+{
+	int err;
+
+	if (batch_count == 0) {
+		return 0;
+	}
+
+	err = batch_send();
+	if (err) {
+		LOG_ERR("Failed to send %zu samples: %d", batch_count, err);
+		return err;
+	}
+
+	LOG_DBG("Sent %zu samples in %zu bytes", batch_count, batch_len + 1);
+
+	batch_len = 0;
+	batch_count = 0;
+	(void)k_work_cancel_delayable(&batch_age_work);
+
+	return 0;
+}
+
+static void batch_age_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&batch_lock, K_FOREVER);
+
+	if (batch_flush()) {
+		/* Retry later, the samples are kept */
+		(void)k_work_schedule(&batch_age_work,
+				      K_SECONDS(CONFIG_NRF_CLOUD_SENSOR_BATCH_MAX_AGE));
+	}
+
+	k_mutex_unlock(&batch_lock);
+}
+
+int nrf_cloud_sensor_batch_add(const struct nrf_cloud_sensor_data *sensor)
+{
+	struct nrf_cloud_sensor_data sample;
+	int err;
+
+	if (!sensor || !sensor->data.ptr) {
+		return -EINVAL;
+	}
+
+	sample = *sensor;
+
+	/* The sample is sent later, so it needs the time it was taken */
+	if ((sample.ts_ms == NRF_CLOUD_NO_TIMESTAMP) && IS_ENABLED(CONFIG_DATE_TIME)) {
+		/* If date_time_now() fails, sample.ts_ms remains unchanged. */
+		(void)date_time_now(&sample.ts_ms);
+	}
+
+	k_mutex_lock(&batch_lock, K_FOREVER);
+
+	err = batch_append(&sample);
+	if ((err == -ENOBUFS) && (batch_count > 0)) {
+		/* Make room by sending what is already in the batch */
+		err = batch_flush();
+		if (!err) {
+			err = batch_append(&sample);
+		}
+	}
+
+	if (err == -ENOBUFS) {
+		LOG_ERR("Sample does not fit in the batch buffer");
+		err = -E2BIG;
+	}
+
+	if (err) {
+		goto unlock;
+	}
+
+	if ((batch_count == 1) && (CONFIG_NRF_CLOUD_SENSOR_BATCH_MAX_AGE > 0)) {
+		(void)k_work_schedule(&batch_age_work,
+				      K_SECONDS(CONFIG_NRF_CLOUD_SENSOR_BATCH_MAX_AGE));
+	}
+
+	if ((CONFIG_NRF_CLOUD_SENSOR_BATCH_MAX_SAMPLES > 0) &&
+	    (batch_count >= CONFIG_NRF_CLOUD_SENSOR_BATCH_MAX_SAMPLES)) {
+		/* The sample is in the batch even if sending fails, it is sent later */
+		(void)batch_flush();
+	}
+
+unlock:
+	k_mutex_unlock(&batch_lock);
+
+	return err;
+}
+
+int nrf_cloud_sensor_batch_flush(void)
+{
+	int err;
+
+	k_mutex_lock(&batch_lock, K_FOREVER);
+	err = batch_flush();
+	k_mutex_unlock(&batch_lock);
+
+	return err;
+}
+
+size_t nrf_cloud_sensor_batch_count_get(void)
+{
+	size_t count;
+
+	k_mutex_lock(&batch_lock, K_FOREVER);
+	count = batch_count;
+	k_mutex_unlock(&batch_lock);
+
+	return count;
+}
@@ -28,6 +28,8 @@ struct suit_cache_slot {
 	size_t size_offset;
 	size_t data_offset;
 	size_t eb_size;
+	size_t uri_offset;
+	size_t uri_len;
 };
 
 /**
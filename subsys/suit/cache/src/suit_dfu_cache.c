@@ -59,8 +59,8 @@ struct match_uri_ctx {
  * @brief Foreach callback for matching.
  */
 static bool match_uri(struct dfu_cache_pool *cache_pool, zcbor_state_t *state,
-		      const struct zcbor_string *uri, uintptr_t payload_offset, size_t payload_size,
-		      void *ctx)
+		      const struct zcbor_string *uri, uintptr_t uri_address,
+		      uintptr_t payload_offset, size_t payload_size, void *ctx)
 {
 	struct match_uri_ctx *cb_ctx = ctx;
 
@@ -118,8 +118,24 @@ suit_plat_err_t suit_dfu_cache_search(const uint8_t *uri, size_t uri_size, const
 	if ((uri != NULL) && (uri_size != 0)) {
 		struct zcbor_string tmp_payload = {.len = 0, .value = NULL};
 		struct zcbor_string tmp_uri = {.len = uri_size, .value = uri};
+		size_t pools_count = dfu_cache.pools_count;
+
+#ifdef CONFIG_SUIT_CACHE_INDEX
+		struct zcbor_string index_payload = {.len = 0, .value = NULL};
+		suit_plat_err_t index_ret =
+			suit_dfu_cache_index_search(&tmp_uri, &pools_count, &index_payload);
+#endif
+
+		/* Only the cache pools before the indexed match, and not fully covered by the
+		 * index, need to be scanned.
+		 */
+		for (size_t i = 0; i < pools_count; i++) {
+#ifdef CONFIG_SUIT_CACHE_INDEX
+			if (suit_dfu_cache_index_pool_is_complete(i)) {
+				continue;
+			}
+#endif
 
-		for (size_t i = 0; i < dfu_cache.pools_count; i++) {
 			suit_plat_err_t ret =
 				search_cache_pool(&dfu_cache.pools[i], &tmp_uri, &tmp_payload);
 
@@ -131,6 +147,15 @@ suit_plat_err_t suit_dfu_cache_search(const uint8_t *uri, size_t uri_size, const
 			}
 		}
 
+#ifdef CONFIG_SUIT_CACHE_INDEX
+		if (index_ret == SUIT_PLAT_SUCCESS) {
+			*payload = index_payload.value;
+			*payload_size = index_payload.len;
+
+			return index_ret;
+		}
+#endif
+
 		return SUIT_PLAT_ERR_NOT_FOUND;
 	}
 
@@ -190,6 +215,11 @@ suit_plat_err_t suit_dfu_cache_initialize(struct dfu_cache *cache)
 
 	init_done = true;
 
+#ifdef CONFIG_SUIT_CACHE_INDEX
+	/* The cache pools are indexed on the first search, when external memory is available */
+	suit_dfu_cache_index_reset(&dfu_cache);
+#endif
+
 	return SUIT_PLAT_SUCCESS;
 }
 
@@ -197,4 +227,8 @@ void suit_dfu_cache_deinitialize(void)
 {
 	suit_dfu_cache_clear(&dfu_cache);
 	init_done = false;
+
+#ifdef CONFIG_SUIT_CACHE_INDEX
+	suit_dfu_cache_index_reset(&dfu_cache);
+#endif
 }
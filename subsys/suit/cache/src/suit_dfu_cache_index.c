@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <suit_dfu_cache.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#include "suit_dfu_cache_internal.h"
+
+LOG_MODULE_REGISTER(dfu_cache_index, CONFIG_SUIT_LOG_LEVEL);
+
+#define FNV1A_32_OFFSET_BASIS 2166136261U
+#define FNV1A_32_PRIME	      16777619U
+
+/* Open addressing hash table with linear probing. At least one entry is always kept empty
+ * so that probing for a missing URI ends.
+ */
+#define INDEX_SIZE	  CONFIG_SUIT_CACHE_INDEX_SIZE
+#define INDEX_MAX_ENTRIES (INDEX_SIZE - 1)
+
+BUILD_ASSERT(CONFIG_SUIT_MAX_URI_LENGTH <= UINT16_MAX, "URI length does not fit in the index");
+
+struct index_entry {
+	uint32_t hash;
+	uint16_t uri_len;
+	/* Index of the cache pool plus one, zero marks an empty entry */
+	uint8_t pool;
+	uintptr_t uri_address;
+	uintptr_t payload_address;
+	size_t payload_size;
+};
+
+static struct index_entry entries[INDEX_SIZE];
+static size_t entries_count;
+static struct dfu_cache *indexed_cache;
+static bool index_valid;
+/* Cache pools with slots that are not in the index */
+static uint32_t incomplete_pools;
+
+BUILD_ASSERT(CONFIG_SUIT_CACHE_MAX_CACHES <= 32, "Cache pool flags do not fit");
+
+static uint32_t uri_hash(const uint8_t *uri, size_t len)
+{
+	uint32_t hash = FNV1A_32_OFFSET_BASIS;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ uri[i]) * FNV1A_32_PRIME;
+	}
+
+	return hash;
+}
+
+static int pool_index_get(uintptr_t address)
+{
+	for (size_t i = 0; i < indexed_cache->pools_count; i++) {
+		uintptr_t pool_address = (uintptr_t)indexed_cache->pools[i].address;
+
+		if ((pool_address != 0) && (address >= pool_address) &&
+		    (address < pool_address + indexed_cache->pools[i].size)) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static void entry_insert(size_t pool_index, uint32_t hash, uintptr_t uri_address, size_t uri_len,
+			 uintptr_t payload_address, size_t payload_size)
+{
+	size_t i = hash % INDEX_SIZE;
+
+	if ((entries_count >= INDEX_MAX_ENTRIES) || (uri_len > CONFIG_SUIT_MAX_URI_LENGTH)) {
+		LOG_DBG("Slot %p not indexed, cache pool %zu is searched in full",
+			(void *)payload_address, pool_index);
+		incomplete_pools |= BIT(pool_index);
+		return;
+	}
+
+	while (entries[i].pool != 0) {
+		i = (i + 1) % INDEX_SIZE;
+	}
+
+	entries[i] = (struct index_entry){
+		.hash = hash,
+		.uri_len = uri_len,
+		.pool = pool_index + 1,
+		.uri_address = uri_address,
+		.payload_address = payload_address,
+		.payload_size = payload_size,
+	};
+	entries_count++;
+}
+
+/* Foreach callback adding every slot of a cache pool to the index */
+static bool slot_index(struct dfu_cache_pool *cache_pool, zcbor_state_t *state,
+		       const struct zcbor_string *uri, uintptr_t uri_address,
+		       uintptr_t payload_offset, size_t payload_size, void *ctx)
+{
+	size_t *pool_index = ctx;
+
+	entry_insert(*pool_index, uri_hash(uri->value, uri->len), uri_address, uri->len,
+		     payload_offset, payload_size);
+
+	return true;
+}
+
+static void index_build(void)
+{
+	memset(entries, 0, sizeof(entries));
+	entries_count = 0;
+	incomplete_pools = 0;
+
+	for (size_t i = 0; i < indexed_cache->pools_count; i++) {
+		struct dfu_cache_pool *cache_pool = &indexed_cache->pools[i];
+
+		if (cache_pool->address == NULL) {
+			continue;
+		}
+
+		/* Slots past a decoding error are not reachable through a scan either, so the
+		 * index is as complete as the scan would be.
+		 */
+		(void)suit_dfu_cache_partition_slot_foreach(cache_pool, slot_index, &i);
+	}
+
+	LOG_DBG("Indexed %zu cache slots", entries_count);
+
+	index_valid = true;
+}
+
+static bool uri_matches(const struct index_entry *entry, const struct zcbor_string *uri)
+{
+	uint8_t uri_buf[CONFIG_SUIT_MAX_URI_LENGTH];
+
+	if (suit_dfu_cache_memcpy(uri_buf, entry->uri_address, entry->uri_len) !=
+	    SUIT_PLAT_SUCCESS) {
+		return false;
+	}
+
+	return !memcmp(uri_buf, uri->value, uri->len);
+}
+
+void suit_dfu_cache_index_reset(struct dfu_cache *cache)
+{
+	indexed_cache = cache;
+	index_valid = false;
+}
+
+suit_plat_err_t suit_dfu_cache_index_search(const struct zcbor_string *uri, size_t *pool_index,
+					    struct zcbor_string *payload)
+{
+	const struct index_entry *found = NULL;
+	size_t uri_len = uri->len;
+	uint32_t hash;
+
+	if (indexed_cache == NULL) {
+		return SUIT_PLAT_ERR_NOT_FOUND;
+	}
+
+	*pool_index = indexed_cache->pools_count;
+
+	/* Null terminated URIs are stored without the terminator */
+	if (uri->value[uri_len - 1] == '\0') {
+		uri_len--;
+	}
+
+	if (uri_len > CONFIG_SUIT_MAX_URI_LENGTH) {
+		return SUIT_PLAT_ERR_NOT_FOUND;
+	}
+
+	if (!index_valid) {
+		index_build();
+	}
+
+	hash = uri_hash(uri->value, uri_len);
+
+	for (size_t i = hash % INDEX_SIZE; entries[i].pool != 0; i = (i + 1) % INDEX_SIZE) {
+		const struct index_entry *entry = &entries[i];
+
+		if ((entry->hash != hash) || (entry->uri_len != uri_len)) {
+			continue;
+		}
+
+		/* Keep the first match in search order, as a scan of the cache pools would */
+		if ((found != NULL) && ((entry->pool > found->pool) ||
+					((entry->pool == found->pool) &&
+					 (entry->payload_address > found->payload_address)))) {
+			continue;
+		}
+
+		if (uri_matches(entry, &(struct zcbor_string){.value = uri->value,
+							       .len = uri_len})) {
+			found = entry;
+		}
+	}
+
+	if (found == NULL) {
+		return SUIT_PLAT_ERR_NOT_FOUND;
+	}
+
+	*pool_index = found->pool - 1;
+	payload->value = (const uint8_t *)found->payload_address;
+	payload->len = found->payload_size;
+
+	return SUIT_PLAT_SUCCESS;
+}
+
+bool suit_dfu_cache_index_pool_is_complete(size_t pool_index)
+{
+	return index_valid && !(incomplete_pools & BIT(pool_index));
+}
+
+void suit_dfu_cache_index_slot_add(uintptr_t uri_address, size_t uri_len,
+				   uintptr_t payload_address, size_t payload_size)
+{
+	uint8_t uri_buf[CONFIG_SUIT_MAX_URI_LENGTH];
+	int pool_index;
+
+	if ((indexed_cache == NULL) || !index_valid) {
+		/* Picked up when the index is built */
+		return;
+	}
+
+	pool_index = pool_index_get(uri_address);
+	if (pool_index < 0) {
+		return;
+	}
+
+	if ((uri_len > sizeof(uri_buf)) ||
+	    (suit_dfu_cache_memcpy(uri_buf, uri_address, uri_len) != SUIT_PLAT_SUCCESS)) {
+		index_valid = false;
+		return;
+	}
+
+	entry_insert(pool_index, uri_hash(uri_buf, uri_len), uri_address, uri_len,
+		     payload_address, payload_size);
+}
+
+void suit_dfu_cache_index_invalidate(void)
+{
+	/* Removing entries from the open addressing table would break the probe sequences of
+	 * the remaining ones, so the whole index is built anew on the next search.
+	 */
+	index_valid = false;
+}
@@ -29,6 +29,7 @@ extern "C" {
  * @param cache_pool  Pointer to the SUIT cache pool structure.
  * @param state  zcbor state of the current slot.
  * @param uri  URI of the current slot
+ * @param uri_address  Address of the URI. May be located in external storage area.
  * @param payload_offset  Offset of the payload. May be located in external storage area.
  * @param payload_size  Size of the payload.
  * @param ctx  Additional callback context.
@@ -36,8 +37,8 @@ extern "C" {
  * @return True continues iteration, false causes the caller to stop subsequent iterations.
  */
 typedef bool (*partition_slot_foreach_cb)(struct dfu_cache_pool *cache_pool, zcbor_state_t *state,
-					  const struct zcbor_string *uri, uintptr_t payload_offset,
-					  size_t payload_size, void *ctx);
+					  const struct zcbor_string *uri, uintptr_t uri_address,
+					  uintptr_t payload_offset, size_t payload_size, void *ctx);
 
 /**
  * @brief Iterates over cache slots and executes a provided callback.
@@ -101,6 +102,59 @@ suit_plat_err_t suit_dfu_cache_partition_find_free_space(struct dfu_cache_pool *
  */
 suit_plat_err_t suit_dfu_cache_memcpy(uint8_t *destination, uintptr_t source, size_t size);
 
+#ifdef CONFIG_SUIT_CACHE_INDEX
+/**
+ * @brief Drop the cache index and index the cache pools anew on the next search.
+ *
+ * @param cache  Pointer to the SUIT cache structure to be indexed. The pointer is kept
+ *		 until the index is dropped again.
+ */
+void suit_dfu_cache_index_reset(struct dfu_cache *cache);
+
+/**
+ * @brief Search the cache index for a slot with a given URI.
+ *
+ * If several slots match, the one in the cache pool with the lowest index is returned.
+ * Cache pools with slots that did not fit in the index are not fully covered, so they
+ * have to be searched with @ref suit_dfu_cache_partition_slot_foreach, see
+ * @ref suit_dfu_cache_index_pool_is_complete.
+ *
+ * @param uri  URI to look for.
+ * @param pool_index  Index of the cache pool holding the slot, set to the number of cache
+ *		      pools if no slot was found.
+ * @param payload  Location and size of the slot payload.
+ *
+ * @return SUIT_PLAT_SUCCESS if a slot was found, SUIT_PLAT_ERR_NOT_FOUND otherwise
+ */
+suit_plat_err_t suit_dfu_cache_index_search(const struct zcbor_string *uri, size_t *pool_index,
+					    struct zcbor_string *payload);
+
+/**
+ * @brief Check if all slots of a cache pool are in the index.
+ *
+ * @param pool_index  Index of the cache pool.
+ *
+ * @return true if the index holds all slots of the cache pool.
+ */
+bool suit_dfu_cache_index_pool_is_complete(size_t pool_index);
+
+/**
+ * @brief Add a slot that was just closed to the cache index.
+ *
+ * @param uri_address  Address of the slot URI.
+ * @param uri_len  Length of the slot URI.
+ * @param payload_address  Address of the slot payload.
+ * @param payload_size  Size of the slot payload.
+ */
+void suit_dfu_cache_index_slot_add(uintptr_t uri_address, size_t uri_len,
+				   uintptr_t payload_address, size_t payload_size);
+
+/**
+ * @brief Mark the cache content as modified, so that it is indexed anew on the next search.
+ */
+void suit_dfu_cache_index_invalidate(void);
+#endif /* CONFIG_SUIT_CACHE_INDEX */
+
 #ifdef __cplusplus
 }
 #endif
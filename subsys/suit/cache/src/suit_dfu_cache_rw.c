@@ -170,6 +170,10 @@ static suit_plat_err_t erase_on_sink(uint8_t *address, size_t size)
 
 	LOG_DBG("Erasing memory: %p(size:%u)", (void *)address, size);
 
+#ifdef CONFIG_SUIT_CACHE_INDEX
+	suit_dfu_cache_index_invalidate();
+#endif
+
 	suit_plat_err_t ret = suit_flash_sink_get(&sink, address, size);
 
 	if (ret != SUIT_PLAT_SUCCESS) {
@@ -328,6 +332,8 @@ static suit_plat_err_t slot_in_cache_partition_allocate(const struct zcbor_strin
 		}
 
 		encoded_size = (size_t)states[0].payload - (size_t)output;
+		slot->uri_offset = encoded_size - uri->len;
+		slot->uri_len = uri->len;
 
 		/* 0x5A - byte string (four-byte uint32_t for n, and then n bytes follow) */
 		output[encoded_size++] = 0x5A;
@@ -646,6 +652,13 @@ suit_plat_err_t suit_dfu_cache_rw_slot_close(struct suit_cache_slot *slot, size_
 			return SUIT_PLAT_ERR_IO;
 		}
 
+#ifdef CONFIG_SUIT_CACHE_INDEX
+		suit_dfu_cache_index_slot_add((uintptr_t)slot->slot_address + slot->uri_offset,
+					      slot->uri_len,
+					      (uintptr_t)slot->slot_address + slot->data_offset,
+					      size_used);
+#endif
+
 		return SUIT_PLAT_SUCCESS;
 	}
 
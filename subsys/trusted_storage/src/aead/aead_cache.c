@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <mbedtls/platform_util.h>
+
+#include "aead_cache.h"
+
+#define INVALID_UID 0U
+
+struct cache_entry {
+	psa_storage_uid_t uid;
+	const char *prefix;
+	uint32_t last_used;
+	size_t data_size;
+	uint8_t data[CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_MAX_DATA_SIZE];
+};
+
+static struct cache_entry cache[CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE_SIZE];
+static uint32_t cache_uses;
+/* Incremented by every set and remove, so that data read before them is not cached */
+static uint32_t cache_generation;
+static K_MUTEX_DEFINE(cache_lock);
+
+static void cache_entry_clear(struct cache_entry *entry)
+{
+	mbedtls_platform_zeroize(entry, sizeof(*entry));
+}
+
+static struct cache_entry *cache_find(psa_storage_uid_t uid, const char *prefix)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache); i++) {
+		if (cache[i].uid == uid && !strcmp(cache[i].prefix, prefix)) {
+			return &cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+bool trusted_storage_cache_get(psa_storage_uid_t uid, const char *prefix, size_t data_offset,
+			       size_t data_length, void *p_data, size_t *p_data_length,
+			       psa_status_t *status)
+{
+	struct cache_entry *entry;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	entry = cache_find(uid, prefix);
+	if (entry == NULL) {
+		k_mutex_unlock(&cache_lock);
+		return false;
+	}
+
+	entry->last_used = ++cache_uses;
+
+	if (data_offset > entry->data_size) {
+		*p_data_length = 0;
+		*status = PSA_ERROR_INVALID_ARGUMENT;
+	} else {
+		*p_data_length = MIN(data_length, entry->data_size - data_offset);
+		memcpy(p_data, &entry->data[data_offset], *p_data_length);
+		*status = PSA_SUCCESS;
+	}
+
+	k_mutex_unlock(&cache_lock);
+	return true;
+}
+
+/* Must be called with the cache locked */
+static void cache_drop(psa_storage_uid_t uid, const char *prefix)
+{
+	struct cache_entry *entry;
+
+	entry = cache_find(uid, prefix);
+	if (entry != NULL) {
+		cache_entry_clear(entry);
+	}
+}
+
+uint32_t trusted_storage_cache_generation_get(void)
+{
+	uint32_t generation;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	generation = cache_generation;
+	k_mutex_unlock(&cache_lock);
+
+	return generation;
+}
+
+/* Must be called with the cache locked */
+static void cache_insert(psa_storage_uid_t uid, const char *prefix, const void *data,
+			 size_t data_size)
+{
+	struct cache_entry *entry;
+
+	entry = cache_find(uid, prefix);
+	if (entry == NULL) {
+		/* Use an empty entry, or evict the least recently used one */
+		entry = &cache[0];
+		for (size_t i = 0; i < ARRAY_SIZE(cache) && entry->uid != INVALID_UID; i++) {
+			if (cache[i].uid == INVALID_UID ||
+			    (int32_t)(cache[i].last_used - entry->last_used) < 0) {
+				entry = &cache[i];
+			}
+		}
+	}
+
+	cache_entry_clear(entry);
+	entry->uid = uid;
+	entry->prefix = prefix;
+	entry->last_used = ++cache_uses;
+	entry->data_size = data_size;
+	memcpy(entry->data, data, data_size);
+}
+
+void trusted_storage_cache_put(psa_storage_uid_t uid, const char *prefix, const void *data,
+			       size_t data_size)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	cache_generation++;
+
+	if (data_size > CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_MAX_DATA_SIZE) {
+		/* Do not keep the previous data of the object */
+		cache_drop(uid, prefix);
+	} else {
+		cache_insert(uid, prefix, data, data_size);
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
+
+void trusted_storage_cache_fill(psa_storage_uid_t uid, const char *prefix, const void *data,
+				size_t data_size, uint32_t generation)
+{
+	if (uid == INVALID_UID || data_size > CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_MAX_DATA_SIZE) {
+		return;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	if (generation == cache_generation) {
+		cache_insert(uid, prefix, data, data_size);
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
+
+void trusted_storage_cache_remove(psa_storage_uid_t uid, const char *prefix)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	cache_generation++;
+	cache_drop(uid, prefix);
+
+	k_mutex_unlock(&cache_lock);
+}
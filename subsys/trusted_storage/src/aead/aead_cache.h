@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef __TRUSTED_STORAGE_AEAD_CACHE_H_
+#define __TRUSTED_STORAGE_AEAD_CACHE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <psa/error.h>
+#include <psa/storage_common.h>
+
+/* Reads from a cached object. Returns false if the object is not cached. */
+bool trusted_storage_cache_get(psa_storage_uid_t uid, const char *prefix, size_t data_offset,
+			       size_t data_length, void *p_data, size_t *p_data_length,
+			       psa_status_t *status);
+
+/* Returns the number of changes made to the cache by set and remove, to be taken before
+ * reading an object from storage and given to trusted_storage_cache_fill().
+ */
+uint32_t trusted_storage_cache_generation_get(void);
+
+/* Adds the decrypted data of a written object to the cache, evicting the least recently
+ * used object. Call after the object has been written to storage.
+ */
+void trusted_storage_cache_put(psa_storage_uid_t uid, const char *prefix, const void *data,
+			       size_t data_size);
+
+/* Adds the decrypted data of an object read from storage to the cache, unless an object
+ * has been set or removed since the generation was taken, as the data may then be stale.
+ */
+void trusted_storage_cache_fill(psa_storage_uid_t uid, const char *prefix, const void *data,
+				size_t data_size, uint32_t generation);
+
+/* Removes an object from the cache. Call after the object has been removed from storage. */
+void trusted_storage_cache_remove(psa_storage_uid_t uid, const char *prefix);
+
+#endif /* __TRUSTED_STORAGE_AEAD_CACHE_H_ */
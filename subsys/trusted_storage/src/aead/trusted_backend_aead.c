@@ -16,6 +16,7 @@ LOG_MODULE_REGISTER(internal_trusted_aead, CONFIG_TRUSTED_STORAGE_LOG_LEVEL);
 #include "aead_key.h"
 #include "aead_nonce.h"
 #include "aead_crypt.h"
+#include "aead_cache.h"
 
 /*
  * AEAD based Authenticated Encrypted trust implementation
@@ -25,13 +26,38 @@ LOG_MODULE_REGISTER(internal_trusted_aead, CONFIG_TRUSTED_STORAGE_LOG_LEVEL);
  * - Flags+Size as additional parameter
  * - Nonce is a number that is incremented for each encryption.
  * - Tag is left at the end of output data
+ *
+ * With chunks, the data is encrypted in chunks of the chunk size, each followed by its tag.
+ * Chunks after the first are preceded by their own nonce, while the first chunk uses the
+ * object nonce. The chunk size is kept in the upper bits of the create flags, and the
+ * additional data of each chunk is the header, the object nonce and the chunk index.
  */
 
 #define AEAD_NONCE_SIZE 12
 #define AEAD_TAG_SIZE	16
 
 #define STORAGE_MAX_ASSET_SIZE CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_MAX_DATA_SIZE
-#define AEAD_MAX_BUF_SIZE      ROUND_UP(STORAGE_MAX_ASSET_SIZE + AEAD_TAG_SIZE, AEAD_TAG_SIZE)
+#define AEAD_CHUNK_SIZE	       CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CHUNK_SIZE
+
+#if AEAD_CHUNK_SIZE > 0
+#define AEAD_MAX_BUF_SIZE                                                                          \
+	MAX(ROUND_UP(STORAGE_MAX_ASSET_SIZE + AEAD_TAG_SIZE, AEAD_TAG_SIZE),                       \
+	    CHUNKED_DATA_SIZE(STORAGE_MAX_ASSET_SIZE, AEAD_CHUNK_SIZE))
+#else
+#define AEAD_MAX_BUF_SIZE ROUND_UP(STORAGE_MAX_ASSET_SIZE + AEAD_TAG_SIZE, AEAD_TAG_SIZE)
+#endif
+
+#define CHUNK_COUNT(data_size, chunk_size) MAX(DIV_ROUND_UP(data_size, chunk_size), 1)
+#define CHUNK_OFFSET(index, chunk_size)                                                            \
+	((index) * ((chunk_size) + AEAD_TAG_SIZE + AEAD_NONCE_SIZE))
+#define CHUNKED_DATA_SIZE(data_size, chunk_size)                                                   \
+	((data_size) + CHUNK_COUNT(data_size, chunk_size) * (AEAD_TAG_SIZE + AEAD_NONCE_SIZE) -    \
+	 AEAD_NONCE_SIZE)
+
+#define OBJECT_FLAGS_MASK	     0xFFFFU
+#define OBJECT_FLAGS_CHUNK_SIZE_POS 16U
+
+BUILD_ASSERT(AEAD_CHUNK_SIZE <= (UINT32_MAX >> OBJECT_FLAGS_CHUNK_SIZE_POS));
 
 #define INVALID_UID 0U
 
@@ -47,6 +73,99 @@ typedef struct stored_object {
 	uint8_t data[AEAD_MAX_BUF_SIZE];
 } stored_object;
 
+/** Additional data of each chunk of a stored object. */
+typedef struct chunk_additional_data {
+	stored_object_header header;
+	uint8_t nonce[AEAD_NONCE_SIZE];
+	uint32_t index;
+} chunk_additional_data;
+
+static void chunk_additional_data_init(chunk_additional_data *add,
+				       const stored_object *object_data, uint32_t index)
+{
+	memset(add, 0, sizeof(*add));
+	add->header = object_data->header;
+	memcpy(add->nonce, object_data->nonce, AEAD_NONCE_SIZE);
+	add->index = index;
+}
+
+/* Decrypts the chunks of an object that hold data between data_offset and data_end, and
+ * moves the decrypted data to the position it would have had in an object without chunks.
+ */
+static psa_status_t chunks_decrypt(const uint8_t *key_buf, stored_object *object_data,
+				   size_t stored_length, size_t data_offset, size_t data_end)
+{
+	psa_status_t status;
+	chunk_additional_data add;
+	size_t chunk_size = object_data->header.create_flags >> OBJECT_FLAGS_CHUNK_SIZE_POS;
+	size_t data_size = object_data->header.data_size;
+	size_t out_length;
+
+	if (data_size > STORAGE_MAX_ASSET_SIZE ||
+	    stored_length != CHUNKED_DATA_SIZE(data_size, chunk_size)) {
+		return PSA_ERROR_INVALID_SIGNATURE;
+	}
+
+	for (size_t i = data_offset / chunk_size; i < CHUNK_COUNT(data_end, chunk_size); i++) {
+		uint8_t *chunk = &object_data->data[CHUNK_OFFSET(i, chunk_size)];
+		const uint8_t *nonce = (i == 0) ? object_data->nonce : chunk - AEAD_NONCE_SIZE;
+		size_t chunk_len = MIN(chunk_size, data_size - i * chunk_size);
+
+		chunk_additional_data_init(&add, object_data, i);
+
+		status = trusted_storage_aead_decrypt(key_buf, AEAD_KEY_SIZE, nonce,
+						      AEAD_NONCE_SIZE, (void *)&add, sizeof(add),
+						      chunk, chunk_len + AEAD_TAG_SIZE, chunk,
+						      chunk_len, &out_length);
+		if (status != PSA_SUCCESS) {
+			return status;
+		}
+
+		if (out_length != chunk_len) {
+			return PSA_ERROR_INVALID_SIGNATURE;
+		}
+
+		memmove(&object_data->data[i * chunk_size], chunk, chunk_len);
+	}
+
+	return PSA_SUCCESS;
+}
+
+static psa_status_t chunks_encrypt(const uint8_t *key_buf, stored_object *object_data,
+				   const uint8_t *p_data, size_t chunk_size, size_t *stored_length)
+{
+	psa_status_t status;
+	chunk_additional_data add;
+	size_t data_size = object_data->header.data_size;
+	size_t out_length;
+
+	for (size_t i = 0; i < CHUNK_COUNT(data_size, chunk_size); i++) {
+		uint8_t *chunk = &object_data->data[CHUNK_OFFSET(i, chunk_size)];
+		uint8_t *nonce = (i == 0) ? object_data->nonce : chunk - AEAD_NONCE_SIZE;
+		size_t chunk_len = MIN(chunk_size, data_size - i * chunk_size);
+
+		if (i > 0) {
+			status = trusted_storage_get_nonce(nonce, AEAD_NONCE_SIZE);
+			if (status != PSA_SUCCESS) {
+				return status;
+			}
+		}
+
+		chunk_additional_data_init(&add, object_data, i);
+
+		status = trusted_storage_aead_encrypt(
+			key_buf, AEAD_KEY_SIZE, nonce, AEAD_NONCE_SIZE, (void *)&add, sizeof(add),
+			&p_data[i * chunk_size], chunk_len, chunk, chunk_len + AEAD_TAG_SIZE,
+			&out_length);
+		if (status != PSA_SUCCESS) {
+			return status;
+		}
+	}
+
+	*stored_length = CHUNKED_DATA_SIZE(data_size, chunk_size);
+	return PSA_SUCCESS;
+}
+
 psa_status_t trusted_get_info(const psa_storage_uid_t uid, const char *prefix,
 			      struct psa_storage_info_t *p_info)
 {
@@ -66,7 +185,7 @@ psa_status_t trusted_get_info(const psa_storage_uid_t uid, const char *prefix,
 
 	p_info->capacity = header.data_size;
 	p_info->size = header.data_size;
-	p_info->flags = header.create_flags;
+	p_info->flags = header.create_flags & OBJECT_FLAGS_MASK;
 
 	return PSA_SUCCESS;
 }
@@ -78,6 +197,7 @@ psa_status_t trusted_get(const psa_storage_uid_t uid, const char *prefix, size_t
 	uint8_t key_buf[AEAD_KEY_SIZE + 1];
 	size_t out_length;
 	stored_object object_data;
+	uint32_t cache_generation = 0;
 
 	if ((p_data == NULL && data_length != 0) || p_data_length == NULL || uid == INVALID_UID) {
 		return PSA_ERROR_INVALID_ARGUMENT;
@@ -92,6 +212,17 @@ psa_status_t trusted_get(const psa_storage_uid_t uid, const char *prefix, size_t
 		return PSA_ERROR_INVALID_ARGUMENT;
 	}
 
+	if (IS_ENABLED(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE) &&
+	    trusted_storage_cache_get(uid, prefix, data_offset, data_length, p_data,
+				      p_data_length, &status)) {
+		return status;
+	}
+
+	if (IS_ENABLED(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE)) {
+		/* The object read below is only cached if it is not set or removed meanwhile */
+		cache_generation = trusted_storage_cache_generation_get();
+	}
+
 	/* Get AEAD key */
 	status = trusted_storage_get_key(uid, key_buf, AEAD_KEY_SIZE);
 	if (status != PSA_SUCCESS) {
@@ -105,16 +236,38 @@ psa_status_t trusted_get(const psa_storage_uid_t uid, const char *prefix, size_t
 		return status;
 	}
 
-	status = trusted_storage_aead_decrypt(
-		key_buf, AEAD_KEY_SIZE, object_data.nonce, AEAD_NONCE_SIZE,
-		(void *)&object_data.header, sizeof(object_data.header), object_data.data,
-		out_length - offsetof(stored_object, data), object_data.data,
-		STORAGE_MAX_ASSET_SIZE, &out_length);
+	if (out_length < offsetof(stored_object, data)) {
+		status = PSA_ERROR_INVALID_SIGNATURE;
+		goto clean_up;
+	}
+
+	if ((object_data.header.create_flags >> OBJECT_FLAGS_CHUNK_SIZE_POS) != 0) {
+		size_t data_end = MIN(data_offset + data_length, object_data.header.data_size);
+
+		/* Only decrypt the chunks that are read */
+		status = chunks_decrypt(key_buf, &object_data,
+					out_length - offsetof(stored_object, data), data_offset,
+					data_end);
+		out_length = object_data.header.data_size;
+	} else {
+		status = trusted_storage_aead_decrypt(
+			key_buf, AEAD_KEY_SIZE, object_data.nonce, AEAD_NONCE_SIZE,
+			(void *)&object_data.header, sizeof(object_data.header), object_data.data,
+			out_length - offsetof(stored_object, data), object_data.data,
+			STORAGE_MAX_ASSET_SIZE, &out_length);
+	}
 
 	if (status != PSA_SUCCESS) {
 		goto clean_up;
 	}
 
+	if (IS_ENABLED(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE) &&
+	    (data_offset == 0 && data_length >= out_length)) {
+		/* All of the object has been decrypted */
+		trusted_storage_cache_fill(uid, prefix, object_data.data, out_length,
+					   cache_generation);
+	}
+
 	if (data_offset > out_length) {
 		*p_data_length = 0;
 		status = PSA_ERROR_INVALID_ARGUMENT;
@@ -187,10 +340,18 @@ psa_status_t trusted_set(const psa_storage_uid_t uid, const char *prefix, size_t
 	object_data.header.create_flags = create_flags;
 	object_data.header.data_size = data_length;
 
-	status = trusted_storage_aead_encrypt(key_buf, AEAD_KEY_SIZE, object_data.nonce,
-					      AEAD_NONCE_SIZE, (void *)&object_data.header,
-					      sizeof(object_data.header), p_data, data_length,
-					      object_data.data, AEAD_MAX_BUF_SIZE, &out_length);
+	if (AEAD_CHUNK_SIZE > 0) {
+		object_data.header.create_flags |= (uint32_t)AEAD_CHUNK_SIZE
+						   << OBJECT_FLAGS_CHUNK_SIZE_POS;
+		status = chunks_encrypt(key_buf, &object_data, p_data, AEAD_CHUNK_SIZE,
+					&out_length);
+	} else {
+		status = trusted_storage_aead_encrypt(key_buf, AEAD_KEY_SIZE, object_data.nonce,
+						      AEAD_NONCE_SIZE, (void *)&object_data.header,
+						      sizeof(object_data.header), p_data,
+						      data_length, object_data.data,
+						      AEAD_MAX_BUF_SIZE, &out_length);
+	}
 
 	mbedtls_platform_zeroize(key_buf, sizeof(key_buf));
 
@@ -205,6 +366,10 @@ psa_status_t trusted_set(const psa_storage_uid_t uid, const char *prefix, size_t
 		goto cleanup_objects;
 	}
 
+	if (IS_ENABLED(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE)) {
+		trusted_storage_cache_put(uid, prefix, p_data, data_length);
+	}
+
 	goto cleanup;
 
 cleanup_objects:
@@ -212,6 +377,10 @@ cleanup_objects:
 	LOG_DBG("trusted_set cleanup. status %d", status);
 	storage_remove_object(uid, prefix);
 
+	if (IS_ENABLED(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE)) {
+		trusted_storage_cache_remove(uid, prefix);
+	}
+
 cleanup:
 	mbedtls_platform_zeroize(&object_data, sizeof(object_data));
 
@@ -238,7 +407,14 @@ psa_status_t trusted_remove(const psa_storage_uid_t uid, const char *prefix)
 		return PSA_ERROR_NOT_PERMITTED;
 	}
 
-	return storage_remove_object(uid, prefix);
+	status = storage_remove_object(uid, prefix);
+
+	/* After the object is gone from storage, so that a concurrent get does not cache it */
+	if (IS_ENABLED(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE)) {
+		trusted_storage_cache_remove(uid, prefix);
+	}
+
+	return status;
 }
 
 uint32_t trusted_get_support(void)
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <app_event_manager.h>
+
+#define BENCH_EVENT_TYPES 50
+#define BENCH_LISTENERS   20
+#define BENCH_ROUNDS	  20
+
+#define BENCH_EVENT_CNT	  (BENCH_EVENT_TYPES * BENCH_ROUNDS)
+#define BENCH_NOTIFY_CNT  (BENCH_EVENT_CNT * BENCH_LISTENERS)
+#define BENCH_ROUND_NOTIFY_CNT (BENCH_EVENT_TYPES * BENCH_LISTENERS)
+
+static K_SEM_DEFINE(bench_round_sem, 0, 1);
+static uint32_t notify_cnt;
+
+#define BENCH_EVENT_DEFINE(i, _)							\
+	struct bench_event_##i {							\
+		struct app_event_header header;						\
+		uint32_t seq;								\
+	};										\
+	APP_EVENT_TYPE_DECLARE(bench_event_##i);					\
+	APP_EVENT_TYPE_DEFINE(bench_event_##i, NULL, NULL, APP_EVENT_FLAGS_CREATE());	\
+	static void bench_event_##i##_submit(uint32_t seq)				\
+	{										\
+		struct bench_event_##i *event = new_bench_event_##i();			\
+											\
+		event->seq = seq;							\
+		APP_EVENT_SUBMIT(event);						\
+	}
+
+LISTIFY(BENCH_EVENT_TYPES, BENCH_EVENT_DEFINE, ())
+
+#define BENCH_EVENT_SUBMIT_FN(i, _) bench_event_##i##_submit
+
+static void (*const bench_event_submit[])(uint32_t seq) = {
+	LISTIFY(BENCH_EVENT_TYPES, BENCH_EVENT_SUBMIT_FN, (,))
+};
+
+static bool bench_event_handler(const struct app_event_header *aeh)
+{
+	if ((++notify_cnt % BENCH_ROUND_NOTIFY_CNT) == 0) {
+		k_sem_give(&bench_round_sem);
+	}
+
+	return false;
+}
+
+/* Every listener is subscribed to every event type. */
+#define BENCH_SUBSCRIBE(i, lname) APP_EVENT_SUBSCRIBE(lname, bench_event_##i)
+
+#define BENCH_LISTENER_DEFINE(lname)						\
+	APP_EVENT_LISTENER(lname, bench_event_handler);				\
+	LISTIFY(BENCH_EVENT_TYPES, BENCH_SUBSCRIBE, (;), lname)
+
+BENCH_LISTENER_DEFINE(bench_listener_0);
+BENCH_LISTENER_DEFINE(bench_listener_1);
+BENCH_LISTENER_DEFINE(bench_listener_2);
+BENCH_LISTENER_DEFINE(bench_listener_3);
+BENCH_LISTENER_DEFINE(bench_listener_4);
+BENCH_LISTENER_DEFINE(bench_listener_5);
+BENCH_LISTENER_DEFINE(bench_listener_6);
+BENCH_LISTENER_DEFINE(bench_listener_7);
+BENCH_LISTENER_DEFINE(bench_listener_8);
+BENCH_LISTENER_DEFINE(bench_listener_9);
+BENCH_LISTENER_DEFINE(bench_listener_10);
+BENCH_LISTENER_DEFINE(bench_listener_11);
+BENCH_LISTENER_DEFINE(bench_listener_12);
+BENCH_LISTENER_DEFINE(bench_listener_13);
+BENCH_LISTENER_DEFINE(bench_listener_14);
+BENCH_LISTENER_DEFINE(bench_listener_15);
+BENCH_LISTENER_DEFINE(bench_listener_16);
+BENCH_LISTENER_DEFINE(bench_listener_17);
+BENCH_LISTENER_DEFINE(bench_listener_18);
+BENCH_LISTENER_DEFINE(bench_listener_19);
+
+static void *bench_setup(void)
+{
+	zassert_ok(app_event_manager_init(), "Error when initializing");
+
+	return NULL;
+}
+
+static uint32_t dispatch_cycles_get(void)
+{
+	uint32_t start;
+	int err;
+
+	notify_cnt = 0;
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS)) {
+		app_event_manager_listener_stats_reset();
+	}
+
+	start = k_cycle_get_32();
+
+	/* Every round is dispatched before the next one is submitted, so that the events of
+	 * a single round at most are allocated at the same time.
+	 */
+	for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+		for (size_t i = 0; i < ARRAY_SIZE(bench_event_submit); i++) {
+			bench_event_submit[i](round);
+		}
+
+		err = k_sem_take(&bench_round_sem, K_SECONDS(10));
+		zassert_ok(err, "Not all listeners were notified");
+	}
+
+	zassert_equal(notify_cnt, BENCH_NOTIFY_CNT, "Invalid number of notifications");
+
+	return k_cycle_get_32() - start;
+}
+
+static void dispatch_cycles_print(const char *name, uint32_t cycles)
+{
+	TC_PRINT("%s: %d event types, %d listeners: %u cycles per event, "
+		 "%u cycles per notification\n",
+		 name, BENCH_EVENT_TYPES, BENCH_LISTENERS, cycles / BENCH_EVENT_CNT,
+		 cycles / BENCH_NOTIFY_CNT);
+}
+
+ZTEST(app_event_manager_dispatch, test_dispatch)
+{
+	uint32_t cycles;
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_DISPATCH_BASELINE)
+	uint32_t baseline_cycles;
+
+	/* Measure the previous listener loop first, in the same build */
+	app_event_manager_dispatch_baseline_set(true);
+	baseline_cycles = dispatch_cycles_get();
+	app_event_manager_dispatch_baseline_set(false);
+
+	dispatch_cycles_print("baseline", baseline_cycles);
+#endif
+
+	cycles = dispatch_cycles_get();
+
+	dispatch_cycles_print("current", cycles);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_DISPATCH_BASELINE)
+	TC_PRINT("%d cycles per event less than the baseline\n",
+		 (int)(baseline_cycles / BENCH_EVENT_CNT) - (int)(cycles / BENCH_EVENT_CNT));
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS)
+	struct app_event_listener_stats stats;
+
+	app_event_manager_listener_stats_get(APP_EVENT_LISTENER_ID(bench_listener_0), &stats);
+
+	zassert_equal(stats.call_cnt, BENCH_EVENT_CNT, "Invalid number of listener calls");
+
+	TC_PRINT("bench_listener_0: avg %llu cycles, max %u cycles\n",
+		 stats.total_cycles / stats.call_cnt, stats.max_cycles);
+#endif
+}
+
+ZTEST_SUITE(app_event_manager_dispatch, NULL, bench_setup, NULL, NULL, NULL);
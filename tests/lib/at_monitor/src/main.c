@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <nrf_modem_at.h>
+
+#include <modem/at_monitor.h>
+
+/* at_monitor_dispatch() is implemented in the at_monitor library and
+ * called by the modem library for each AT notification.
+ */
+extern void at_monitor_dispatch(const char *notif);
+
+static K_SEM_DEFINE(work_sem, 0, 1);
+
+static int cereg_count;
+static int cereg_substring_count;
+static int battery_low_count;
+static int mdmev_count;
+static int any_count;
+static int isr_count;
+static int paused_count;
+
+AT_MONITOR(cereg_mon, "+CEREG", cereg_handler);
+AT_MONITOR(cereg_substring_mon, "CEREG", cereg_substring_handler);
+AT_MONITOR(battery_low_mon, "%MDMEV: ME BATTERY LOW", battery_low_handler);
+AT_MONITOR(mdmev_mon, "%MDMEV", mdmev_handler);
+AT_MONITOR(any_mon, ANY, any_handler);
+AT_MONITOR_ISR(isr_mon, "+CMT", isr_handler);
+AT_MONITOR(paused_mon, "+CSCON", paused_handler, PAUSED);
+
+int nrf_modem_at_notif_handler_set(nrf_modem_at_notif_handler_t callback)
+{
+	return 0;
+}
+
+static void cereg_handler(const char *notif)
+{
+	cereg_count++;
+}
+
+static void cereg_substring_handler(const char *notif)
+{
+	cereg_substring_count++;
+}
+
+static void battery_low_handler(const char *notif)
+{
+	battery_low_count++;
+}
+
+static void mdmev_handler(const char *notif)
+{
+	mdmev_count++;
+}
+
+static void any_handler(const char *notif)
+{
+	any_count++;
+	/* The wildcard monitor sees every notification that is copied to the heap */
+	k_sem_give(&work_sem);
+}
+
+static void isr_handler(const char *notif)
+{
+	isr_count++;
+}
+
+static void paused_handler(const char *notif)
+{
+	paused_count++;
+}
+
+static void dispatch(const char *notif)
+{
+	at_monitor_dispatch(notif);
+	zassert_ok(k_sem_take(&work_sem, K_SECONDS(1)), "Notification was not dispatched");
+}
+
+static void before(void *fixture)
+{
+	cereg_count = 0;
+	cereg_substring_count = 0;
+	battery_low_count = 0;
+	mdmev_count = 0;
+	any_count = 0;
+	isr_count = 0;
+	paused_count = 0;
+	at_monitor_pause(&paused_mon);
+	k_sem_reset(&work_sem);
+}
+
+ZTEST(at_monitor, test_prefix_match)
+{
+	dispatch("+CEREG: 5,\"76C1\",\"0102DA04\",7\r\n");
+
+	zassert_equal(cereg_count, 1);
+	zassert_equal(cereg_substring_count, 1);
+	zassert_equal(mdmev_count, 0);
+	zassert_equal(battery_low_count, 0);
+	zassert_equal(any_count, 1);
+}
+
+ZTEST(at_monitor, test_substring_match)
+{
+	dispatch("%MDMEV: ME BATTERY LOW\r\n");
+
+	zassert_equal(battery_low_count, 1);
+	zassert_equal(mdmev_count, 1);
+	zassert_equal(cereg_count, 0);
+
+	dispatch("%MDMEV: SEARCH STATUS 1\r\n");
+
+	zassert_equal(battery_low_count, 1);
+	zassert_equal(mdmev_count, 2);
+}
+
+ZTEST(at_monitor, test_no_match)
+{
+	dispatch("%XMODEMSLEEP: 1,10\r\n");
+
+	zassert_equal(cereg_count, 0);
+	zassert_equal(cereg_substring_count, 0);
+	zassert_equal(mdmev_count, 0);
+	zassert_equal(battery_low_count, 0);
+	zassert_equal(any_count, 1);
+}
+
+ZTEST(at_monitor, test_long_notification)
+{
+	/* Long notifications have most character pairs, the filters must still be searched */
+	dispatch("%NCELLMEAS: 0,\"0199F10A\",\"26295\",\"107E\",65535,5300,1,32,0,3344,"
+		 "5300,2,48,14,2,5300,3,60,30,4,6200,100,44,12,8,+CEREG\r\n");
+
+	zassert_equal(cereg_count, 1);
+	zassert_equal(cereg_substring_count, 1);
+	zassert_equal(mdmev_count, 0);
+}
+
+ZTEST(at_monitor, test_long_notification_no_match)
+{
+	dispatch("%XMONITOR: 1,\"Operator\",\"OP\",\"24491\",\"0401\",7,20,\"01A2B3C4\",7,6400,"
+		 "63,44,\"\",\"11100000\",\"11100000\",\"01001001\"\r\n");
+
+	zassert_equal(cereg_count, 0);
+	zassert_equal(cereg_substring_count, 0);
+	zassert_equal(mdmev_count, 0);
+	zassert_equal(battery_low_count, 0);
+	zassert_equal(any_count, 1);
+}
+
+ZTEST(at_monitor, test_isr_dispatch)
+{
+	at_monitor_dispatch("+CMT: \"+447911123456\",22\r\n");
+
+	/* Dispatched directly */
+	zassert_equal(isr_count, 1);
+
+	zassert_ok(k_sem_take(&work_sem, K_SECONDS(1)), "Notification was not dispatched");
+	zassert_equal(any_count, 1);
+}
+
+ZTEST(at_monitor, test_pause_resume)
+{
+	dispatch("+CSCON: 1\r\n");
+	zassert_equal(paused_count, 0);
+
+	at_monitor_resume(&paused_mon);
+
+	dispatch("+CSCON: 0\r\n");
+	zassert_equal(paused_count, 1);
+}
+
+ZTEST(at_monitor, test_benchmark_dispatch)
+{
+	static const char * const notifs[] = {
+		"%CESQ: 54,2,16,2\r\n",
+		"%XMODEMSLEEP: 1,10\r\n",
+		"+CEDRXP: 4,\"1000\",\"01.28\",\"00.64\"\r\n",
+		"%XT3412: 3240000\r\n",
+	};
+	uint32_t start;
+	uint32_t cycles;
+
+	/* With the wildcard monitor paused these are not copied to the heap, so only the
+	 * matching done in the ISR is timed.
+	 */
+	at_monitor_pause(&any_mon);
+
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < 1000; i++) {
+		at_monitor_dispatch(notifs[i % ARRAY_SIZE(notifs)]);
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	at_monitor_resume(&any_mon);
+
+	TC_PRINT("%u cycles per notification\n", cycles / 1000);
+}
+
+ZTEST_SUITE(at_monitor, NULL, NULL, before, NULL, NULL);
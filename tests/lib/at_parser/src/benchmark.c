@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <modem/at_parser.h>
+
+/* Modem responses with many values, read value by value as the libraries parsing them do. */
+static const char * const responses[] = {
+	/* Neighbor cell measurement with 20 neighbor cells. */
+	"%NCELLMEAS: 0,"
+	"\"00112233\",\"98712\",\"0AB9\",4800,7,63,31,456,4800,"
+	"333333,100,101,102,0,333333,103,104,105,0,"
+	"333333,106,107,108,0,333333,109,110,111,0,"
+	"444444,112,113,114,0,444444,115,116,117,0,"
+	"444444,118,119,120,0,444444,121,122,123,0,"
+	"555555,124,125,126,0,555555,127,128,129,0,"
+	"555555,130,131,132,0,555555,133,134,135,0,"
+	"666666,136,137,138,0,666666,139,140,141,0,"
+	"666666,142,143,144,0,666666,145,146,147,0,"
+	"777777,148,149,150,0,777777,151,152,153,0,"
+	"888888,154,155,156,0,888888,157,158,159,0,"
+	"11\r\n",
+	/* Neighbor cell measurement with GCI cells. */
+	"%NCELLMEAS: 0,"
+	"\"1FFFFFFF\",\"11199\",\"1A2B\",64,20877,6200,110,53,22,189205,1,0,"
+	"\"00567812\",\"11198\",\"3C4D\",65535,4,1300,75,53,16,189241,0,0,"
+	"\"0011AABB\",\"11297\",\"5E6F\",65534,5,2300,449,51,11,189245,0,0\r\n",
+	/* PDP context list. */
+	"+CGDCONT: 0,\"IP\",\"internet\",\"10.0.0.1\",0,0,0,0,0,0,0,0\r\n"
+	"+CGDCONT: 1,\"IPV4V6\",\"ims\",\"10.0.0.2 1050:0:0:0:5:600:300c:326b\",0,0,0,0,0,0,0,0\r\n"
+	"+CGDCONT: 2,\"IPV6\",\"sos\",\"1050:0:0:0:5:600:300c:326c\",0,0,0,0,0,0,0,0\r\n"
+	"OK\r\n",
+	/* Certificate listing. */
+	"%CMNG: 12345678, 0, \"978C...02C4\","
+	"\"-----BEGIN CERTIFICATE-----"
+	"MIIBc464..."
+	"...bW9aAa4"
+	"-----END CERTIFICATE-----\"\r\nERROR\r\n",
+};
+
+#define BENCH_ROUNDS 100
+
+/* Read all values of all lines of a response, in order or from the last value of each line to
+ * the first one, returning the number of values read.
+ */
+static size_t response_read(const char *response, bool reverse)
+{
+	struct at_parser parser;
+	const char *str;
+	size_t values = 0;
+	size_t count;
+	size_t len;
+	int ret;
+
+	ret = at_parser_init(&parser, response);
+	zassert_ok(ret);
+
+	do {
+		ret = at_parser_cmd_count_get(&parser, &count);
+		zassert_ok(ret);
+
+		for (size_t i = 0; i < count; i++) {
+			size_t index = reverse ? count - 1 - i : i;
+
+			ret = at_parser_string_ptr_get(&parser, index, &str, &len);
+			zassert_true(ret == 0 || ret == -EOPNOTSUPP, "Value %zu: %d", index, ret);
+			values++;
+		}
+	} while (at_parser_cmd_next(&parser) == 0);
+
+	return values;
+}
+
+static void benchmark_run(bool reverse)
+{
+	uint32_t start;
+	uint32_t cycles;
+	size_t values;
+
+	for (size_t i = 0; i < ARRAY_SIZE(responses); i++) {
+		values = 0;
+
+		start = k_cycle_get_32();
+
+		for (int round = 0; round < BENCH_ROUNDS; round++) {
+			values += response_read(responses[i], reverse);
+		}
+
+		cycles = k_cycle_get_32() - start;
+
+		TC_PRINT("Response %zu%s: %zu values, %u cycles per value\n", i,
+			 reverse ? " in reverse" : "", values / BENCH_ROUNDS,
+			 cycles / MAX(values, 1));
+	}
+
+	TC_PRINT("Token index %s, struct at_parser is %zu bytes\n",
+		 IS_ENABLED(CONFIG_AT_PARSER_TOKEN_INDEX) ? "enabled" : "disabled",
+		 sizeof(struct at_parser));
+}
+
+ZTEST(at_parser_benchmark, test_benchmark_read_in_order)
+{
+	benchmark_run(false);
+}
+
+ZTEST(at_parser_benchmark, test_benchmark_read_in_reverse)
+{
+	benchmark_run(true);
+}
+
+ZTEST_SUITE(at_parser_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -2033,4 +2033,30 @@ ZTEST(at_parser, test_at_parser_cmd_next)
 	zassert_equal(num, 6);
 }
 
+ZTEST(at_parser, test_at_parser_seek_back_after_empty)
+{
+	int ret;
+	struct at_parser parser;
+	int32_t num;
+
+	const char *str1 = "+CGEQOSRDP: 0,0,,\r\n"
+			   "OK\r\n";
+
+	ret = at_parser_init(&parser, str1);
+	zassert_ok(ret);
+
+	/* Parse up to the trailing empty subparameter. */
+	ret = at_parser_num_get(&parser, 3, &num);
+	zassert_equal(ret, -EOPNOTSUPP);
+
+	/* Seeking back must not be affected by the pending empty subparameter. */
+	ret = at_parser_num_get(&parser, 2, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 0);
+
+	ret = at_parser_num_get(&parser, 1, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 0);
+}
+
 ZTEST_SUITE(at_parser, NULL, NULL, NULL, NULL, NULL);
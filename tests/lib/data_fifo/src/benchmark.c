@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/irq_offload.h>
+#include <data_fifo.h>
+
+#define BENCH_BLOCKS_NUM  4
+#define BENCH_BLOCK_SIZE  128
+#define BENCH_ITERATIONS  1000
+
+DATA_FIFO_DEFINE(bench_fifo, BENCH_BLOCKS_NUM, BENCH_BLOCK_SIZE);
+#if CONFIG_DATA_FIFO_SPSC
+DATA_FIFO_SPSC_DEFINE(bench_fifo_spsc, BENCH_BLOCKS_NUM, BENCH_BLOCK_SIZE);
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
+static uint32_t isr_cycles;
+
+/* Producer side as done from the I2S ISR: get a vacant block and lock it */
+static void bench_isr_put(const void *param)
+{
+	struct data_fifo *data_fifo = (struct data_fifo *)param;
+	void *data;
+	uint32_t start = k_cycle_get_32();
+
+	(void)data_fifo_pointer_first_vacant_get(data_fifo, &data, K_NO_WAIT);
+	(void)data_fifo_block_lock(data_fifo, &data, BENCH_BLOCK_SIZE);
+
+	isr_cycles += k_cycle_get_32() - start;
+}
+
+static void bench_run(struct data_fifo *data_fifo, const char *name)
+{
+	int ret;
+	void *data;
+	size_t size;
+	uint32_t start;
+	uint32_t cycles;
+
+	ret = data_fifo_init(data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	/* Throughput: one block through the whole FIFO per iteration */
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		ret = data_fifo_pointer_first_vacant_get(data_fifo, &data, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+		ret = data_fifo_block_lock(data_fifo, &data, BENCH_BLOCK_SIZE);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+
+		ret = data_fifo_pointer_last_filled_get(data_fifo, &data, &size, K_NO_WAIT);
+		zassert_equal(ret, 0, "last_filled_get did not return 0");
+
+		data_fifo_block_free(data_fifo, data);
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	/* Latency of the producer side in ISR context */
+	isr_cycles = 0;
+
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		irq_offload(bench_isr_put, data_fifo);
+
+		ret = data_fifo_pointer_last_filled_get(data_fifo, &data, &size, K_NO_WAIT);
+		zassert_equal(ret, 0, "last_filled_get did not return 0");
+
+		data_fifo_block_free(data_fifo, data);
+	}
+
+	TC_PRINT("%s: %llu blocks/s, %u cycles per block, %u cycles in ISR\n", name,
+		 ((uint64_t)BENCH_ITERATIONS * sys_clock_hw_cycles_per_sec()) / MAX(cycles, 1),
+		 cycles / BENCH_ITERATIONS, isr_cycles / BENCH_ITERATIONS);
+
+	ret = data_fifo_uninit(data_fifo);
+	zassert_equal(ret, 0, "uninit did not return 0");
+}
+
+ZTEST(suite_data_fifo_benchmark, test_benchmark_msgq)
+{
+	bench_run(&bench_fifo, "slab and msgq");
+}
+
+#if CONFIG_DATA_FIFO_SPSC
+ZTEST(suite_data_fifo_benchmark, test_benchmark_spsc)
+{
+	bench_run(&bench_fifo_spsc, "spsc ring");
+}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
+ZTEST_SUITE(suite_data_fifo_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -231,4 +231,238 @@ ZTEST(suite_data_fifo, test_data_fifo_data_put_size_zero)
 	zassert_equal(ret, -EINVAL, "block_lock did not return -EINVAL");
 }
 
+#if CONFIG_DATA_FIFO_SPSC
+ZTEST(suite_data_fifo, test_data_fifo_spsc_put_get_ok)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+	uint8_t *data_ptr;
+	void *data_ptr_read;
+	size_t data_size;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	/* Go around the ring more than once */
+	for (uint32_t i = 0; i < 10; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+		data_ptr[0] = i;
+
+		internal_test_remaining_elements(&data_fifo, 1, 0, __LINE__);
+
+		ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, i + 1);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+
+		internal_test_remaining_elements(&data_fifo, 1, 1, __LINE__);
+
+		ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size,
+							K_NO_WAIT);
+		zassert_equal(ret, 0, "last_filled_get did not return 0");
+		zassert_equal(data_ptr_read, data_ptr, "wrong block returned");
+		zassert_equal(((uint8_t *)data_ptr_read)[0], i, "data contents are not identical");
+		zassert_equal(data_size, i + 1, "data size incorrect");
+
+		internal_test_remaining_elements(&data_fifo, 1, 0, __LINE__);
+
+		data_fifo_block_free(&data_fifo, data_ptr_read);
+
+		internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+	}
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size, K_NO_WAIT);
+	zassert_equal(ret, -ENOMSG, "last_filled_get did not return -ENOMSG");
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_put_too_many)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+	uint8_t *data_ptr;
+	void *data_ptr_read;
+	size_t data_size;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	for (uint32_t i = 0; i < 4; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+		ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, 1);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+	}
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "first_vacant_get did not return -ENOMEM");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_MSEC(1));
+	zassert_equal(ret, -EAGAIN, "first_vacant_get did not time out");
+
+	/* A read block is still in use until it is freed */
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size, K_NO_WAIT);
+	zassert_equal(ret, 0, "last_filled_get did not return 0");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "first_vacant_get did not return -ENOMEM");
+
+	data_fifo_block_free(&data_fifo, data_ptr_read);
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+	zassert_equal(data_ptr, data_ptr_read, "freed block was not reused");
+
+	ret = data_fifo_empty(&data_fifo);
+	zassert_equal(ret, 0, "empty did not return 0");
+
+	internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_counter_wrap)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+	uint8_t *data_ptr[3];
+	void *data_ptr_read;
+	size_t data_size;
+	const uint32_t start = UINT32_MAX - 5;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	/* Start the free running counters just before they wrap */
+	data_fifo.spsc.alloced = start;
+	data_fifo.spsc.read = start;
+	atomic_set(&data_fifo.spsc.locked, start);
+	atomic_set(&data_fifo.spsc.freed, start);
+
+	for (uint32_t i = 0; i < 12; i++) {
+		/* Keep several blocks in flight across the wrap */
+		for (uint32_t j = 0; j < ARRAY_SIZE(data_ptr); j++) {
+			ret = data_fifo_pointer_first_vacant_get(&data_fifo,
+								 (void **)&data_ptr[j], K_NO_WAIT);
+			zassert_equal(ret, 0, "first_vacant_get did not return 0");
+			for (uint32_t k = 0; k < j; k++) {
+				zassert_not_equal(data_ptr[j], data_ptr[k], "block given out twice");
+			}
+			data_ptr[j][0] = i * ARRAY_SIZE(data_ptr) + j;
+
+			ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr[j], j + 1);
+			zassert_equal(ret, 0, "block_lock did not return 0");
+		}
+
+		internal_test_remaining_elements(&data_fifo, 3, 3, __LINE__);
+
+		for (uint32_t j = 0; j < ARRAY_SIZE(data_ptr); j++) {
+			ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read,
+								&data_size, K_NO_WAIT);
+			zassert_equal(ret, 0, "last_filled_get did not return 0");
+			zassert_equal(data_ptr_read, data_ptr[j], "wrong block returned");
+			zassert_equal(((uint8_t *)data_ptr_read)[0], i * ARRAY_SIZE(data_ptr) + j,
+				      "data contents are not identical");
+			zassert_equal(data_size, j + 1, "data size incorrect");
+
+			data_fifo_block_free(&data_fifo, data_ptr_read);
+		}
+
+		internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+	}
+
+	zassert_true(data_fifo.spsc.alloced < start, "counters did not wrap");
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_init_not_power_of_two)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+
+	/* Not possible with DATA_FIFO_SPSC_DEFINE, which checks it at build time */
+	data_fifo.elements_max = 3;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, -EINVAL, "init did not return -EINVAL");
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_lock_out_of_order)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+	uint8_t *data_ptr_1;
+	uint8_t *data_ptr_2;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr_1, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr_2, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr_2, 1);
+	zassert_equal(ret, -EPERM, "block_lock did not return -EPERM");
+
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr_1, 1);
+	zassert_equal(ret, 0, "block_lock did not return 0");
+
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr_2, 1);
+	zassert_equal(ret, 0, "block_lock did not return 0");
+
+	internal_test_remaining_elements(&data_fifo, 2, 2, __LINE__);
+}
+
+#define SPSC_PRODUCER_STACK_SIZE 1024
+K_THREAD_STACK_DEFINE(spsc_producer_stack, SPSC_PRODUCER_STACK_SIZE);
+static struct k_thread spsc_producer_thread;
+
+DATA_FIFO_SPSC_DEFINE(spsc_wait_fifo, 4, 128);
+
+static void spsc_producer(void *arg1, void *arg2, void *arg3)
+{
+	int ret;
+	uint8_t *data_ptr;
+
+	k_msleep(5);
+
+	ret = data_fifo_pointer_first_vacant_get(&spsc_wait_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	data_ptr[0] = 0x5a;
+
+	ret = data_fifo_block_lock(&spsc_wait_fifo, (void **)&data_ptr, 1);
+	zassert_equal(ret, 0, "block_lock did not return 0");
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_get_wait)
+{
+	int ret;
+	void *data_ptr_read;
+	size_t data_size;
+
+	ret = data_fifo_init(&spsc_wait_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	k_thread_create(&spsc_producer_thread, spsc_producer_stack,
+			K_THREAD_STACK_SIZEOF(spsc_producer_stack), spsc_producer, NULL, NULL,
+			NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	ret = data_fifo_pointer_last_filled_get(&spsc_wait_fifo, &data_ptr_read, &data_size,
+						K_MSEC(1000));
+	zassert_equal(ret, 0, "last_filled_get did not return 0");
+	zassert_equal(((uint8_t *)data_ptr_read)[0], 0x5a, "data contents are not identical");
+
+	data_fifo_block_free(&spsc_wait_fifo, data_ptr_read);
+
+	k_thread_join(&spsc_producer_thread, K_FOREVER);
+
+	ret = data_fifo_uninit(&spsc_wait_fifo);
+	zassert_equal(ret, 0, "uninit did not return 0");
+}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 ZTEST_SUITE(suite_data_fifo, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <nrf_modem_os.h>
+#include <modem/nrf_modem_lib.h>
+
+/* Waiters sleeping on their own context each, as sockets do, and one on context 0. */
+#define WAITERS		 32
+#define WAITER_ANY	 WAITERS
+#define WAITER_CONTEXT(i) (0xC0DE0000 + (i))
+#define WAITER_NO_CONTEXT 0xC0DEFFFF
+#define WAITER_PRIO	 5
+#define WAITER_STACK_SIZE 512
+#define WAKE_DELAY	 K_MSEC(20)
+#define BENCH_ROUNDS	 100
+
+static K_THREAD_STACK_ARRAY_DEFINE(waiter_stacks, WAITERS + 1, WAITER_STACK_SIZE);
+static struct k_thread waiter_threads[WAITERS + 1];
+static atomic_t wakes[WAITERS + 1];
+
+static void waiter_fn(void *p1, void *p2, void *p3)
+{
+	uint32_t context = (uint32_t)(uintptr_t)p1;
+	atomic_t *wake_cnt = p2;
+	int32_t timeout;
+
+	while (true) {
+		timeout = SYS_FOREVER_MS;
+		if (nrf_modem_os_timedwait(context, &timeout) != 0) {
+			return;
+		}
+		atomic_inc(wake_cnt);
+	}
+}
+
+static void wakes_reset(void)
+{
+	/* The library does not let a thread sleep right away the first time it waits or
+	 * if there was an event since it last checked, let the waiters settle before counting.
+	 */
+	k_sleep(WAKE_DELAY);
+
+	for (size_t i = 0; i < ARRAY_SIZE(wakes); i++) {
+		atomic_clear(&wakes[i]);
+	}
+}
+
+static void *suite_setup(void)
+{
+	int err;
+
+	err = nrf_modem_lib_init();
+	zassert_ok(err, "Failed to initialize");
+
+	for (size_t i = 0; i <= WAITERS; i++) {
+		uint32_t context = (i == WAITER_ANY) ? 0 : WAITER_CONTEXT(i);
+
+		k_thread_create(&waiter_threads[i], waiter_stacks[i],
+				K_THREAD_STACK_SIZEOF(waiter_stacks[i]), waiter_fn,
+				(void *)(uintptr_t)context, &wakes[i], NULL, WAITER_PRIO, 0,
+				K_NO_WAIT);
+	}
+
+	return NULL;
+}
+
+static void suite_teardown(void *f)
+{
+	int err;
+
+	/* Shutting down wakes all waiters, which return. */
+	err = nrf_modem_lib_shutdown();
+	zassert_ok(err, NULL);
+
+	for (size_t i = 0; i <= WAITERS; i++) {
+		err = k_thread_join(&waiter_threads[i], K_SECONDS(1));
+		zassert_ok(err, "Waiter %zu did not return", i);
+	}
+}
+
+ZTEST(nrf_modem_os, test_notify_wakes_matching_context)
+{
+	for (size_t target = 0; target < WAITERS; target++) {
+		wakes_reset();
+
+		nrf_modem_os_event_notify(WAITER_CONTEXT(target));
+		k_sleep(WAKE_DELAY);
+
+		for (size_t i = 0; i < WAITERS; i++) {
+			zassert_equal(atomic_get(&wakes[i]), (i == target) ? 1 : 0,
+				      "Wrong wake ups of waiter %zu on notify of %zu", i, target);
+		}
+		zassert_equal(atomic_get(&wakes[WAITER_ANY]), 1,
+			      "Waiter on context 0 not woken on notify of %zu", target);
+	}
+}
+
+ZTEST(nrf_modem_os, test_notify_no_waiter)
+{
+	wakes_reset();
+
+	nrf_modem_os_event_notify(WAITER_NO_CONTEXT);
+	k_sleep(WAKE_DELAY);
+
+	for (size_t i = 0; i < WAITERS; i++) {
+		zassert_equal(atomic_get(&wakes[i]), 0, "Waiter %zu woken", i);
+	}
+	zassert_equal(atomic_get(&wakes[WAITER_ANY]), 1, "Waiter on context 0 not woken");
+}
+
+ZTEST(nrf_modem_os, test_notify_zero_wakes_all)
+{
+	wakes_reset();
+
+	nrf_modem_os_event_notify(0);
+	k_sleep(WAKE_DELAY);
+
+	for (size_t i = 0; i <= WAITERS; i++) {
+		zassert_equal(atomic_get(&wakes[i]), 1, "Waiter %zu not woken", i);
+	}
+}
+
+ZTEST(nrf_modem_os, test_benchmark_notify)
+{
+	uint32_t max_cycles[3] = {0};
+	uint32_t contexts[3] = {WAITER_NO_CONTEXT, WAITER_CONTEXT(0), 0};
+	uint32_t start;
+	uint32_t cycles;
+	unsigned int key;
+
+	for (size_t round = 0; round < BENCH_ROUNDS; round++) {
+		for (size_t i = 0; i < ARRAY_SIZE(contexts); i++) {
+			/* Let the woken waiters go back to sleep. */
+			k_sleep(K_MSEC(1));
+
+			/* The modem library notifies from its IPC interrupt handler, measure
+			 * the time spent with interrupts locked as it would be there.
+			 */
+			key = irq_lock();
+			start = k_cycle_get_32();
+			nrf_modem_os_event_notify(contexts[i]);
+			cycles = k_cycle_get_32() - start;
+			irq_unlock(key);
+
+			max_cycles[i] = MAX(max_cycles[i], cycles);
+		}
+	}
+
+	TC_PRINT("Notify with %u sleeping threads, worst case: %u cycles with no waiter, "
+		 "%u cycles with one waiter, %u cycles for all\n", WAITERS + 1, max_cycles[0],
+		 max_cycles[1], max_cycles[2]);
+}
+
+ZTEST_SUITE(nrf_modem_os, NULL, suite_setup, NULL, NULL, suite_teardown);
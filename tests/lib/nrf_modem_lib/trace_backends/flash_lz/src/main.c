@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <unity.h>
+#include <zephyr/kernel.h>
+
+#include "trace_lz.h"
+
+#define BLOCK_SIZE 1024
+
+static uint8_t block[BLOCK_SIZE];
+static uint8_t compressed[BLOCK_SIZE];
+static uint8_t decompressed[BLOCK_SIZE];
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+/* Fill the block with trace-like data: framed records with a few changing bytes. */
+static void trace_data_fill(uint8_t *buf, size_t len)
+{
+	static const uint8_t record[] = {
+		0xef, 0xbe, 0x0d, 0xf0, 0x10, 0x00, 0x01, 0x00,
+		0x2a, 0x00, 0x00, 0x00, 0x55, 0xaa, 0x00, 0x00,
+	};
+	uint32_t seq = 0;
+
+	for (size_t i = 0; i < len; i += sizeof(record)) {
+		size_t n = MIN(sizeof(record), len - i);
+
+		memcpy(&buf[i], record, n);
+		if (n > 11) {
+			memcpy(&buf[i + 8], &seq, sizeof(seq));
+		}
+		seq++;
+	}
+}
+
+/* Fill the block with pseudo-random data, which does not compress. */
+static void random_data_fill(uint8_t *buf, size_t len)
+{
+	uint32_t x = 0x12345678;
+
+	for (size_t i = 0; i < len; i++) {
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		buf[i] = x;
+	}
+}
+
+static void round_trip(const uint8_t *data, size_t len)
+{
+	size_t clen;
+	int dlen;
+
+	clen = trace_lz_compress(data, len, compressed, sizeof(compressed));
+	TEST_ASSERT_NOT_EQUAL(0, clen);
+
+	dlen = trace_lz_decompress(compressed, clen, decompressed, sizeof(decompressed));
+	TEST_ASSERT_EQUAL(len, dlen);
+	TEST_ASSERT_EQUAL_MEMORY(data, decompressed, len);
+}
+
+void test_trace_lz_round_trip_trace_data(void)
+{
+	trace_data_fill(block, sizeof(block));
+
+	round_trip(block, sizeof(block));
+}
+
+void test_trace_lz_round_trip_repeated(void)
+{
+	memset(block, 0xa5, sizeof(block));
+
+	round_trip(block, sizeof(block));
+	round_trip(block, 1);
+	round_trip(block, 3);
+}
+
+void test_trace_lz_round_trip_sizes(void)
+{
+	trace_data_fill(block, sizeof(block));
+
+	for (size_t len = 1; len < 100; len++) {
+		round_trip(block, len);
+	}
+}
+
+void test_trace_lz_compressed_is_smaller(void)
+{
+	size_t clen;
+
+	trace_data_fill(block, sizeof(block));
+
+	clen = trace_lz_compress(block, sizeof(block), compressed, sizeof(compressed));
+	TEST_ASSERT_NOT_EQUAL(0, clen);
+	TEST_ASSERT_LESS_THAN(sizeof(block) / 2, clen);
+}
+
+void test_trace_lz_incompressible(void)
+{
+	size_t clen;
+
+	random_data_fill(block, sizeof(block));
+
+	/* Random data does not fit in the size of the input. */
+	clen = trace_lz_compress(block, sizeof(block), compressed, sizeof(block) - 1);
+	TEST_ASSERT_EQUAL(0, clen);
+}
+
+void test_trace_lz_decompress_enomem(void)
+{
+	size_t clen;
+	int dlen;
+
+	trace_data_fill(block, sizeof(block));
+
+	clen = trace_lz_compress(block, sizeof(block), compressed, sizeof(compressed));
+	TEST_ASSERT_NOT_EQUAL(0, clen);
+
+	dlen = trace_lz_decompress(compressed, clen, decompressed, sizeof(block) - 1);
+	TEST_ASSERT_EQUAL(-ENOMEM, dlen);
+}
+
+void test_trace_lz_decompress_einval(void)
+{
+	/* Literal run longer than the input. */
+	static const uint8_t truncated_literal[] = { 0x05, 0x01, 0x02 };
+	/* Reference before the start of the output. */
+	static const uint8_t bad_reference[] = { 0x00, 0x01, 0x20, 0x05 };
+	/* Reference without its offset byte. */
+	static const uint8_t truncated_reference[] = { 0x00, 0x01, 0x20 };
+	int dlen;
+
+	dlen = trace_lz_decompress(truncated_literal, sizeof(truncated_literal), decompressed,
+				   sizeof(decompressed));
+	TEST_ASSERT_EQUAL(-EINVAL, dlen);
+
+	dlen = trace_lz_decompress(bad_reference, sizeof(bad_reference), decompressed,
+				   sizeof(decompressed));
+	TEST_ASSERT_EQUAL(-EINVAL, dlen);
+
+	dlen = trace_lz_decompress(truncated_reference, sizeof(truncated_reference), decompressed,
+				   sizeof(decompressed));
+	TEST_ASSERT_EQUAL(-EINVAL, dlen);
+}
+
+void test_trace_lz_benchmark(void)
+{
+	uint32_t start;
+	uint32_t compress_cycles;
+	uint32_t decompress_cycles;
+	size_t clen = 0;
+	const int rounds = 100;
+
+	trace_data_fill(block, sizeof(block));
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < rounds; i++) {
+		clen = trace_lz_compress(block, sizeof(block), compressed, sizeof(compressed));
+	}
+	compress_cycles = k_cycle_get_32() - start;
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < rounds; i++) {
+		(void)trace_lz_decompress(compressed, clen, decompressed, sizeof(decompressed));
+	}
+	decompress_cycles = k_cycle_get_32() - start;
+
+	printk("Ratio %u%%, compress %u cycles/block, decompress %u cycles/block\n",
+	       (unsigned int)(sizeof(block) * 100 / clen), compress_cycles / rounds,
+	       decompress_cycles / rounds);
+}
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <pcm_mix.h>
+
+/* 10 ms of 48 kHz stereo audio */
+#define BENCH_SAMPLES	   960
+#define BENCH_ITERATIONS   100
+
+/* Vectors from the functional tests, tiled to fill the benchmark buffers */
+static const int16_t vector_a[] = { 12, 1, 2, 3, -4, 2000, -2000, INT16_MAX, INT16_MIN, INT16_MIN };
+static const int16_t vector_b[] = { 12, 1, 2, -3, -4, 2000, -2000, 1, -1, 10 };
+
+static int16_t bench_a[BENCH_SAMPLES];
+static int16_t bench_b[BENCH_SAMPLES];
+static int16_t bench_ref[BENCH_SAMPLES];
+static int16_t bench_res[BENCH_SAMPLES];
+
+/* Sample by sample mixing, as done before the packed kernels were introduced */
+static void ref_mix_identical(int16_t *pcm_a, int16_t const *pcm_b, size_t samples)
+{
+	int32_t res;
+
+	for (uint32_t i = 0; i < samples; i++) {
+		res = pcm_a[i] + pcm_b[i];
+
+		if (res < INT16_MIN) {
+			res = INT16_MIN;
+		} else if (res > INT16_MAX) {
+			res = INT16_MAX;
+		}
+
+		pcm_a[i] = (int16_t)res;
+	}
+}
+
+static void bench_vectors_fill(void)
+{
+	for (int i = 0; i < BENCH_SAMPLES; i++) {
+		bench_a[i] = vector_a[i % ARRAY_SIZE(vector_a)];
+		bench_b[i] = vector_b[i % ARRAY_SIZE(vector_b)];
+	}
+}
+
+static uint32_t bench_run(bool reference, int16_t *out)
+{
+	uint32_t cycles = 0;
+	uint32_t start;
+
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		memcpy(out, bench_a, sizeof(bench_a));
+
+		start = k_cycle_get_32();
+
+		if (reference) {
+			ref_mix_identical(out, bench_b, BENCH_SAMPLES);
+		} else {
+			(void)pcm_mix(out, sizeof(bench_a), bench_b, sizeof(bench_b),
+				      B_STEREO_INTO_A_STEREO);
+		}
+
+		cycles += k_cycle_get_32() - start;
+	}
+
+	return cycles / BENCH_ITERATIONS;
+}
+
+ZTEST(suite_pcm_mix_benchmark, test_benchmark_identical)
+{
+	uint32_t cycles_ref;
+	uint32_t cycles_new;
+
+	bench_vectors_fill();
+
+	cycles_ref = bench_run(true, bench_ref);
+	cycles_new = bench_run(false, bench_res);
+
+	TC_PRINT("pcm_mix %d samples: reference %u cycles, packed %u cycles\n", BENCH_SAMPLES,
+		 cycles_ref, cycles_new);
+
+	zassert_mem_equal(bench_res, bench_ref, sizeof(bench_ref),
+			  "Packed kernel differs from the reference");
+}
+
+ZTEST_SUITE(suite_pcm_mix_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -127,4 +127,145 @@ ZTEST(suite_pcm_mix, test_mono_into_stereo_r)
 	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
 }
 
+ZTEST(suite_pcm_mix, test_high_values_odd_length)
+{
+	int ret;
+	int16_t sample_a[] = { INT16_MAX, 100, INT16_MIN, -100, 1 };
+	int16_t sample_b[] = { INT16_MAX, 200, -1, -200, INT16_MAX };
+	int16_t sample_r[] = { INT16_MAX, 300, INT16_MIN, -300, INT16_MAX };
+
+	pcm_mix_clip_count_reset();
+
+	ret = pcm_mix(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b), B_MONO_INTO_A_MONO);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+	ZEQ(pcm_mix_clip_count_get(), 3);
+}
+
+ZTEST(suite_pcm_mix, test_mono_into_stereo_lr_clip)
+{
+	int ret;
+	int16_t sample_a[] = { INT16_MAX, 0, INT16_MIN, 0 };
+	int16_t sample_b[] = { 10, -10 };
+	int16_t sample_r[] = { INT16_MAX, 10, INT16_MIN, -10 };
+
+	pcm_mix_clip_count_reset();
+
+	ret = pcm_mix(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+		      B_MONO_INTO_A_STEREO_LR);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+	ZEQ(pcm_mix_clip_count_get(), 2);
+}
+
+ZTEST(suite_pcm_mix, test_mono_into_stereo_l_too_large)
+{
+	int ret;
+	int16_t sample_a[] = { 10, 10 };
+	int16_t sample_b[] = { 1, 1 };
+	int16_t sample_r[] = { 10, 10 };
+
+	ret = pcm_mix(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+		      B_MONO_INTO_A_STEREO_L);
+	ZEQ(ret, -EPERM);
+
+	/* Buffer A must not be touched when the arguments are rejected */
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_s24_high_values)
+{
+	int ret;
+	int32_t sample_a[] = { 8388607, -8388608, 4000000, -100 };
+	int32_t sample_b[] = { 1, -1, 4388608, 100 };
+	int32_t sample_r[] = { 8388607, -8388608, 8388607, 0 };
+
+	pcm_mix_clip_count_reset();
+
+	ret = pcm_mix_fmt(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			  B_MONO_INTO_A_MONO, PCM_MIX_FORMAT_S24_32);
+	ZEQ(ret, 0);
+
+	for (int i = 0; i < ARRAY_SIZE(sample_r); i++) {
+		ZEQ(sample_a[i], sample_r[i]);
+	}
+
+	ZEQ(pcm_mix_clip_count_get(), 3);
+}
+
+ZTEST(suite_pcm_mix, test_s32_mono_into_stereo_r)
+{
+	int ret;
+	int32_t sample_a[] = { 10, INT32_MAX, 10, INT32_MIN };
+	int32_t sample_b[] = { 1, -1 };
+	int32_t sample_r[] = { 10, INT32_MAX, 10, INT32_MIN };
+
+	pcm_mix_clip_count_reset();
+
+	ret = pcm_mix_fmt(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			  B_MONO_INTO_A_STEREO_R, PCM_MIX_FORMAT_S32);
+	ZEQ(ret, 0);
+
+	for (int i = 0; i < ARRAY_SIZE(sample_r); i++) {
+		ZEQ(sample_a[i], sample_r[i]);
+	}
+
+	ZEQ(pcm_mix_clip_count_get(), 2);
+}
+
+ZTEST(suite_pcm_mix, test_mix_n_gain)
+{
+	int ret;
+	int16_t sample_a[] = { 100, -100, 1000, INT16_MAX };
+	int16_t sample_b[] = { 100, 100, -4000 };
+	int16_t sample_c[] = { 8, 8 };
+	int16_t sample_out[4];
+	int16_t sample_r[] = { 154, -46, -1000, INT16_MAX };
+	struct pcm_mix_input inputs[] = {
+		{ .pcm = sample_a, .size = sizeof(sample_a), .gain = PCM_MIX_GAIN_UNITY },
+		{ .pcm = sample_b, .size = sizeof(sample_b), .gain = PCM_MIX_GAIN_UNITY / 2 },
+		{ .pcm = sample_c, .size = sizeof(sample_c), .gain = PCM_MIX_GAIN_UNITY / 2 },
+		{ .pcm = NULL, .size = 0, .gain = PCM_MIX_GAIN_UNITY },
+	};
+
+	pcm_mix_clip_count_reset();
+
+	ret = pcm_mix_n(sample_out, sizeof(sample_out), inputs, ARRAY_SIZE(inputs),
+			PCM_MIX_FORMAT_S16);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_out, sample_r, ARRAY_SIZE(sample_r));
+	ZEQ(pcm_mix_clip_count_get(), 0);
+
+	/* Boosting the first input clips the last sample */
+	inputs[0].gain = PCM_MIX_GAIN_UNITY * 2;
+	ret = pcm_mix_n(sample_out, sizeof(sample_out), inputs, 1, PCM_MIX_FORMAT_S16);
+	ZEQ(ret, 0);
+	ZEQ(sample_out[3], INT16_MAX);
+	ZEQ(pcm_mix_clip_count_get(), 1);
+}
+
+ZTEST(suite_pcm_mix, test_mix_n_illegal_arguments)
+{
+	int ret;
+	int16_t sample_a[4];
+	int16_t sample_b[8] = { 0 };
+	struct pcm_mix_input input = {
+		.pcm = sample_b, .size = sizeof(sample_b), .gain = PCM_MIX_GAIN_UNITY
+	};
+
+	ret = pcm_mix_n(NULL, sizeof(sample_a), &input, 1, PCM_MIX_FORMAT_S16);
+	ZEQ(ret, -EINVAL);
+
+	ret = pcm_mix_n(sample_a, sizeof(sample_a), &input, CONFIG_PCM_MIX_INPUTS_MAX + 1,
+			PCM_MIX_FORMAT_S16);
+	ZEQ(ret, -EINVAL);
+
+	/* Input larger than the output */
+	ret = pcm_mix_n(sample_a, sizeof(sample_a), &input, 1, PCM_MIX_FORMAT_S16);
+	ZEQ(ret, -EPERM);
+}
+
 ZTEST_SUITE(suite_pcm_mix, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/tc_util.h>
+#include <sample_rate_converter.h>
+
+#define BENCH_BLOCKS 20
+
+struct bench_config {
+	const char *name;
+	enum sample_rate_converter_filter filter;
+	uint32_t input_sample_rate;
+	uint32_t output_sample_rate;
+	size_t input_samples;
+};
+
+static const struct bench_config bench_configs[] = {
+	{"simple 24 kHz -> 48 kHz", SAMPLE_RATE_FILTER_SIMPLE, 24000, 48000, 240},
+	{"simple 48 kHz -> 24 kHz", SAMPLE_RATE_FILTER_SIMPLE, 48000, 24000, 480},
+	{"polyphase 44.1 kHz -> 48 kHz", SAMPLE_RATE_FILTER_POLYPHASE, 44100, 48000, 441},
+	{"polyphase 48 kHz -> 44.1 kHz", SAMPLE_RATE_FILTER_POLYPHASE, 48000, 44100, 480},
+	{"farrow 44.1 kHz -> 48 kHz", SAMPLE_RATE_FILTER_FARROW, 44100, 48000, 441},
+	{"farrow 48 kHz -> 44.1 kHz", SAMPLE_RATE_FILTER_FARROW, 48000, 44100, 480},
+};
+
+static struct sample_rate_converter_ctx bench_ctx;
+static q15_t bench_input[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX];
+static q15_t bench_output[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX + 8];
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+ZTEST(suite_sample_rate_converter_benchmark, test_benchmark_cycles_per_sample)
+{
+	int ret;
+
+	for (int i = 0; i < ARRAY_SIZE(bench_input); i++) {
+		/* Triangle wave, to exercise the filters with a signal that is not constant */
+		bench_input[i] = (i % 64) < 32 ? (i % 32) * 1000 : (32 - (i % 32)) * 1000;
+	}
+
+	for (int c = 0; c < ARRAY_SIZE(bench_configs); c++) {
+		const struct bench_config *config = &bench_configs[c];
+		uint32_t cycles = 0;
+		size_t samples_out = 0;
+
+		sample_rate_converter_open(&bench_ctx);
+
+		for (int block = 0; block < BENCH_BLOCKS; block++) {
+			size_t output_written;
+			uint32_t start = k_cycle_get_32();
+
+			ret = sample_rate_converter_process(
+				&bench_ctx, config->filter, bench_input,
+				config->input_samples * sizeof(q15_t), config->input_sample_rate,
+				bench_output, sizeof(bench_output), &output_written,
+				config->output_sample_rate);
+
+			cycles += k_cycle_get_32() - start;
+
+			zassert_equal(ret, 0, "Process failed for %s (%d)", config->name, ret);
+			samples_out += output_written / sizeof(q15_t);
+		}
+
+		zassert_true(samples_out > 0, "No output for %s", config->name);
+
+		TC_PRINT("%s: %u cycles per output sample\n", config->name,
+			 cycles / samples_out);
+	}
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
+
+ZTEST_SUITE(suite_sample_rate_converter_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -1152,4 +1152,166 @@ ZTEST(suite_sample_rate_converter, test_invalid_process_output_buf_too_small)
 		      "Sample rate conversion process did not fail when output buffer is to small");
 }
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+#define FRAC_BLOCKS 10
+
+ZTEST(suite_sample_rate_converter, test_valid_process_frac_polyphase_44_1khz_to_48khz)
+{
+	int ret;
+
+	uint32_t input_sample_rate = 44100;
+	uint32_t output_sample_rate = 48000;
+
+	int16_t input_samples[441];
+	int16_t output_samples[482];
+	size_t output_written;
+	size_t total_output_samples = 0;
+
+	for (int i = 0; i < ARRAY_SIZE(input_samples); i++) {
+		input_samples[i] = 1000;
+	}
+
+	for (int block = 0; block < FRAC_BLOCKS; block++) {
+		ret = sample_rate_converter_process(
+			&conv_ctx, SAMPLE_RATE_FILTER_POLYPHASE, input_samples,
+			sizeof(input_samples), input_sample_rate, output_samples,
+			sizeof(output_samples), &output_written, output_sample_rate);
+
+		zassert_equal(ret, 0, "Sample rate conversion process failed");
+		zassert_equal(conv_ctx.conversion_ratio, 0, "Conversion ratio not as expected");
+
+		/* After the filter has settled, DC must pass through unchanged */
+		for (int i = 0; (block > 0) && (i < output_written / sizeof(int16_t)); i++) {
+			zassert_within(output_samples[i], 1000, 1, "Sample %d was %d", i,
+				       output_samples[i]);
+		}
+
+		total_output_samples += output_written / sizeof(int16_t);
+	}
+
+	zassert_within(total_output_samples, FRAC_BLOCKS * 480, 1,
+		       "Number of output samples not as expected (%d)", total_output_samples);
+}
+
+ZTEST(suite_sample_rate_converter, test_valid_process_frac_farrow_ramp)
+{
+	int ret;
+
+	uint32_t input_sample_rate = 48000;
+	uint32_t output_sample_rate = 44100;
+
+	int16_t input_samples[480];
+	int16_t output_samples[480];
+	size_t output_written;
+
+	for (int i = 0; i < ARRAY_SIZE(input_samples); i++) {
+		input_samples[i] = i * 10;
+	}
+
+	ret = sample_rate_converter_process(&conv_ctx, SAMPLE_RATE_FILTER_FARROW, input_samples,
+					    sizeof(input_samples), input_sample_rate,
+					    output_samples, sizeof(output_samples), &output_written,
+					    output_sample_rate);
+
+	zassert_equal(ret, 0, "Sample rate conversion process failed");
+
+	/* A cubic interpolator reproduces a ramp exactly. The output is delayed by two input
+	 * samples, so skip the samples that use the zeroed history.
+	 */
+	for (int i = 3; i < output_written / sizeof(int16_t); i++) {
+		uint64_t pos = (uint64_t)i * conv_ctx.frac.step;
+		int32_t expected = ((pos * 10) >> 32) - (2 * 10);
+
+		zassert_within(output_samples[i], expected, 1, "Sample %d was %d, expected %d", i,
+			       output_samples[i], expected);
+	}
+}
+
+ZTEST(suite_sample_rate_converter, test_valid_process_frac_drift)
+{
+	int ret;
+
+	uint32_t sample_rate = 48000;
+
+	int16_t input_samples[480] = {0};
+	int16_t output_samples[482];
+	size_t output_written;
+	size_t total_output_samples = 0;
+
+	ret = sample_rate_converter_drift_set(&conv_ctx, 1000);
+	zassert_equal(ret, 0, "Setting drift correction failed");
+
+	for (int block = 0; block < FRAC_BLOCKS; block++) {
+		ret = sample_rate_converter_process(
+			&conv_ctx, SAMPLE_RATE_FILTER_FARROW, input_samples, sizeof(input_samples),
+			sample_rate, output_samples, sizeof(output_samples), &output_written,
+			sample_rate);
+
+		zassert_equal(ret, 0, "Sample rate conversion process failed");
+		total_output_samples += output_written / sizeof(int16_t);
+	}
+
+	/* Consuming the input 1000 ppm faster gives about 4795 instead of 4800 output samples */
+	zassert_within(total_output_samples, 4796, 1,
+		       "Number of output samples not as expected (%d)", total_output_samples);
+
+	ret = sample_rate_converter_drift_set(&conv_ctx, SAMPLE_RATE_CONVERTER_DRIFT_PPM_MAX + 1);
+	zassert_equal(ret, -EINVAL, "Drift correction out of range did not fail");
+
+	ret = sample_rate_converter_drift_set(NULL, 0);
+	zassert_equal(ret, -EINVAL, "Drift correction with NULL context did not fail");
+}
+
+ZTEST(suite_sample_rate_converter, test_valid_process_frac_input_larger_than_block_size)
+{
+	int ret;
+
+	int16_t input_samples[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX + 20] = {0};
+	int16_t output_samples[ARRAY_SIZE(input_samples) * 9 / 8 + 1];
+	size_t output_written;
+
+	ret = sample_rate_converter_process(&conv_ctx, SAMPLE_RATE_FILTER_POLYPHASE, input_samples,
+					    sizeof(input_samples), 44100, output_samples,
+					    sizeof(output_samples), &output_written, 48000);
+
+	zassert_equal(ret, 0, "Sample rate conversion process failed");
+}
+
+ZTEST(suite_sample_rate_converter, test_invalid_process_frac_sample_rates)
+{
+	int ret;
+
+	int16_t input_samples[48] = {0};
+	int16_t output_samples[48];
+	size_t output_written;
+
+	ret = sample_rate_converter_process(&conv_ctx, SAMPLE_RATE_FILTER_POLYPHASE, input_samples,
+					    sizeof(input_samples), 48000, output_samples,
+					    sizeof(output_samples), &output_written, 16000);
+
+	zassert_equal(ret, -EINVAL, "Sample rate conversion process did not fail");
+
+	ret = sample_rate_converter_process(&conv_ctx, SAMPLE_RATE_FILTER_FARROW, input_samples,
+					    sizeof(input_samples), 0, output_samples,
+					    sizeof(output_samples), &output_written, 48000);
+
+	zassert_equal(ret, -EINVAL, "Sample rate conversion process did not fail");
+}
+
+ZTEST(suite_sample_rate_converter, test_invalid_process_frac_output_buf_too_small)
+{
+	int ret;
+
+	int16_t input_samples[441] = {0};
+	int16_t output_samples[441];
+	size_t output_written;
+
+	ret = sample_rate_converter_process(&conv_ctx, SAMPLE_RATE_FILTER_POLYPHASE, input_samples,
+					    sizeof(input_samples), 44100, output_samples,
+					    sizeof(output_samples), &output_written, 48000);
+
+	zassert_equal(ret, -EINVAL, "Sample rate conversion process did not fail");
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
+
 ZTEST_SUITE(suite_sample_rate_converter, NULL, NULL, test_setup, NULL, NULL);
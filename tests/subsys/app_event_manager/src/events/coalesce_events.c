@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "coalesce_events.h"
+
+APP_EVENT_TYPE_DEFINE(coalesce_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE());
+
+APP_EVENT_TYPE_DEFINE(merge_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE());
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING)
+static void merge_event_merge(struct app_event_header *pending,
+			      const struct app_event_header *aeh)
+{
+	struct merge_event *pending_event = cast_merge_event(pending);
+	const struct merge_event *event = cast_merge_event(aeh);
+
+	pending_event->sum += event->sum;
+	pending_event->cnt += event->cnt;
+}
+
+APP_EVENT_COALESCE_DEFINE(coalesce_event, NULL);
+APP_EVENT_COALESCE_DEFINE(merge_event, merge_event_merge);
+#endif
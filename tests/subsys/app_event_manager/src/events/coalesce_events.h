@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _COALESCE_EVENTS_H_
+#define _COALESCE_EVENTS_H_
+
+/**
+ * @brief Coalesce Events
+ * @defgroup coalesce_events Coalesce Events
+ * @{
+ */
+
+#include <app_event_manager.h>
+#include <app_event_manager_profiler_tracer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Event coalesced with the latest wins policy. */
+struct coalesce_event {
+	struct app_event_header header;
+
+	uint32_t val;
+};
+
+APP_EVENT_TYPE_DECLARE(coalesce_event);
+
+/* Event coalesced with a merge function summing the values. */
+struct merge_event {
+	struct app_event_header header;
+
+	uint32_t sum;
+	uint32_t cnt;
+};
+
+APP_EVENT_TYPE_DECLARE(merge_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _COALESCE_EVENTS_H_ */
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _PRIO_EVENTS_H_
+#define _PRIO_EVENTS_H_
+
+/**
+ * @brief Priority Events
+ * @defgroup prio_events Priority Events
+ * @{
+ */
+
+#include <app_event_manager.h>
+#include <app_event_manager_profiler_tracer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Event submitted in bursts, processed on the regular event queue. */
+struct bulk_event {
+	struct app_event_header header;
+
+	uint32_t seq;
+};
+
+APP_EVENT_TYPE_DECLARE(bulk_event);
+
+/* Latency-critical event defined with the high priority flag. */
+struct urgent_event {
+	struct app_event_header header;
+
+	uint32_t submit_cycles;
+};
+
+APP_EVENT_TYPE_DECLARE(urgent_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _PRIO_EVENTS_H_ */
@@ -7,11 +7,21 @@
 #include <zephyr/ztest.h>
 #include <app_event_manager.h>
 
+#include "coalesce_events.h"
+#include "pool_event.h"
 #include "sized_events.h"
 #include "test_events.h"
 
+/* Number of events submitted in a burst by the coalescing test. */
+#define COALESCE_EVENT_CNT 5
+
 static enum test_id cur_test_id;
 static K_SEM_DEFINE(test_end_sem, 0, 1);
+static K_SEM_DEFINE(pool_event_sem, 0, POOL_EVENT_POOL_SIZE + 1);
+static K_SEM_DEFINE(coalesce_event_sem, 0, COALESCE_EVENT_CNT);
+static uint32_t coalesce_event_val;
+static uint32_t merge_event_sum;
+static uint32_t merge_event_cnt;
 static bool expect_assert;
 
 
@@ -184,6 +194,135 @@ ZTEST(suite0, test_name_style_events_sorting)
 	test_start(TEST_NAME_STYLE_SORTING);
 }
 
+ZTEST(suite0, test_event_pools)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)) {
+		ztest_test_skip();
+		return;
+	}
+
+	struct pool_event *ev[POOL_EVENT_POOL_SIZE + 1];
+	struct app_event_pool_stats start_stats;
+	struct app_event_pool_stats stats;
+	int err;
+
+	err = app_event_manager_pool_stats_get(APP_EVENT_ID(pool_event), &start_stats);
+	zassert_ok(err, "Cannot get event pool statistics");
+	zassert_equal(start_stats.used, 0, "Event pool is not empty");
+
+	err = app_event_manager_pool_stats_get(APP_EVENT_ID(test_end_event), &stats);
+	zassert_equal(err, -ENOENT, "Unexpected event pool of test_end_event");
+
+	/* The last event does not fit into the pool and uses fallback allocator. */
+	for (size_t i = 0; i < ARRAY_SIZE(ev); i++) {
+		ev[i] = new_pool_event();
+		zassert_not_null(ev[i], "Event allocation failed");
+		ev[i]->val = i;
+	}
+
+	err = app_event_manager_pool_stats_get(APP_EVENT_ID(pool_event), &stats);
+	zassert_ok(err, "Cannot get event pool statistics");
+	zassert_equal(stats.used, POOL_EVENT_POOL_SIZE, "Invalid number of used blocks");
+	zassert_equal(stats.max_used, POOL_EVENT_POOL_SIZE, "Invalid high-water mark");
+	zassert_equal(stats.alloc_cnt - start_stats.alloc_cnt, POOL_EVENT_POOL_SIZE,
+		      "Invalid number of pool allocations");
+	zassert_equal(stats.fallback_cnt - start_stats.fallback_cnt, 1,
+		      "Invalid number of fallback allocations");
+
+	for (size_t i = 0; i < ARRAY_SIZE(ev); i++) {
+		APP_EVENT_SUBMIT(ev[i]);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(ev); i++) {
+		err = k_sem_take(&pool_event_sem, K_SECONDS(1));
+		zassert_ok(err, "Pool event was not processed");
+	}
+
+	/* Events are freed after all listeners are notified. */
+	k_sleep(K_MSEC(10));
+
+	err = app_event_manager_pool_stats_get(APP_EVENT_ID(pool_event), &stats);
+	zassert_ok(err, "Cannot get event pool statistics");
+	zassert_equal(stats.used, 0, "Events were not returned to the pool");
+
+	/* Events that are not submitted are returned to the pool on release. */
+	ev[0] = new_pool_event();
+	zassert_not_null(ev[0], "Event allocation failed");
+	app_event_manager_event_release(&ev[0]->header);
+
+	err = app_event_manager_pool_stats_get(APP_EVENT_ID(pool_event), &stats);
+	zassert_ok(err, "Cannot get event pool statistics");
+	zassert_equal(stats.used, 0, "Released event was not returned to the pool");
+}
+
+ZTEST(suite0, test_event_coalescing)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_COALESCING)) {
+		ztest_test_skip();
+		return;
+	}
+
+	struct app_event_coalesce_stats start_stats[2];
+	struct app_event_coalesce_stats stats;
+	int err;
+
+	err = app_event_manager_coalesce_stats_get(APP_EVENT_ID(coalesce_event), &start_stats[0]);
+	zassert_ok(err, "Cannot get coalescing statistics");
+	err = app_event_manager_coalesce_stats_get(APP_EVENT_ID(merge_event), &start_stats[1]);
+	zassert_ok(err, "Cannot get coalescing statistics");
+
+	err = app_event_manager_coalesce_stats_get(APP_EVENT_ID(test_end_event), &stats);
+	zassert_equal(err, -ENOENT, "Unexpected coalescing of test_end_event");
+
+	/* Prevent the event processing until the whole burst is submitted. */
+	k_sched_lock();
+
+	for (uint32_t i = 1; i <= COALESCE_EVENT_CNT; i++) {
+		struct coalesce_event *ce = new_coalesce_event();
+		struct merge_event *me = new_merge_event();
+
+		zassert_not_null(ce, "Event allocation failed");
+		zassert_not_null(me, "Event allocation failed");
+
+		ce->val = i;
+		me->sum = i;
+		me->cnt = 1;
+
+		APP_EVENT_SUBMIT(ce);
+		APP_EVENT_SUBMIT(me);
+	}
+
+	k_sched_unlock();
+
+	/* Both bursts are delivered as a single event each. */
+	for (size_t i = 0; i < 2; i++) {
+		err = k_sem_take(&coalesce_event_sem, K_SECONDS(1));
+		zassert_ok(err, "Coalesced event was not processed");
+	}
+
+	err = k_sem_take(&coalesce_event_sem, K_MSEC(100));
+	zassert_equal(err, -EAGAIN, "Events were not coalesced");
+
+	zassert_equal(coalesce_event_val, COALESCE_EVENT_CNT, "Latest value was not kept");
+	zassert_equal(merge_event_cnt, COALESCE_EVENT_CNT, "Events were not merged");
+	zassert_equal(merge_event_sum, COALESCE_EVENT_CNT * (COALESCE_EVENT_CNT + 1) / 2,
+		      "Events were not merged");
+
+	err = app_event_manager_coalesce_stats_get(APP_EVENT_ID(coalesce_event), &stats);
+	zassert_ok(err, "Cannot get coalescing statistics");
+	zassert_equal(stats.queued_cnt - start_stats[0].queued_cnt, 1,
+		      "Invalid number of queued events");
+	zassert_equal(stats.merged_cnt - start_stats[0].merged_cnt, COALESCE_EVENT_CNT - 1,
+		      "Invalid number of merged events");
+
+	err = app_event_manager_coalesce_stats_get(APP_EVENT_ID(merge_event), &stats);
+	zassert_ok(err, "Cannot get coalescing statistics");
+	zassert_equal(stats.queued_cnt - start_stats[1].queued_cnt, 1,
+		      "Invalid number of queued events");
+	zassert_equal(stats.merged_cnt - start_stats[1].merged_cnt, COALESCE_EVENT_CNT - 1,
+		      "Invalid number of merged events");
+}
+
 ZTEST_SUITE(suite0, NULL, test_init, NULL, NULL, NULL);
 
 static bool app_event_handler(const struct app_event_header *aeh)
@@ -199,9 +338,35 @@ static bool app_event_handler(const struct app_event_header *aeh)
 		return false;
 	}
 
+	if (is_pool_event(aeh)) {
+		k_sem_give(&pool_event_sem);
+
+		return false;
+	}
+
+	if (is_coalesce_event(aeh)) {
+		coalesce_event_val = cast_coalesce_event(aeh)->val;
+		k_sem_give(&coalesce_event_sem);
+
+		return false;
+	}
+
+	if (is_merge_event(aeh)) {
+		const struct merge_event *event = cast_merge_event(aeh);
+
+		merge_event_sum = event->sum;
+		merge_event_cnt = event->cnt;
+		k_sem_give(&coalesce_event_sem);
+
+		return false;
+	}
+
 	zassert_true(false, "Wrong event type received");
 	return false;
 }
 
 APP_EVENT_LISTENER(test_main, app_event_handler);
 APP_EVENT_SUBSCRIBE_FINAL(test_main, test_end_event);
+APP_EVENT_SUBSCRIBE(test_main, pool_event);
+APP_EVENT_SUBSCRIBE(test_main, coalesce_event);
+APP_EVENT_SUBSCRIBE(test_main, merge_event);
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "prio_events.h"
+
+#define MODULE test_prio
+
+/* Number of events in the burst of low priority events. */
+#define BULK_EVENT_CNT		20
+/* Time needed to process a single low priority event. */
+#define BULK_EVENT_PROC_TIME_US	500
+/* Sequence number of the low priority event that submits the urgent event. */
+#define URGENT_EVENT_SUBMIT_SEQ	2
+
+static K_SEM_DEFINE(urgent_sem, 0, 1);
+static K_SEM_DEFINE(bulk_done_sem, 0, 1);
+
+static uint32_t bulk_processed_cnt;
+static uint32_t bulk_processed_before_urgent;
+static uint32_t urgent_latency_cycles;
+
+static void urgent_submit(void)
+{
+	struct urgent_event *event = new_urgent_event();
+
+	event->submit_cycles = k_cycle_get_32();
+	APP_EVENT_SUBMIT(event);
+}
+
+ZTEST(suite0, test_prio_latency)
+{
+	int err;
+
+	bulk_processed_cnt = 0;
+
+	for (size_t i = 0; i < BULK_EVENT_CNT; i++) {
+		struct bulk_event *event = new_bulk_event();
+
+		event->seq = i;
+		APP_EVENT_SUBMIT(event);
+	}
+
+	err = k_sem_take(&urgent_sem, K_SECONDS(1));
+	zassert_ok(err, "Urgent event was not processed");
+
+	err = k_sem_take(&bulk_done_sem, K_SECONDS(1));
+	zassert_ok(err, "Bulk events were not processed");
+
+	uint32_t latency_us = k_cyc_to_us_floor32(urgent_latency_cycles);
+
+	TC_PRINT("Submit to handler latency: %u us (%u of %u bulk events processed before)\n",
+		 latency_us, bulk_processed_before_urgent, BULK_EVENT_CNT);
+
+	/* The latency depends on the scheduling of the host, so only the order is verified. */
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_QUEUE)) {
+		zassert_true(bulk_processed_before_urgent <= URGENT_EVENT_SUBMIT_SEQ + 1,
+			     "Urgent event was not prioritized");
+	} else {
+		zassert_equal(bulk_processed_before_urgent, BULK_EVENT_CNT,
+			      "Urgent event overtook the bulk events");
+	}
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_bulk_event(aeh)) {
+		/* Submit the urgent event while the burst is processed. */
+		if (cast_bulk_event(aeh)->seq == URGENT_EVENT_SUBMIT_SEQ) {
+			urgent_submit();
+		}
+
+		k_busy_wait(BULK_EVENT_PROC_TIME_US);
+
+		bulk_processed_cnt++;
+		if (bulk_processed_cnt == BULK_EVENT_CNT) {
+			k_sem_give(&bulk_done_sem);
+		}
+
+		return false;
+	}
+
+	if (is_urgent_event(aeh)) {
+		const struct urgent_event *event = cast_urgent_event(aeh);
+
+		urgent_latency_cycles = k_cycle_get_32() - event->submit_cycles;
+		bulk_processed_before_urgent = bulk_processed_cnt;
+		k_sem_give(&urgent_sem);
+
+		return false;
+	}
+
+	zassert_true(false, "Wrong event type received");
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, bulk_event);
+APP_EVENT_SUBSCRIBE(MODULE, urgent_event);
@@ -1039,6 +1039,7 @@ ZTEST(suite_audio_module_functional, test_data_rx_fnct)
 
 	data_msg_tx->audio_data.data = test_data;
 	data_msg_tx->audio_data.data_size = TEST_MOD_DATA_SIZE;
+	data_msg_tx->block = NULL;
 	data_msg_tx->tx_handle = NULL;
 	data_msg_tx->response_cb = NULL;
 
@@ -1058,6 +1059,7 @@ ZTEST(suite_audio_module_functional, test_data_rx_fnct)
 
 	data_msg_tx->audio_data.data = test_data;
 	data_msg_tx->audio_data.data_size = TEST_MOD_DATA_SIZE;
+	data_msg_tx->block = NULL;
 	data_msg_tx->tx_handle = NULL;
 	data_msg_tx->response_cb = NULL;
 
@@ -1077,6 +1079,7 @@ ZTEST(suite_audio_module_functional, test_data_rx_fnct)
 
 	data_msg_tx->audio_data.data = test_data;
 	data_msg_tx->audio_data.data_size = TEST_MOD_DATA_SIZE;
+	data_msg_tx->block = NULL;
 	data_msg_tx->tx_handle = NULL;
 	data_msg_tx->response_cb = NULL;
 
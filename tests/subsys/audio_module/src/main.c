@@ -23,3 +23,5 @@ static void run_before(void *fixture)
 
 ZTEST_SUITE(suite_audio_module_bad_param, NULL, NULL, run_before, NULL, NULL);
 ZTEST_SUITE(suite_audio_module_functional, NULL, NULL, run_before, NULL, NULL);
+ZTEST_SUITE(suite_audio_module_throughput, NULL, NULL, run_before, NULL, NULL);
+ZTEST_SUITE(suite_audio_module_stats, NULL, NULL, run_before, NULL, NULL);
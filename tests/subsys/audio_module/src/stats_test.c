@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/fff.h>
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include "audio_module/audio_module.h"
+
+#include "audio_module_test_fakes.h"
+#include "audio_module_test_common.h"
+
+#define TEST_STATS_MODULES_NUM (2)
+#define TEST_STATS_FRAMES_NUM  (20)
+#define TEST_STATS_TIMEOUT     (K_MSEC(100))
+
+K_THREAD_STACK_ARRAY_DEFINE(stats_stacks, TEST_STATS_MODULES_NUM, TEST_MOD_THREAD_STACK_SIZE);
+K_MEM_SLAB_DEFINE(stats_slab, TEST_MOD_DATA_SIZE, FAKE_FIFO_MSG_QUEUE_SIZE, 4);
+
+static K_SEM_DEFINE(stats_done_sem, 0, 1);
+
+static struct mod_context stats_context[TEST_STATS_MODULES_NUM];
+static struct mod_config stats_config = {
+	.test_int1 = 5, .test_int2 = 4, .test_int3 = 3, .test_int4 = 2};
+static struct data_fifo stats_fifo_rx[TEST_STATS_MODULES_NUM];
+static struct audio_module_handle stats_handles[TEST_STATS_MODULES_NUM];
+
+/**
+ * @brief Source module data process, copies the input audio data into the output audio data.
+ */
+static int stats_source_data_process(struct audio_module_handle_private *handle,
+				     struct audio_data const *const audio_data_rx,
+				     struct audio_data *audio_data_tx)
+{
+	ARG_UNUSED(handle);
+
+	memcpy(audio_data_tx->data, audio_data_rx->data, audio_data_rx->data_size);
+	audio_data_tx->data_size = audio_data_rx->data_size;
+	audio_data_tx->meta = audio_data_rx->meta;
+
+	return 0;
+}
+
+/**
+ * @brief Sink module data process, signals that the audio data has been received.
+ */
+static int stats_sink_data_process(struct audio_module_handle_private *handle,
+				   struct audio_data const *const audio_data_rx,
+				   struct audio_data *audio_data_tx)
+{
+	ARG_UNUSED(handle);
+	ARG_UNUSED(audio_data_rx);
+	ARG_UNUSED(audio_data_tx);
+
+	k_sem_give(&stats_done_sem);
+
+	return 0;
+}
+
+static const struct audio_module_functions stats_source_functions = {
+	.configuration_set = test_config_set_function,
+	.configuration_get = test_config_get_function,
+	.data_process = stats_source_data_process};
+static const struct audio_module_functions stats_sink_functions = {
+	.configuration_set = test_config_set_function,
+	.configuration_get = test_config_get_function,
+	.data_process = stats_sink_data_process};
+static struct audio_module_description stats_source_description = {
+	.name = "Stats source", .type = AUDIO_MODULE_TYPE_IN_OUT, .functions = &stats_source_functions};
+static struct audio_module_description stats_sink_description = {
+	.name = "Stats sink", .type = AUDIO_MODULE_TYPE_OUTPUT, .functions = &stats_sink_functions};
+
+/**
+ * @brief Set up the data FIFO fakes to behave as a working FIFO.
+ */
+static void stats_fakes_set(void)
+{
+	data_fifo_init_fake.custom_fake = fake_data_fifo_init__succeeds;
+	data_fifo_uninit_fake.custom_fake = fake_data_fifo_uninit__succeeds;
+	data_fifo_empty_fake.custom_fake = fake_data_fifo_empty__succeeds;
+	data_fifo_pointer_first_vacant_get_fake.custom_fake =
+		fake_data_fifo_pointer_first_vacant_get__succeeds;
+	data_fifo_block_lock_fake.custom_fake = fake_data_fifo_block_lock__succeeds;
+	data_fifo_pointer_last_filled_get_fake.custom_fake =
+		fake_data_fifo_pointer_last_filled_get__succeeds;
+	data_fifo_block_free_fake.custom_fake = fake_data_fifo_block_free__succeeds;
+	data_fifo_num_used_get_fake.custom_fake = fake_data_fifo_num_used_get__succeeds;
+	data_fifo_state_fake.custom_fake = fake_data_fifo_state__succeeds;
+}
+
+/**
+ * @brief Open and start the source module and a sink module connected to it.
+ */
+static void stats_pipeline_open(void)
+{
+	int ret;
+	struct audio_module_parameters parameters = {0};
+	struct audio_module_description *descriptions[TEST_STATS_MODULES_NUM] = {
+		&stats_source_description, &stats_sink_description};
+
+	fake_fifo_counter_reset();
+	k_sem_reset(&stats_done_sem);
+
+	for (int i = 0; i < TEST_STATS_MODULES_NUM; i++) {
+		ret = data_fifo_init(&stats_fifo_rx[i]);
+		zassert_equal(ret, 0, "Failed to initialise the RX data FIFO: ret %d", ret);
+
+		AUDIO_MODULE_PARAMETERS(parameters, descriptions[i], stats_stacks[i],
+					TEST_MOD_THREAD_STACK_SIZE, TEST_MOD_THREAD_PRIORITY,
+					&stats_fifo_rx[i], NULL, &stats_slab, TEST_MOD_DATA_SIZE);
+
+		ret = audio_module_open(&parameters,
+					(struct audio_module_configuration *)&stats_config,
+					descriptions[i]->name,
+					(struct audio_module_context *)&stats_context[i],
+					&stats_handles[i]);
+		zassert_equal(ret, 0, "Open function did not return successfully: ret %d", ret);
+
+		ret = audio_module_start(&stats_handles[i]);
+		zassert_equal(ret, 0, "Start function did not return successfully: ret %d", ret);
+	}
+
+	ret = audio_module_connect(&stats_handles[0], &stats_handles[1], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully: ret %d", ret);
+}
+
+/**
+ * @brief Stop and close the modules of the pipeline.
+ */
+static void stats_pipeline_close(void)
+{
+	int ret;
+
+	for (int i = 0; i < TEST_STATS_MODULES_NUM; i++) {
+		ret = audio_module_stop(&stats_handles[i]);
+		zassert_equal(ret, 0, "Stop function did not return successfully: ret %d", ret);
+
+		ret = audio_module_close(&stats_handles[i]);
+		zassert_equal(ret, 0, "Close function did not return successfully: ret %d", ret);
+	}
+}
+
+ZTEST(suite_audio_module_stats, test_stats_pipeline)
+{
+	int ret;
+	char test_data[TEST_MOD_DATA_SIZE] = {0};
+	struct audio_data audio_data = {.data = test_data, .data_size = sizeof(test_data)};
+	struct audio_module_stats stats;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_AUDIO_MODULE_STATS);
+
+	stats_fakes_set();
+	stats_pipeline_open();
+
+	for (int frame = 0; frame < TEST_STATS_FRAMES_NUM; frame++) {
+		ret = audio_module_data_tx(&stats_handles[0], &audio_data, NULL);
+		zassert_equal(ret, 0, "Data TX function did not return successfully: ret %d",
+			      ret);
+
+		ret = k_sem_take(&stats_done_sem, TEST_STATS_TIMEOUT);
+		zassert_equal(ret, 0, "Frame %d not received by the sink", frame);
+	}
+
+	/* Let the sink release the last audio data item. */
+	k_msleep(10);
+
+	for (int i = 0; i < TEST_STATS_MODULES_NUM; i++) {
+		ret = audio_module_stats_get(&stats_handles[i], &stats);
+		zassert_equal(ret, 0, "Stats get function did not return successfully: ret %d",
+			      ret);
+
+		zassert_equal(stats.blocks_processed, TEST_STATS_FRAMES_NUM,
+			      "Module %d processed %u blocks", i, stats.blocks_processed);
+		zassert_equal(stats.blocks_dropped, 0, "Module %d dropped %u blocks", i,
+			      stats.blocks_dropped);
+		zassert_equal(stats.latency_cnt, TEST_STATS_FRAMES_NUM,
+			      "Module %d has %u latency samples", i, stats.latency_cnt);
+		zassert_true(stats.latency_cycles_min <= stats.latency_cycles_max,
+			     "Module %d minimum latency above maximum", i);
+		zassert_true(stats.process_cycles_max <= stats.process_cycles_total,
+			     "Module %d maximum process cycles above total", i);
+		zassert_true(stats.rx_fifo_high_water >= 1, "Module %d RX FIFO high-water is 0",
+			     i);
+		zassert_equal(stats.tx_fifo_high_water, 0, "Module %d has no TX FIFO", i);
+	}
+
+	ret = audio_module_stats_get(&stats_handles[0], &stats);
+	zassert_equal(ret, 0, "Stats get function did not return successfully: ret %d", ret);
+	zassert_true(stats.data_slab_high_water >= 1, "Data slab high-water is 0");
+
+	ret = audio_module_stats_reset(&stats_handles[0]);
+	zassert_equal(ret, 0, "Stats reset function did not return successfully: ret %d", ret);
+
+	ret = audio_module_stats_get(&stats_handles[0], &stats);
+	zassert_equal(ret, 0, "Stats get function did not return successfully: ret %d", ret);
+	zassert_equal(stats.blocks_processed, 0, "Stats not reset");
+	zassert_equal(stats.latency_cnt, 0, "Stats not reset");
+	zassert_equal(stats.rx_fifo_high_water, 0, "Stats not reset");
+
+	stats_pipeline_close();
+}
+
+ZTEST(suite_audio_module_stats, test_stats_dropped)
+{
+	int ret;
+	char test_data[TEST_MOD_DATA_SIZE] = {0};
+	struct audio_data audio_data = {.data = test_data, .data_size = sizeof(test_data)};
+	struct audio_module_stats stats;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_AUDIO_MODULE_STATS);
+
+	stats_fakes_set();
+	stats_pipeline_open();
+
+	data_fifo_pointer_first_vacant_get_fake.custom_fake =
+		fake_data_fifo_pointer_first_vacant_get__no_wait_fails;
+
+	ret = audio_module_data_tx(&stats_handles[0], &audio_data, NULL);
+	zassert_equal(ret, -EAGAIN, "Data TX function did not fail: ret %d", ret);
+
+	ret = audio_module_stats_get(&stats_handles[0], &stats);
+	zassert_equal(ret, 0, "Stats get function did not return successfully: ret %d", ret);
+	zassert_equal(stats.blocks_dropped, 1, "Dropped %u blocks", stats.blocks_dropped);
+	zassert_equal(stats.blocks_processed, 0, "Processed %u blocks", stats.blocks_processed);
+
+	stats_pipeline_close();
+}
+
+ZTEST(suite_audio_module_stats, test_stats_disabled)
+{
+	int ret;
+	struct audio_module_stats stats;
+
+	Z_TEST_SKIP_IFDEF(CONFIG_AUDIO_MODULE_STATS);
+
+	ret = audio_module_stats_get(&stats_handles[0], &stats);
+	zassert_equal(ret, -ENOTSUP, "Stats get function did not return -ENOTSUP: ret %d", ret);
+
+	ret = audio_module_stats_reset(&stats_handles[0]);
+	zassert_equal(ret, -ENOTSUP, "Stats reset function did not return -ENOTSUP: ret %d",
+		      ret);
+}
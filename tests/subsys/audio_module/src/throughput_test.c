@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/fff.h>
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include "audio_module/audio_module.h"
+
+#include "audio_module_test_fakes.h"
+#include "audio_module_test_common.h"
+
+/* One fake FIFO is taken by the RX FIFO of the source module. */
+#define TEST_THROUGHPUT_DEST_NUM_MAX (FAKE_FIFO_NUM - 1)
+#define TEST_THROUGHPUT_FRAMES_NUM   (200)
+#define TEST_THROUGHPUT_TIMEOUT	     (K_MSEC(100))
+
+K_THREAD_STACK_ARRAY_DEFINE(throughput_stacks, TEST_THROUGHPUT_DEST_NUM_MAX + 1,
+			    TEST_MOD_THREAD_STACK_SIZE);
+K_MEM_SLAB_DEFINE(throughput_slab, TEST_MOD_DATA_SIZE, FAKE_FIFO_MSG_QUEUE_SIZE, 4);
+
+static K_SEM_DEFINE(frame_done_sem, 0, TEST_THROUGHPUT_DEST_NUM_MAX);
+
+static struct mod_context throughput_context[TEST_THROUGHPUT_DEST_NUM_MAX + 1];
+static struct mod_config throughput_config = {
+	.test_int1 = 5, .test_int2 = 4, .test_int3 = 3, .test_int4 = 2};
+static struct data_fifo throughput_fifo_rx[TEST_THROUGHPUT_DEST_NUM_MAX + 1];
+static struct audio_module_handle throughput_handles[TEST_THROUGHPUT_DEST_NUM_MAX + 1];
+
+/**
+ * @brief Source module data process, copies the input audio data into the output audio data.
+ */
+static int source_data_process(struct audio_module_handle_private *handle,
+			       struct audio_data const *const audio_data_rx,
+			       struct audio_data *audio_data_tx)
+{
+	ARG_UNUSED(handle);
+
+	memcpy(audio_data_tx->data, audio_data_rx->data, audio_data_rx->data_size);
+	audio_data_tx->data_size = audio_data_rx->data_size;
+	audio_data_tx->meta = audio_data_rx->meta;
+
+	return 0;
+}
+
+/**
+ * @brief Sink module data process, signals that the audio data has been received.
+ */
+static int sink_data_process(struct audio_module_handle_private *handle,
+			     struct audio_data const *const audio_data_rx,
+			     struct audio_data *audio_data_tx)
+{
+	ARG_UNUSED(handle);
+	ARG_UNUSED(audio_data_tx);
+
+	zassert_not_null(audio_data_rx->data, "Sink received NULL audio data");
+
+	k_sem_give(&frame_done_sem);
+
+	return 0;
+}
+
+static const struct audio_module_functions source_functions = {
+	.configuration_set = test_config_set_function,
+	.configuration_get = test_config_get_function,
+	.data_process = source_data_process};
+static const struct audio_module_functions sink_functions = {
+	.configuration_set = test_config_set_function,
+	.configuration_get = test_config_get_function,
+	.data_process = sink_data_process};
+static struct audio_module_description source_description = {
+	.name = "Throughput source", .type = AUDIO_MODULE_TYPE_IN_OUT, .functions = &source_functions};
+static struct audio_module_description sink_description = {
+	.name = "Throughput sink", .type = AUDIO_MODULE_TYPE_OUTPUT, .functions = &sink_functions};
+
+/**
+ * @brief Open and start a module of the throughput pipeline.
+ *
+ * @param idx          [in]  Index of the module in the pipeline, 0 for the source.
+ * @param description  [in]  Pointer to the module's description.
+ */
+static void throughput_module_open(int idx, struct audio_module_description *description)
+{
+	int ret;
+	char name[CONFIG_AUDIO_MODULE_NAME_SIZE];
+	struct audio_module_parameters parameters = {0};
+
+	ret = data_fifo_init(&throughput_fifo_rx[idx]);
+	zassert_equal(ret, 0, "Failed to initialise the RX data FIFO: ret %d", ret);
+
+	AUDIO_MODULE_PARAMETERS(parameters, description, throughput_stacks[idx],
+				TEST_MOD_THREAD_STACK_SIZE, TEST_MOD_THREAD_PRIORITY,
+				&throughput_fifo_rx[idx], NULL, &throughput_slab,
+				TEST_MOD_DATA_SIZE);
+
+	snprintf(name, sizeof(name), "Throughput %d", idx);
+
+	ret = audio_module_open(&parameters,
+				(struct audio_module_configuration *)&throughput_config, name,
+				(struct audio_module_context *)&throughput_context[idx],
+				&throughput_handles[idx]);
+	zassert_equal(ret, 0, "Open function did not return successfully: ret %d", ret);
+
+	ret = audio_module_start(&throughput_handles[idx]);
+	zassert_equal(ret, 0, "Start function did not return successfully: ret %d", ret);
+}
+
+/**
+ * @brief Close a module of the throughput pipeline.
+ *
+ * @param idx  [in]  Index of the module in the pipeline, 0 for the source.
+ */
+static void throughput_module_close(int idx)
+{
+	int ret;
+
+	ret = audio_module_stop(&throughput_handles[idx]);
+	zassert_equal(ret, 0, "Stop function did not return successfully: ret %d", ret);
+
+	ret = audio_module_close(&throughput_handles[idx]);
+	zassert_equal(ret, 0, "Close function did not return successfully: ret %d", ret);
+}
+
+/**
+ * @brief Measure the number of frames per second passed from a source module to a
+ *        number of sink modules.
+ *
+ * @param dest_num  [in]  Number of sink modules connected to the source module.
+ *
+ * @return Number of frames per second.
+ */
+static uint32_t throughput_measure(int dest_num)
+{
+	int ret;
+	char test_data[TEST_MOD_DATA_SIZE];
+	struct audio_data audio_data = {.data = test_data, .data_size = sizeof(test_data)};
+	uint32_t start;
+	uint64_t duration_us;
+
+	fake_fifo_counter_reset();
+	k_sem_reset(&frame_done_sem);
+
+	for (int i = 0; i < sizeof(test_data); i++) {
+		test_data[i] = i;
+	}
+
+	throughput_module_open(0, &source_description);
+
+	for (int i = 1; i <= dest_num; i++) {
+		throughput_module_open(i, &sink_description);
+
+		ret = audio_module_connect(&throughput_handles[0], &throughput_handles[i], false);
+		zassert_equal(ret, 0, "Connect function did not return successfully: ret %d", ret);
+	}
+
+	start = k_cycle_get_32();
+
+	for (int frame = 0; frame < TEST_THROUGHPUT_FRAMES_NUM; frame++) {
+		ret = audio_module_data_tx(&throughput_handles[0], &audio_data, NULL);
+		zassert_equal(ret, 0, "Data TX function did not return successfully: ret %d",
+			      ret);
+
+		for (int i = 0; i < dest_num; i++) {
+			ret = k_sem_take(&frame_done_sem, TEST_THROUGHPUT_TIMEOUT);
+			zassert_equal(ret, 0, "Frame %d not received by all the sinks", frame);
+		}
+	}
+
+	duration_us = k_cyc_to_us_ceil64(k_cycle_get_32() - start);
+
+	for (int i = 0; i <= dest_num; i++) {
+		throughput_module_close(i);
+	}
+
+	return (uint32_t)((TEST_THROUGHPUT_FRAMES_NUM * USEC_PER_SEC) / MAX(duration_us, 1));
+}
+
+ZTEST(suite_audio_module_throughput, test_throughput_vs_destinations)
+{
+	uint32_t frames_per_sec;
+
+	data_fifo_init_fake.custom_fake = fake_data_fifo_init__succeeds;
+	data_fifo_uninit_fake.custom_fake = fake_data_fifo_uninit__succeeds;
+	data_fifo_empty_fake.custom_fake = fake_data_fifo_empty__succeeds;
+	data_fifo_pointer_first_vacant_get_fake.custom_fake =
+		fake_data_fifo_pointer_first_vacant_get__succeeds;
+	data_fifo_block_lock_fake.custom_fake = fake_data_fifo_block_lock__succeeds;
+	data_fifo_pointer_last_filled_get_fake.custom_fake =
+		fake_data_fifo_pointer_last_filled_get__succeeds;
+	data_fifo_block_free_fake.custom_fake = fake_data_fifo_block_free__succeeds;
+	data_fifo_state_fake.custom_fake = fake_data_fifo_state__succeeds;
+
+	for (int dest_num = 1; dest_num <= TEST_THROUGHPUT_DEST_NUM_MAX; dest_num++) {
+		frames_per_sec = throughput_measure(dest_num);
+
+		TC_PRINT("Destinations: %d, throughput: %u frames/s\n", dest_num, frames_per_sec);
+
+		zassert_equal(k_mem_slab_num_used_get(&throughput_slab), 0,
+			      "Audio data blocks not released with %d destinations", dest_num);
+	}
+}
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/bluetooth/mesh.h>
+#include <mesh/net.h>
+#include <mesh/rpl.h>
+#include <emds/emds.h>
+
+#define STRESS_SOURCES	(CONFIG_BT_MESH_CRPL - 48)
+#define STRESS_ROUNDS	8
+
+static bool rx_check(uint16_t src, uint32_t seq, bool old_iv)
+{
+	struct bt_mesh_net_rx rx = {
+		.ctx.addr = src,
+		.seq = seq,
+		.old_iv = old_iv,
+		.net_if = BT_MESH_NET_IF_ADV,
+		.local_match = true,
+	};
+
+	return bt_mesh_rpl_check(&rx, NULL, false);
+}
+
+/* Source addresses spread over the unicast range in the same way as
+ * provisioners usually assign them, with some gaps for multi-element nodes.
+ */
+static uint16_t stress_src(size_t i)
+{
+	return 0x0001 + i * 3;
+}
+
+static struct emds_entry *rpl_emds_entry(void)
+{
+	STRUCT_SECTION_FOREACH(emds_entry, entry) {
+		if (entry->id == CONFIG_BT_MESH_RPL_INDEX) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+ZTEST(bt_mesh_rpl, test_replay)
+{
+	zassert_false(rx_check(0x0001, 10, false), "New source rejected");
+	zassert_true(rx_check(0x0001, 10, false), "Replay accepted");
+	zassert_true(rx_check(0x0001, 9, false), "Older message accepted");
+	zassert_false(rx_check(0x0001, 11, false), "Newer message rejected");
+
+	zassert_false(rx_check(0x0002, 10, false), "Second source rejected");
+	zassert_true(rx_check(0x0002, 10, false), "Replay accepted");
+	zassert_true(rx_check(0x0001, 11, false), "Replay accepted");
+}
+
+ZTEST(bt_mesh_rpl, test_not_checked)
+{
+	struct bt_mesh_net_rx rx = {
+		.ctx.addr = 0x0001,
+		.seq = 1,
+		.net_if = BT_MESH_NET_IF_LOCAL,
+		.local_match = true,
+	};
+
+	zassert_false(bt_mesh_rpl_check(&rx, NULL, false));
+	zassert_false(bt_mesh_rpl_check(&rx, NULL, false), "Local message stored");
+
+	rx.net_if = BT_MESH_NET_IF_ADV;
+	rx.local_match = false;
+	zassert_false(bt_mesh_rpl_check(&rx, NULL, false));
+	zassert_false(bt_mesh_rpl_check(&rx, NULL, false), "Relayed message stored");
+
+	zassert_false(bt_mesh_rpl_check(&rx, NULL, true));
+	zassert_true(bt_mesh_rpl_check(&rx, NULL, true), "Bridged replay accepted");
+}
+
+ZTEST(bt_mesh_rpl, test_match)
+{
+	struct bt_mesh_net_rx rx = {
+		.ctx.addr = 0x0010,
+		.seq = 5,
+		.net_if = BT_MESH_NET_IF_ADV,
+		.local_match = true,
+	};
+	struct bt_mesh_rpl *match = NULL;
+	struct bt_mesh_rpl *other = NULL;
+
+	zassert_false(bt_mesh_rpl_check(&rx, &match, false));
+	zassert_not_null(match);
+
+	/* The slot is only taken when it is updated */
+	zassert_false(bt_mesh_rpl_check(&rx, &other, false));
+	zassert_equal_ptr(match, other);
+	zassert_false(rx_check(0x0011, 1, false));
+	zassert_false(bt_mesh_rpl_check(&rx, &other, false));
+	zassert_not_equal(match, other);
+
+	bt_mesh_rpl_update(other, &rx);
+	zassert_true(bt_mesh_rpl_check(&rx, &match, false), "Replay accepted");
+	zassert_true(rx_check(0x0011, 1, false), "Replay accepted");
+
+	rx.seq++;
+	zassert_false(bt_mesh_rpl_check(&rx, &match, false));
+	zassert_equal_ptr(match, other);
+}
+
+ZTEST(bt_mesh_rpl, test_iv_update)
+{
+	zassert_false(rx_check(0x0001, 100, false));
+	zassert_true(rx_check(0x0001, 200, true), "Message on old IV index accepted");
+
+	zassert_false(rx_check(0x0002, 100, true));
+	zassert_false(rx_check(0x0002, 1, false), "Message on new IV index rejected");
+	zassert_true(rx_check(0x0002, 200, true), "Message on old IV index accepted");
+}
+
+ZTEST(bt_mesh_rpl, test_reset)
+{
+	zassert_false(rx_check(0x0001, 10, false));
+	zassert_false(rx_check(0x0002, 10, false));
+	zassert_false(rx_check(0x0003, 10, false));
+
+	/* All entries are now on the old IV index */
+	bt_mesh_rpl_reset();
+	zassert_true(rx_check(0x0002, 10, true), "Replay accepted");
+	zassert_false(rx_check(0x0002, 1, false));
+
+	/* Only the entry that got a message on the new IV index remains */
+	bt_mesh_rpl_reset();
+	zassert_false(rx_check(0x0001, 1, false), "Discarded entry kept");
+	zassert_false(rx_check(0x0003, 1, false), "Discarded entry kept");
+	zassert_true(rx_check(0x0002, 1, true), "Replay accepted");
+	zassert_true(rx_check(0x0001, 1, false), "Replay accepted");
+}
+
+ZTEST(bt_mesh_rpl, test_full)
+{
+	for (size_t i = 0; i < CONFIG_BT_MESH_CRPL; i++) {
+		zassert_false(rx_check(stress_src(i), 1, false));
+	}
+
+	zassert_true(rx_check(stress_src(CONFIG_BT_MESH_CRPL), 1, false),
+		     "Message accepted with full RPL");
+
+	for (size_t i = 0; i < CONFIG_BT_MESH_CRPL; i++) {
+		zassert_true(rx_check(stress_src(i), 1, false), "Replay accepted");
+		zassert_false(rx_check(stress_src(i), 2, false));
+	}
+
+	bt_mesh_rpl_clear();
+	zassert_false(rx_check(stress_src(CONFIG_BT_MESH_CRPL), 1, false));
+}
+
+ZTEST(bt_mesh_rpl, test_emds_restore)
+{
+	struct emds_entry *entry = rpl_emds_entry();
+	struct bt_mesh_rpl stored[3] = {
+		{ .src = 0x0100, .seq = 20 },
+		{ .src = 0x0200, .seq = 30, .old_iv = true },
+		{ .src = 0x0300, .seq = 40 },
+	};
+
+	zassert_not_null(entry);
+	zassert_true(entry->len >= sizeof(stored));
+
+	/* Restore the entries in the same way as emds_load() does */
+	memcpy(entry->data, stored, sizeof(stored));
+
+	zassert_true(rx_check(0x0300, 40, false), "Restored entry not found");
+	zassert_true(rx_check(0x0100, 20, false), "Restored entry not found");
+	zassert_true(rx_check(0x0200, 30, true), "Restored entry not found");
+	zassert_false(rx_check(0x0200, 1, false));
+	zassert_false(rx_check(0x0400, 1, false));
+	zassert_true(rx_check(0x0400, 1, false), "Replay accepted");
+}
+
+ZTEST(bt_mesh_rpl, test_stress)
+{
+	uint32_t start;
+	uint32_t cycles;
+	uint32_t packets = 0;
+
+	for (size_t i = 0; i < STRESS_SOURCES; i++) {
+		zassert_false(rx_check(stress_src(i), 0, false));
+	}
+
+	start = k_cycle_get_32();
+
+	for (uint32_t round = 1; round <= STRESS_ROUNDS; round++) {
+		for (size_t i = 0; i < STRESS_SOURCES; i++) {
+			/* Every message is heard twice, through different relays */
+			zassert_false(rx_check(stress_src(i), round, false));
+			zassert_true(rx_check(stress_src(i), round, false));
+			packets += 2;
+		}
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	TC_PRINT("%u packets from %u sources, %u cycles per packet\n", packets,
+		 STRESS_SOURCES, cycles / packets);
+}
+
+static void rpl_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	bt_mesh_rpl_clear();
+}
+
+ZTEST_SUITE(bt_mesh_rpl, NULL, NULL, rpl_before, NULL, NULL);
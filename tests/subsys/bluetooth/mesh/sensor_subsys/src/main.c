@@ -975,4 +975,93 @@ TEST_SENSOR_TYPE(rel_dev_runtime_in_a_generic_level_range, 0x0061,
 
 TEST_SENSOR_TYPE(total_dev_runtime, 0x006e, CHANNEL(time_hour_24, 3))
 
+ZTEST(sensor_types_test, test_type_get)
+{
+	const struct bt_mesh_sensor_type *prev = NULL;
+
+	/* bt_mesh_sensor_type_get() depends on the types being sorted by ID. */
+	STRUCT_SECTION_FOREACH(bt_mesh_sensor_type, type) {
+		if (prev) {
+			zassert_true(prev->id < type->id, "0x%04x linked after 0x%04x",
+				     type->id, prev->id);
+		}
+
+		prev = type;
+	}
+
+	for (uint32_t id = 0; id <= UINT16_MAX; id++) {
+		const struct bt_mesh_sensor_type *expected = NULL;
+
+		STRUCT_SECTION_FOREACH(bt_mesh_sensor_type, type) {
+			if (type->id == id) {
+				expected = type;
+				break;
+			}
+		}
+
+		zassert_equal_ptr(bt_mesh_sensor_type_get(id), expected,
+				  "Wrong type for 0x%04x", id);
+	}
+}
+
+#define STATUS_DECODE_MSGS 1000
+#define STATUS_MSG_MAXLEN 64
+
+ZTEST(sensor_types_test, test_status_decode_throughput)
+{
+	/* Sensor Status message from a multisensor device. */
+	const struct bt_mesh_sensor_type *sensors[] = {
+		&bt_mesh_sensor_present_amb_temp,
+		&bt_mesh_sensor_present_amb_rel_humidity,
+		&bt_mesh_sensor_present_amb_co2_concentration,
+		&bt_mesh_sensor_present_amb_voc_concentration,
+		&bt_mesh_sensor_present_amb_light_level,
+		&bt_mesh_sensor_air_pressure,
+		&bt_mesh_sensor_motion_sensed,
+		&bt_mesh_sensor_people_count,
+		&bt_mesh_sensor_present_input_voltage,
+		&bt_mesh_sensor_present_dev_input_power,
+		&bt_mesh_sensor_total_dev_runtime,
+	};
+	struct bt_mesh_sensor_value values[CONFIG_BT_MESH_SENSOR_CHANNELS_MAX];
+	uint32_t properties = 0;
+	uint32_t start;
+	uint32_t cycles;
+
+	NET_BUF_SIMPLE_DEFINE(msg, STATUS_MSG_MAXLEN);
+
+	for (int i = 0; i < ARRAY_SIZE(sensors); i++) {
+		uint8_t len = sensor_value_len(sensors[i]);
+
+		zassert_ok(sensor_status_id_encode(&msg, len, sensors[i]->id));
+		memset(net_buf_simple_add(&msg, len), 0, len);
+	}
+
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < STATUS_DECODE_MSGS; i++) {
+		struct net_buf_simple buf;
+
+		net_buf_simple_clone(&msg, &buf);
+
+		while (buf.len) {
+			const struct bt_mesh_sensor_type *type;
+			uint8_t len;
+			uint16_t id;
+
+			sensor_status_id_decode(&buf, &len, &id);
+			type = bt_mesh_sensor_type_get(id);
+			zassert_not_null(type);
+			zassert_ok(sensor_value_decode(&buf, type, values));
+			properties++;
+		}
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	zassert_equal(properties, STATUS_DECODE_MSGS * ARRAY_SIZE(sensors));
+	TC_PRINT("%u Sensor Status messages with %zu properties, %u cycles per message\n",
+		 STATUS_DECODE_MSGS, ARRAY_SIZE(sensors), cycles / STATUS_DECODE_MSGS);
+}
+
 ZTEST_SUITE(sensor_types_test, NULL, NULL, NULL, NULL, NULL);
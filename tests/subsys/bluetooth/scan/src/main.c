@@ -0,0 +1,451 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <bluetooth/scan.h>
+
+#define BENCH_ADVERTISERS 256
+#define BENCH_REPORTS	  4096
+#define BENCH_ADDR_FILTERS 16
+
+/** Mocks ******************************************/
+
+/* Mock bt_le_scan_cb_register to capture the callback from scan.c so that
+ * advertising reports can be fed to the module.
+ */
+static struct bt_le_scan_cb *scancb;
+int bt_le_scan_cb_register(struct bt_le_scan_cb *cb)
+{
+	scancb = cb;
+	return 0;
+}
+
+int bt_le_scan_start(const struct bt_le_scan_param *param, bt_le_scan_cb_t cb)
+{
+	return 0;
+}
+
+int bt_le_scan_stop(void)
+{
+	return 0;
+}
+
+void bt_data_parse(struct net_buf_simple *ad,
+		   bool (*func)(struct bt_data *data, void *user_data),
+		   void *user_data)
+{
+	while (ad->len > 1) {
+		struct bt_data data;
+		uint8_t len;
+
+		len = net_buf_simple_pull_u8(ad);
+		if ((len == 0) || (len > ad->len)) {
+			return;
+		}
+
+		data.type = net_buf_simple_pull_u8(ad);
+		data.data_len = len - 1;
+		data.data = ad->data;
+
+		if (!func(&data, user_data)) {
+			return;
+		}
+
+		net_buf_simple_pull(ad, len - 1);
+	}
+}
+
+/** End of mocks ***********************************/
+
+/* Advertising reports recorded from devices around a gateway. */
+
+/* Heart rate sensor: Heart Rate and Battery services, name and appearance. */
+static const uint8_t adv_hrs[] = {
+	0x02, BT_DATA_FLAGS, 0x06,
+	0x05, BT_DATA_UUID16_ALL, 0x0d, 0x18, 0x0f, 0x18,
+	0x0b, BT_DATA_NAME_COMPLETE, 'H', 'R', 'M', ' ', 'S', 'e', 'n', 's', 'o', 'r',
+	0x03, BT_DATA_GAP_APPEARANCE, 0x41, 0x03,
+};
+
+/* Nordic UART Service peripheral. */
+static const uint8_t adv_nus[] = {
+	0x02, BT_DATA_FLAGS, 0x06,
+	0x11, BT_DATA_UUID128_ALL, 0x9e, 0xca, 0xdc, 0x24, 0x0e, 0xe5, 0xa9, 0xe0,
+	0x93, 0xf3, 0xa3, 0xb5, 0x01, 0x00, 0x40, 0x6e,
+	0x0c, BT_DATA_NAME_COMPLETE, 'N', 'o', 'r', 'd', 'i', 'c', '_', 'U', 'A', 'R', 'T',
+};
+
+/* iBeacon. */
+static const uint8_t adv_ibeacon[] = {
+	0x02, BT_DATA_FLAGS, 0x06,
+	0x1a, BT_DATA_MANUFACTURER_DATA, 0x4c, 0x00, 0x02, 0x15,
+	0xe2, 0xc5, 0x6d, 0xb5, 0xdf, 0xfb, 0x48, 0xd2, 0xb0, 0x60, 0xd0, 0xf5, 0xa7, 0x10,
+	0x96, 0xe0, 0x00, 0x01, 0x00, 0x02, 0xc5,
+};
+
+/* Eddystone URL beacon. */
+static const uint8_t adv_eddystone[] = {
+	0x02, BT_DATA_FLAGS, 0x06,
+	0x03, BT_DATA_UUID16_ALL, 0xaa, 0xfe,
+	0x0e, BT_DATA_SVC_DATA16, 0xaa, 0xfe, 0x10, 0xeb, 0x03, 'n', 'o', 'r', 'd', 'i', 'c',
+	0x00,
+};
+
+/* Phone advertising manufacturer data only. */
+static const uint8_t adv_phone[] = {
+	0x02, BT_DATA_FLAGS, 0x1a,
+	0x17, BT_DATA_MANUFACTURER_DATA, 0x06, 0x00, 0x01, 0x09, 0x20, 0x02, 0x5a, 0x3c,
+	0x11, 0x8f, 0x67, 0x2d, 0x41, 0x88, 0x0c, 0x4e, 0x93, 0x7a, 0xd5, 0x01, 0x33, 0x16,
+};
+
+/* Keyboard with a shortened name. */
+static const uint8_t adv_keyboard[] = {
+	0x02, BT_DATA_FLAGS, 0x05,
+	0x03, BT_DATA_UUID16_SOME, 0x12, 0x18,
+	0x03, BT_DATA_GAP_APPEARANCE, 0xc1, 0x03,
+	0x08, BT_DATA_NAME_SHORTENED, 'N', 'o', 'r', 'd', 'i', 'c', '_',
+};
+
+/* Two lists with the same UUID and no name. */
+static const uint8_t adv_uuid_twice[] = {
+	0x03, BT_DATA_UUID16_SOME, 0x0d, 0x18,
+	0x03, BT_DATA_UUID16_SOME, 0x0d, 0x18,
+};
+
+static const struct {
+	const uint8_t *data;
+	size_t len;
+} recorded[] = {
+	{ adv_hrs, sizeof(adv_hrs) },
+	{ adv_nus, sizeof(adv_nus) },
+	{ adv_ibeacon, sizeof(adv_ibeacon) },
+	{ adv_eddystone, sizeof(adv_eddystone) },
+	{ adv_phone, sizeof(adv_phone) },
+	{ adv_keyboard, sizeof(adv_keyboard) },
+};
+
+static const struct bt_uuid_128 nus_uuid = BT_UUID_INIT_128(
+	BT_UUID_128_ENCODE(0x6e400001, 0xb5a3, 0xf393, 0xe0a9, 0xe50e24dcca9e));
+
+static struct bt_scan_filter_match last_match;
+static size_t match_cnt;
+static size_t no_match_cnt;
+
+static void scan_filter_match(struct bt_scan_device_info *device_info,
+			      struct bt_scan_filter_match *filter_match,
+			      bool connectable)
+{
+	last_match = *filter_match;
+	match_cnt++;
+}
+
+static void scan_filter_no_match(struct bt_scan_device_info *device_info,
+				 bool connectable)
+{
+	no_match_cnt++;
+}
+
+BT_SCAN_CB_INIT(test_scan_cb, scan_filter_match, scan_filter_no_match, NULL, NULL);
+
+static void addr_get(bt_addr_le_t *addr, uint16_t idx)
+{
+	addr->type = BT_ADDR_LE_RANDOM;
+	addr->a.val[0] = idx;
+	addr->a.val[1] = idx >> 8;
+	addr->a.val[2] = 0x5a;
+	addr->a.val[3] = 0x3c;
+	addr->a.val[4] = 0x11;
+	addr->a.val[5] = 0xc0;
+}
+
+static void report_send(const bt_addr_le_t *addr, const uint8_t *data, size_t len)
+{
+	struct bt_le_scan_recv_info info = {
+		.addr = addr,
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+	};
+	struct net_buf_simple ad;
+
+	net_buf_simple_init_with_data(&ad, (void *)data, len);
+	scancb->recv(&info, &ad);
+}
+
+static void recorded_send(uint16_t addr_idx, size_t report)
+{
+	bt_addr_le_t addr;
+
+	addr_get(&addr, addr_idx);
+	report_send(&addr, recorded[report].data, recorded[report].len);
+}
+
+static void *scan_setup(void)
+{
+	bt_scan_init(NULL);
+	bt_scan_cb_register(&test_scan_cb);
+
+	return NULL;
+}
+
+static void scan_before(void *f)
+{
+	bt_scan_filter_disable();
+	bt_scan_filter_remove_all();
+	bt_scan_blocklist_clear();
+
+	memset(&last_match, 0, sizeof(last_match));
+	match_cnt = 0;
+	no_match_cnt = 0;
+}
+
+ZTEST(bt_scan, test_name_filter)
+{
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Nordic_UART"));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_NAME_FILTER, false));
+
+	recorded_send(0, 0);
+	zassert_equal(match_cnt, 0, "Wrong name matched");
+
+	recorded_send(0, 1);
+	zassert_equal(match_cnt, 1, "Name not matched");
+	zassert_true(last_match.name.match);
+	zassert_mem_equal(last_match.name.name, "Nordic_UART", last_match.name.len);
+}
+
+ZTEST(bt_scan, test_short_name_filter)
+{
+	struct bt_scan_short_name short_name = {
+		.name = "Nordic_Keyboard",
+		.min_len = 7,
+	};
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_SHORT_NAME, &short_name));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_SHORT_NAME_FILTER, false));
+
+	recorded_send(0, 5);
+	zassert_equal(match_cnt, 1, "Shortened name not matched");
+	zassert_true(last_match.short_name.match);
+	zassert_equal(last_match.short_name.len, 7);
+}
+
+ZTEST(bt_scan, test_uuid_filter)
+{
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_DECLARE_16(0x180f)));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, &nus_uuid));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_UUID_FILTER, false));
+
+	recorded_send(0, 0);
+	zassert_equal(match_cnt, 1, "16-bit UUID not matched");
+	zassert_equal(last_match.uuid.count, 1);
+	zassert_equal(bt_uuid_cmp(last_match.uuid.uuid[0], BT_UUID_DECLARE_16(0x180f)), 0);
+
+	recorded_send(0, 1);
+	zassert_equal(match_cnt, 2, "128-bit UUID not matched");
+	zassert_equal(bt_uuid_cmp(last_match.uuid.uuid[0], &nus_uuid.uuid), 0);
+
+	recorded_send(0, 3);
+	zassert_equal(match_cnt, 2, "Wrong UUID matched");
+}
+
+ZTEST(bt_scan, test_uuid_filter_sizes)
+{
+	/* The Heart Rate service as a 128-bit UUID matches its 16-bit form. */
+	static const struct bt_uuid_128 hrs_uuid_128 = BT_UUID_INIT_128(
+		BT_UUID_128_ENCODE(0x0000180d, 0x0000, 0x1000, 0x8000, 0x00805f9b34fb));
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, &hrs_uuid_128));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_UUID_FILTER, false));
+
+	recorded_send(0, 0);
+	zassert_equal(match_cnt, 1, "UUID not matched across sizes");
+}
+
+ZTEST(bt_scan, test_uuid_filter_match_all)
+{
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_DECLARE_16(0x180d)));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_DECLARE_16(0x180f)));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_UUID_FILTER, true));
+
+	recorded_send(0, 0);
+	zassert_equal(match_cnt, 1, "UUIDs not matched");
+	zassert_equal(last_match.uuid.count, 2);
+
+	recorded_send(0, 5);
+	zassert_equal(match_cnt, 1, "Matched without all UUIDs");
+}
+
+ZTEST(bt_scan, test_appearance_filter)
+{
+	uint16_t appearance = 0x03c1;
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_APPEARANCE, &appearance));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_APPEARANCE_FILTER, false));
+
+	recorded_send(0, 0);
+	zassert_equal(match_cnt, 0, "Wrong appearance matched");
+
+	recorded_send(0, 5);
+	zassert_equal(match_cnt, 1, "Appearance not matched");
+	zassert_equal(*last_match.appearance.appearance, appearance);
+}
+
+ZTEST(bt_scan, test_manufacturer_data_filter)
+{
+	uint8_t ibeacon_prefix[] = { 0x4c, 0x00, 0x02, 0x15 };
+	struct bt_scan_manufacturer_data manufacturer_data = {
+		.data = ibeacon_prefix,
+		.data_len = sizeof(ibeacon_prefix),
+	};
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_MANUFACTURER_DATA,
+				      &manufacturer_data));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_MANUFACTURER_DATA_FILTER, false));
+
+	recorded_send(0, 4);
+	zassert_equal(match_cnt, 0, "Wrong manufacturer data matched");
+
+	recorded_send(0, 2);
+	zassert_equal(match_cnt, 1, "Manufacturer data not matched");
+}
+
+ZTEST(bt_scan, test_addr_filter)
+{
+	bt_addr_le_t addr;
+
+	for (uint16_t i = 0; i < CONFIG_BT_SCAN_ADDRESS_CNT; i++) {
+		addr_get(&addr, i * 3);
+		zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr));
+	}
+
+	addr_get(&addr, 1000);
+	zassert_equal(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr), -ENOMEM);
+
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_ADDR_FILTER, false));
+
+	for (uint16_t i = 0; i < CONFIG_BT_SCAN_ADDRESS_CNT * 3; i++) {
+		recorded_send(i, 4);
+	}
+
+	zassert_equal(match_cnt, CONFIG_BT_SCAN_ADDRESS_CNT);
+	zassert_equal(no_match_cnt, CONFIG_BT_SCAN_ADDRESS_CNT * 2);
+
+	addr_get(&addr, 9);
+	recorded_send(9, 4);
+	zassert_true(last_match.addr.match);
+	zassert_true(bt_addr_le_eq(last_match.addr.addr, &addr));
+}
+
+ZTEST(bt_scan, test_match_all_counts_each_filter_once)
+{
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "HRM Sensor"));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_DECLARE_16(0x180d)));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_NAME_FILTER | BT_SCAN_UUID_FILTER, true));
+
+	/* The UUID found twice does not make up for the missing name. */
+	report_send(&(bt_addr_le_t){0}, adv_uuid_twice, sizeof(adv_uuid_twice));
+	zassert_equal(match_cnt, 0, "Matched without the name");
+
+	recorded_send(0, 0);
+	zassert_equal(match_cnt, 1, "Name and UUID not matched");
+}
+
+ZTEST(bt_scan, test_match_all_addr_mismatch)
+{
+	bt_addr_le_t addr;
+
+	addr_get(&addr, 1);
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "HRM Sensor"));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_ADDR_FILTER | BT_SCAN_NAME_FILTER, true));
+
+	recorded_send(2, 0);
+	zassert_equal(match_cnt, 0, "Matched with another address");
+	zassert_equal(no_match_cnt, 1);
+
+	recorded_send(1, 0);
+	zassert_equal(match_cnt, 1, "Address and name not matched");
+}
+
+ZTEST(bt_scan, test_blocklist)
+{
+	bt_addr_le_t addr;
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "HRM Sensor"));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_NAME_FILTER, false));
+
+	addr_get(&addr, 7);
+	zassert_ok(bt_scan_blocklist_device_add(&addr));
+
+	recorded_send(7, 0);
+	zassert_equal(match_cnt + no_match_cnt, 0, "Blocked device reported");
+
+	recorded_send(8, 0);
+	zassert_equal(match_cnt, 1, "Device not on the blocklist not reported");
+
+	bt_scan_blocklist_clear();
+
+	recorded_send(7, 0);
+	zassert_equal(match_cnt, 2, "Device reported after clearing the blocklist");
+}
+
+ZTEST(bt_scan, test_benchmark_replay)
+{
+	bt_addr_le_t addr;
+	size_t expected_matches = 0;
+	uint32_t start;
+	uint32_t cycles;
+
+	for (uint16_t i = 0; i < BENCH_ADDR_FILTERS; i++) {
+		addr_get(&addr, i * (BENCH_ADVERTISERS / BENCH_ADDR_FILTERS));
+		zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr));
+	}
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Thingy"));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Nordic_UART"));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_DECLARE_16(0x180d)));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, &nus_uuid));
+
+	for (uint16_t i = 0; i < CONFIG_BT_SCAN_BLOCKLIST_LEN; i++) {
+		addr_get(&addr, BENCH_ADVERTISERS - 1 - i);
+		zassert_ok(bt_scan_blocklist_device_add(&addr));
+	}
+
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_ADDR_FILTER | BT_SCAN_NAME_FILTER |
+					 BT_SCAN_UUID_FILTER, false));
+
+	for (size_t i = 0; i < BENCH_REPORTS; i++) {
+		uint16_t advertiser = i % BENCH_ADVERTISERS;
+		size_t report = advertiser % ARRAY_SIZE(recorded);
+
+		if (advertiser >= (BENCH_ADVERTISERS - CONFIG_BT_SCAN_BLOCKLIST_LEN)) {
+			continue;
+		}
+
+		if (((advertiser % (BENCH_ADVERTISERS / BENCH_ADDR_FILTERS)) == 0) ||
+		    (recorded[report].data == adv_hrs) || (recorded[report].data == adv_nus)) {
+			expected_matches++;
+		}
+	}
+
+	start = k_cycle_get_32();
+
+	for (size_t i = 0; i < BENCH_REPORTS; i++) {
+		uint16_t advertiser = i % BENCH_ADVERTISERS;
+
+		recorded_send(advertiser, advertiser % ARRAY_SIZE(recorded));
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	zassert_equal(match_cnt, expected_matches, "Unexpected number of matches");
+
+	TC_PRINT("%u reports from %u advertisers: %u cycles per report, %zu matches\n",
+		 BENCH_REPORTS, BENCH_ADVERTISERS, cycles / BENCH_REPORTS, match_cnt);
+}
+
+ZTEST_SUITE(bt_scan, NULL, scan_setup, scan_before, NULL, NULL);
@@ -130,21 +130,38 @@ static void add_d_entries(void)
 {
 	int err;
 	int ate_size = align_size(sizeof(struct test_ate));
-	uint32_t store_expected =
-		DIV_ROUND_UP(sizeof(s_data), EMDS_FLASH_BLOCK_SIZE) * EMDS_FLASH_BLOCK_SIZE +
-		ate_size;
+	uint32_t store_expected;
+
+	if (IS_ENABLED(CONFIG_EMDS_BATCHED_WRITE)) {
+		/* All entries are stored in one record with a single allocation table entry */
+		store_expected = EMDS_FLASH_RECORD_HDR_SIZE + sizeof(s_data);
+	} else {
+		store_expected =
+			DIV_ROUND_UP(sizeof(s_data), EMDS_FLASH_BLOCK_SIZE) * EMDS_FLASH_BLOCK_SIZE +
+			ate_size;
+	}
 
 	for (int i = 0; i < ARRAY_SIZE(d_entries); i++) {
 		err = emds_entry_add(&d_entries[i]);
-		store_expected += DIV_ROUND_UP(d_entries[i].entry.len, EMDS_FLASH_BLOCK_SIZE) *
-				  EMDS_FLASH_BLOCK_SIZE;
-		store_expected += ate_size;
+		if (IS_ENABLED(CONFIG_EMDS_BATCHED_WRITE)) {
+			store_expected += EMDS_FLASH_RECORD_HDR_SIZE + d_entries[i].entry.len;
+		} else {
+			store_expected +=
+				DIV_ROUND_UP(d_entries[i].entry.len, EMDS_FLASH_BLOCK_SIZE) *
+				EMDS_FLASH_BLOCK_SIZE;
+			store_expected += ate_size;
+		}
 		zassert_equal(err, 0, "Add entry failed");
 
 		err = emds_entry_add(&d_entries[i]);
 		zassert_equal(err, -EINVAL, "Entry duplicated");
 	}
 
+	if (IS_ENABLED(CONFIG_EMDS_BATCHED_WRITE)) {
+		store_expected = DIV_ROUND_UP(store_expected, EMDS_FLASH_BLOCK_SIZE) *
+				 EMDS_FLASH_BLOCK_SIZE + ate_size;
+	}
+
 	uint32_t store_used = emds_store_size_get();
 
 	zassert_equal(store_used, store_expected, "Wrong storage size: expected: %i, got: %i",
@@ -27,6 +27,7 @@
 #endif
 
 #define ADDR_OFFS_MASK 0x0000FFFF
+#define WRITE_SPEED_ENTRIES 16
 
 static struct {
 	const struct device *fd;
@@ -629,6 +630,120 @@ ZTEST(emds_flash_tests, test_corrupted_data)
 				     "Should not be able to read");
 }
 
+ZTEST(emds_flash_tests, test_record_rd_wr)
+{
+	char data_in1[9] = "Deadbeef";
+	char data_in2[3] = "Be";
+	char data_in3[13] = "Deadbeefface";
+	char data_out[32] = {0};
+	size_t len = 3 * EMDS_FLASH_RECORD_HDR_SIZE + sizeof(data_in1) + sizeof(data_in2) +
+		     sizeof(data_in3);
+
+	flash_clear();
+	device_reset();
+
+	zassert_false(emds_flash_init(&ctx), "Error when initializing");
+	zassert_false(emds_flash_prepare(&ctx, align_size(len) + ctx.ate_size), "Prepare failed");
+	zassert_false(emds_flash_record_prepare(&ctx, len + ctx.ate_size), "Prepare failed");
+
+	zassert_equal(emds_flash_record_write(&ctx, 1, data_in1, sizeof(data_in1)),
+		      sizeof(data_in1), "Error when write");
+	zassert_equal(emds_flash_record_write(&ctx, 2, data_in2, sizeof(data_in2)),
+		      sizeof(data_in2), "Error when write");
+
+	/* The entries are not readable before the record is complete */
+	zassert_equal(emds_flash_read(&ctx, 1, data_out, sizeof(data_out)), -ENXIO,
+		      "Should not be able to read");
+
+	zassert_equal(emds_flash_record_write(&ctx, 3, data_in3, sizeof(data_in3)),
+		      sizeof(data_in3), "Error when write");
+	zassert_true(emds_flash_record_write(&ctx, 4, data_in1, 1) < 0,
+		     "Should not be able to write past the record");
+	zassert_false(emds_flash_record_end(&ctx), "Error when ending record");
+
+	/* Reset and check that the entries are recovered */
+	device_reset();
+	zassert_false(emds_flash_init(&ctx), "Error when initializing");
+
+	zassert_equal(emds_flash_read(&ctx, 1, data_out, sizeof(data_out)), sizeof(data_in1),
+		      "Error when read");
+	zassert_false(memcmp(data_out, data_in1, sizeof(data_in1)), "Retrived wrong value");
+	zassert_equal(emds_flash_read(&ctx, 2, data_out, sizeof(data_out)), sizeof(data_in2),
+		      "Error when read");
+	zassert_false(memcmp(data_out, data_in2, sizeof(data_in2)), "Retrived wrong value");
+	zassert_equal(emds_flash_read(&ctx, 3, data_out, sizeof(data_out)), sizeof(data_in3),
+		      "Error when read");
+	zassert_false(memcmp(data_out, data_in3, sizeof(data_in3)), "Retrived wrong value");
+	zassert_equal(emds_flash_read(&ctx, 3, data_out, 1), -ENOMEM,
+		      "Should not read into a too small buffer");
+	zassert_equal(emds_flash_read(&ctx, 4, data_out, sizeof(data_out)), -ENXIO,
+		      "Should not find missing entry");
+
+	zassert_equal(emds_flash_free_space_get(&ctx),
+		      m_test_fd.size - (align_size(len) + align_size(sizeof(struct test_ate)) * 2),
+		      "");
+
+	/* A new prepare invalidates the record */
+	zassert_false(emds_flash_prepare(&ctx, align_size(len) + ctx.ate_size), "Prepare failed");
+	zassert_equal(emds_flash_read(&ctx, 1, data_out, sizeof(data_out)), -ENXIO,
+		      "Should not read invalidated entry");
+}
+
+ZTEST(emds_flash_tests, test_record_permission)
+{
+	char data_in[8] = "Deadbee";
+
+	flash_clear();
+	device_reset();
+
+	zassert_equal(emds_flash_record_prepare(&ctx, 32), -EACCES, "Should not prepare");
+	zassert_false(emds_flash_init(&ctx), "Error when initializing");
+	zassert_equal(emds_flash_record_prepare(&ctx, 32), -EACCES, "Should not prepare");
+	zassert_false(emds_flash_prepare(&ctx, 32), "Prepare failed");
+	zassert_equal(emds_flash_record_prepare(&ctx, m_test_fd.size), -ENOMEM,
+		      "Should not prepare record larger than the flash");
+
+	/* Nothing is written to a record that is not prepared */
+	zassert_true(emds_flash_record_write(&ctx, 1, data_in, sizeof(data_in)) < 0,
+		     "Should not be able to write");
+	zassert_false(emds_flash_record_end(&ctx), "Empty record should not be written");
+	zassert_false(flash_cmp_const(m_test_fd.offset, 0xff, m_test_fd.size), "Flash written");
+}
+
+ZTEST(emds_flash_tests, test_record_corrupted_data)
+{
+	char corrupt[4] = {0};
+	char data_in[8] = "Deadbee";
+	char data_out[8] = {0};
+	size_t size;
+	uint32_t record_offset;
+
+	flash_clear();
+	device_reset();
+
+	zassert_false(emds_flash_init(&ctx), "Error when initializing");
+	size = align_size(EMDS_FLASH_RECORD_HDR_SIZE + sizeof(data_in)) + ctx.ate_size;
+	zassert_false(emds_flash_prepare(&ctx, size), "Prepare failed");
+	zassert_false(emds_flash_record_prepare(&ctx, size), "Prepare failed");
+	record_offset = ctx.record_offset;
+
+	zassert_equal(emds_flash_record_write(&ctx, 1, data_in, sizeof(data_in)), sizeof(data_in),
+		      "Should be able to write");
+	zassert_false(emds_flash_record_end(&ctx), "Error when ending record");
+	zassert_equal(emds_flash_read(&ctx, 1, data_out, sizeof(data_out)), sizeof(data_in),
+		      "Should be able to read");
+
+	/* Corrupt the record */
+	flash_write(m_test_fd.fd, m_test_fd.offset + record_offset, corrupt, sizeof(corrupt));
+
+	/* Reset */
+	device_reset();
+	zassert_false(emds_flash_init(&ctx), "Error when initializing");
+
+	zassert_true(emds_flash_read(&ctx, 1, data_out, sizeof(data_in)) < 0,
+		     "Should not be able to read");
+}
+
 ZTEST(emds_flash_tests, test_write_speed)
 {
 	char data_in[4] = "bee";
@@ -671,6 +786,36 @@ ZTEST(emds_flash_tests, test_write_speed)
 #if !defined CONFIG_SOC_FLASH_NRF_RRAM /* TODO: Fix it with NCSDK-26922 */
 	zassert_true(store_time_us < 13000, "Storing 1024 bytes took to long time");
 #endif
+
+	/* Store the same small entries one by one and as one record */
+	(void)flash_clear();
+	device_reset();
+	(void)emds_flash_init(&ctx);
+	(void)emds_flash_prepare(&ctx, 0);
+
+	tic = k_uptime_ticks();
+	for (uint16_t i = 0; i < WRITE_SPEED_ENTRIES; i++) {
+		emds_flash_write(&ctx, i, data_in, sizeof(data_in));
+	}
+	toc = k_uptime_ticks();
+	store_time_us = k_ticks_to_us_ceil64(toc - tic);
+	printk("Storing %d entries took: %lldus\n", WRITE_SPEED_ENTRIES, store_time_us);
+
+	(void)emds_flash_prepare(&ctx, 0);
+	(void)emds_flash_record_prepare(&ctx, ctx.ate_size +
+					align_size(WRITE_SPEED_ENTRIES *
+						   (EMDS_FLASH_RECORD_HDR_SIZE + sizeof(data_in))));
+
+	tic = k_uptime_ticks();
+	for (uint16_t i = 0; i < WRITE_SPEED_ENTRIES; i++) {
+		emds_flash_record_write(&ctx, i, data_in, sizeof(data_in));
+	}
+	emds_flash_record_end(&ctx);
+	toc = k_uptime_ticks();
+	printk("Storing %d entries as one record took: %lldus\n", WRITE_SPEED_ENTRIES,
+	       k_ticks_to_us_ceil64(toc - tic));
+	zassert_true(k_ticks_to_us_ceil64(toc - tic) < store_time_us,
+		     "Storing entries as one record took longer than storing them one by one");
 }
 
 ZTEST_SUITE(emds_flash_tests, NULL, fs_init, NULL, NULL, NULL);
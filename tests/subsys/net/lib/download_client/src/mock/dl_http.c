@@ -18,3 +18,8 @@ int http_get_request_send(struct download_client *client)
 {
 	return 0;
 }
+
+int http_pipeline_continue(struct download_client *client, size_t frag_len)
+{
+	return 0;
+}
@@ -11,5 +11,6 @@
 
 int http_parse(struct download_client *client, size_t len);
 int http_get_request_send(struct download_client *client);
+int http_pipeline_continue(struct download_client *client, size_t frag_len);
 
 #endif /* _DL_HTTP_H_ */
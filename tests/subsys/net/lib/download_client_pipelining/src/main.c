@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket_offload.h>
+
+#include <zephyr/ztest.h>
+#include <download_client.h>
+
+#include "server.h"
+
+#define TEST_HOST      "http://192.0.2.1"
+#define TEST_FILE      "file.bin"
+#define TEST_FILE_SIZE (16 * 1024)
+#define TEST_FRAGMENTS DIV_ROUND_UP(TEST_FILE_SIZE, CONFIG_DOWNLOAD_CLIENT_HTTP_FRAG_SIZE)
+
+static struct download_client client;
+static struct download_client_cfg config = {
+	.family = AF_INET,
+};
+
+static K_SEM_DEFINE(done_sem, 0, 1);
+static K_SEM_DEFINE(closed_sem, 0, 1);
+
+static size_t received;
+static bool corrupted;
+static int error;
+
+static int download_client_callback(const struct download_client_evt *event)
+{
+	const uint8_t *data;
+
+	switch (event->id) {
+	case DOWNLOAD_CLIENT_EVT_FRAGMENT:
+		data = event->fragment.buf;
+
+		/* Fragments must arrive in file order, whatever the number of requests in flight */
+		for (size_t i = 0; i < event->fragment.len; i++) {
+			if (data[i] != server_file_byte(received + i)) {
+				corrupted = true;
+			}
+		}
+
+		received += event->fragment.len;
+		break;
+	case DOWNLOAD_CLIENT_EVT_ERROR:
+		error = event->error;
+		k_sem_give(&done_sem);
+		return -1;
+	case DOWNLOAD_CLIENT_EVT_DONE:
+		k_sem_give(&done_sem);
+		break;
+	case DOWNLOAD_CLIENT_EVT_CLOSED:
+		k_sem_give(&closed_sem);
+		break;
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+static void download_run(uint32_t rtt_ms)
+{
+	int64_t start;
+	int64_t elapsed;
+	int err;
+
+	server_reset(TEST_FILE_SIZE, rtt_ms);
+	received = 0;
+	corrupted = false;
+	error = 0;
+
+	start = k_uptime_get();
+
+	err = download_client_get(&client, TEST_HOST, &config, TEST_FILE, 0);
+	zassert_ok(err, "download_client_get failed: %d", err);
+
+	err = k_sem_take(&done_sem, K_SECONDS(60));
+	zassert_ok(err, "Download timed out");
+
+	elapsed = k_uptime_get() - start;
+
+	zassert_ok(k_sem_take(&closed_sem, K_SECONDS(5)), "Client did not close");
+
+	zassert_equal(error, 0, "Download failed: %d", error);
+	zassert_false(corrupted, "Received data out of order");
+	zassert_equal(received, TEST_FILE_SIZE, "Received %zu of %d bytes", received,
+		      TEST_FILE_SIZE);
+
+	TC_PRINT("RTT %u ms, depth %d: %lld ms, %lld B/s, %u requests, %u in flight\n", rtt_ms,
+		 CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINE_DEPTH, elapsed,
+		 (TEST_FILE_SIZE * 1000LL) / MAX(elapsed, 1), server_requests_get(),
+		 server_in_flight_max_get());
+
+	zassert_equal(server_in_flight_max_get(), CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINE_DEPTH,
+		      "Unexpected number of requests in flight");
+
+	if (CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINE_DEPTH > 1) {
+		/* The first request is sent alone, to learn the file size */
+		zassert_true(elapsed < (int64_t)TEST_FRAGMENTS * rtt_ms,
+			     "No gain from pipelining: %lld ms", elapsed);
+	}
+}
+
+static void *setup(void)
+{
+	int err;
+
+	err = download_client_init(&client, download_client_callback);
+	zassert_ok(err, NULL);
+
+	return NULL;
+}
+
+ZTEST_SUITE(download_client_pipelining, NULL, setup, NULL, NULL, NULL);
+
+ZTEST(download_client_pipelining, test_file_changed)
+{
+	int err;
+
+	server_reset(TEST_FILE_SIZE, 20);
+	server_file_change_after(3);
+	received = 0;
+	corrupted = false;
+	error = 0;
+
+	err = download_client_get(&client, TEST_HOST, &config, TEST_FILE, 0);
+	zassert_ok(err, "download_client_get failed: %d", err);
+
+	zassert_ok(k_sem_take(&done_sem, K_SECONDS(60)), "Download timed out");
+
+	/* Fragments of another version of the file must not be delivered */
+	zassert_not_equal(error, 0, "Download did not fail");
+	zassert_false(corrupted, "Received data out of order");
+	zassert_true(received <= 3 * CONFIG_DOWNLOAD_CLIENT_HTTP_FRAG_SIZE,
+		     "Received %zu bytes of the changed file", received);
+
+	(void)download_client_disconnect(&client);
+	zassert_ok(k_sem_take(&closed_sem, K_SECONDS(5)), "Client did not close");
+}
+
+ZTEST(download_client_pipelining, test_rtt_20ms)
+{
+	download_run(20);
+}
+
+ZTEST(download_client_pipelining, test_rtt_100ms)
+{
+	download_run(100);
+}
+
+ZTEST(download_client_pipelining, test_rtt_300ms)
+{
+	download_run(300);
+}
+
+#define TEST_SOCKET_PRIO 40
+NET_SOCKET_REGISTER(server_socket, TEST_SOCKET_PRIO, AF_UNSPEC, server_socket_is_supported,
+		    server_socket_create);
+NET_DEVICE_OFFLOAD_INIT(server_socket, "server_socket", server_offload_init, NULL,
+			&server_iface_data, NULL, 0, &server_if_api, 1280);
@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Stand-in HTTP server behind an offloaded socket. The server answers each Range
+ * request after a configurable round trip time, and answers requests in the order
+ * they were received, as an HTTP/1.1 server does for pipelined requests.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/net/socket_offload.h>
+#include <sockets_internal.h>
+
+#include "server.h"
+
+#define SERVER_RESP_MAX 16
+
+struct server_resp {
+	/* Time at which the first byte of the response arrives */
+	int64_t ready_ms;
+	/* First byte of the range */
+	size_t start;
+	/* Number of bytes in the range */
+	size_t len;
+	/* Number of bytes of the response (header and body) received by the client */
+	size_t pos;
+	size_t hdr_len;
+	char hdr[128];
+};
+
+static struct {
+	struct server_resp resp[SERVER_RESP_MAX];
+	size_t head;
+	size_t count;
+	size_t file_size;
+	uint32_t rtt_ms;
+	uint32_t requests;
+	uint32_t in_flight_max;
+	/* Number of requests after which the file changes, zero if it does not */
+	uint32_t change_after;
+} server;
+
+struct server_iface_data {
+	struct net_if *iface;
+} server_iface_data;
+
+static void server_iface_init(struct net_if *iface);
+
+struct offloaded_if_api server_if_api = {
+	.iface_api.init = server_iface_init,
+};
+
+void server_reset(size_t file_size, uint32_t rtt_ms)
+{
+	memset(&server, 0, sizeof(server));
+	server.file_size = file_size;
+	server.rtt_ms = rtt_ms;
+}
+
+void server_file_change_after(uint32_t requests)
+{
+	server.change_after = requests;
+}
+
+uint8_t server_file_byte(size_t off)
+{
+	return (uint8_t)(off * 31 + (off >> 8));
+}
+
+uint32_t server_requests_get(void)
+{
+	return server.requests;
+}
+
+uint32_t server_in_flight_max_get(void)
+{
+	return server.in_flight_max;
+}
+
+/* Queue the response to a single request */
+static int server_request_handle(const char *req)
+{
+	struct server_resp *resp;
+	const char *p;
+	char *q;
+	size_t start;
+	size_t end;
+
+	if (server.count == SERVER_RESP_MAX) {
+		return -ENOBUFS;
+	}
+
+	p = strstr(req, "Range: bytes=");
+	if (!p) {
+		return -EBADMSG;
+	}
+
+	start = strtoul(p + strlen("Range: bytes="), &q, 10);
+	end = (*q == '-') ? strtoul(q + 1, NULL, 10) : server.file_size - 1;
+	end = MIN(end, server.file_size - 1);
+
+	if (start > end) {
+		return -ERANGE;
+	}
+
+	resp = &server.resp[(server.head + server.count) % SERVER_RESP_MAX];
+	resp->ready_ms = k_uptime_get() + server.rtt_ms;
+	resp->start = start;
+	resp->len = end - start + 1;
+	resp->pos = 0;
+	resp->hdr_len = snprintf(resp->hdr, sizeof(resp->hdr),
+				 "HTTP/1.1 206 Partial Content\r\n"
+				 "Content-Range: bytes %zu-%zu/%zu\r\n"
+				 "Content-Length: %zu\r\n"
+				 "ETag: \"v%d\"\r\n"
+				 "\r\n",
+				 start, end, server.file_size, resp->len,
+				 (server.change_after && server.requests >= server.change_after) ? 2 : 1);
+
+	server.count++;
+	server.requests++;
+	server.in_flight_max = MAX(server.in_flight_max, server.count);
+
+	return 0;
+}
+
+static ssize_t server_sendto(void *obj, const void *buf, size_t len, int flags,
+			     const struct sockaddr *to, socklen_t tolen)
+{
+	char req[256];
+	int err;
+
+	/* The client sends one request per call */
+	if (len >= sizeof(req)) {
+		errno = EMSGSIZE;
+		return -1;
+	}
+
+	memcpy(req, buf, len);
+	req[len] = '\0';
+
+	err = server_request_handle(req);
+	if (err) {
+		errno = -err;
+		return -1;
+	}
+
+	return len;
+}
+
+static ssize_t server_recvfrom(void *obj, void *buf, size_t len, int flags,
+			       struct sockaddr *from, socklen_t *fromlen)
+{
+	struct server_resp *resp;
+	uint8_t *dst = buf;
+	size_t copied = 0;
+	int64_t now;
+
+	if (server.count == 0) {
+		/* Nothing requested, the client would wait for the receive timeout */
+		k_sleep(K_SECONDS(1));
+		errno = EAGAIN;
+		return -1;
+	}
+
+	now = k_uptime_get();
+	if (server.resp[server.head].ready_ms > now) {
+		k_sleep(K_MSEC(server.resp[server.head].ready_ms - now));
+	}
+
+	/* Hand out all the data that has arrived, possibly spanning several responses */
+	while (server.count && copied < len && server.resp[server.head].ready_ms <= k_uptime_get()) {
+		resp = &server.resp[server.head];
+
+		while (copied < len && resp->pos < resp->hdr_len + resp->len) {
+			if (resp->pos < resp->hdr_len) {
+				dst[copied] = resp->hdr[resp->pos];
+			} else {
+				dst[copied] = server_file_byte(resp->start + resp->pos - resp->hdr_len);
+			}
+
+			copied++;
+			resp->pos++;
+		}
+
+		if (resp->pos == resp->hdr_len + resp->len) {
+			server.head = (server.head + 1) % SERVER_RESP_MAX;
+			server.count--;
+		}
+	}
+
+	return copied;
+}
+
+static ssize_t server_read(void *obj, void *buffer, size_t count)
+{
+	return server_recvfrom(obj, buffer, count, 0, NULL, 0);
+}
+
+static ssize_t server_write(void *obj, const void *buffer, size_t count)
+{
+	return server_sendto(obj, buffer, count, 0, NULL, 0);
+}
+
+static int server_close(void *obj)
+{
+	/* Responses in flight are lost with the connection */
+	server.head = 0;
+	server.count = 0;
+
+	return zsock_close_ctx(obj);
+}
+
+static int server_ioctl(void *obj, unsigned int request, va_list args)
+{
+	switch (request) {
+	case ZFD_IOCTL_POLL_PREPARE:
+		return -EXDEV;
+	case ZFD_IOCTL_POLL_UPDATE:
+		return -EOPNOTSUPP;
+	default:
+		return 0;
+	}
+}
+
+static int server_connect(void *obj, const struct sockaddr *addr, socklen_t addrlen)
+{
+	return 0;
+}
+
+static int server_setsockopt(void *obj, int level, int optname, const void *optval,
+			     socklen_t optlen)
+{
+	return 0;
+}
+
+static int server_getsockopt(void *obj, int level, int optname, void *optval,
+			     socklen_t *optlen)
+{
+	return 0;
+}
+
+static const struct socket_op_vtable server_fd_op_vtable = {
+	.fd_vtable = {
+		.read = server_read,
+		.write = server_write,
+		.close = server_close,
+		.ioctl = server_ioctl,
+	},
+	.connect = server_connect,
+	.sendto = server_sendto,
+	.recvfrom = server_recvfrom,
+	.getsockopt = server_getsockopt,
+	.setsockopt = server_setsockopt,
+};
+
+/* There is no DNS, the node must be an IPv4 address */
+static int server_getaddrinfo(const char *node, const char *service,
+			      const struct zsock_addrinfo *hints, struct zsock_addrinfo **res)
+{
+	struct sockaddr_in *ai_addr;
+	struct zsock_addrinfo *ai;
+
+	if (!node || !res || (hints && hints->ai_family != AF_INET)) {
+		return -1;
+	}
+
+	ai = calloc(1, sizeof(*ai));
+	ai_addr = calloc(1, sizeof(*ai_addr));
+	if (!ai || !ai_addr) {
+		free(ai);
+		free(ai_addr);
+		return -1;
+	}
+
+	if (!net_ipaddr_parse(node, strlen(node), (struct sockaddr *)ai_addr)) {
+		free(ai);
+		free(ai_addr);
+		return -1;
+	}
+
+	ai_addr->sin_family = AF_INET;
+	ai_addr->sin_port = htons(service ? strtol(service, NULL, 10) : 0);
+	ai->ai_family = AF_INET;
+	ai->ai_socktype = SOCK_STREAM;
+	ai->ai_protocol = IPPROTO_TCP;
+	ai->ai_addrlen = sizeof(*ai_addr);
+	ai->ai_addr = (struct sockaddr *)ai_addr;
+	*res = ai;
+
+	return 0;
+}
+
+static void server_freeaddrinfo(struct zsock_addrinfo *res)
+{
+	free(res->ai_addr);
+	free(res);
+}
+
+bool server_socket_is_supported(int family, int type, int proto)
+{
+	return true;
+}
+
+int server_socket_create(int family, int type, int proto)
+{
+	int fd = zvfs_reserve_fd();
+	struct net_context *ctx;
+	int res;
+
+	if (fd < 0) {
+		return -1;
+	}
+
+	res = net_context_get(family, type, IPPROTO_TCP, &ctx);
+	if (res < 0) {
+		zvfs_free_fd(fd);
+		errno = -res;
+		return -1;
+	}
+
+	ctx->user_data = NULL;
+	ctx->socket_data = NULL;
+	k_fifo_init(&ctx->recv_q);
+	k_condvar_init(&ctx->cond.recv);
+	net_context_ref(ctx);
+
+	zvfs_finalize_fd(fd, ctx, (const struct fd_op_vtable *)&server_fd_op_vtable);
+
+	return fd;
+}
+
+int server_offload_init(const struct device *arg)
+{
+	return 0;
+}
+
+static const struct socket_dns_offload server_dns_offload_ops = {
+	.getaddrinfo = server_getaddrinfo,
+	.freeaddrinfo = server_freeaddrinfo,
+};
+
+static void server_iface_init(struct net_if *iface)
+{
+	server_iface_data.iface = iface;
+
+	iface->if_dev->socket_offload = server_socket_create;
+
+	socket_offload_dns_register(&server_dns_offload_ops);
+}
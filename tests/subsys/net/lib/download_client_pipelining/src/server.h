@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SERVER_H_
+#define _SERVER_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/offloaded_netdev.h>
+
+extern struct server_iface_data server_iface_data;
+extern struct offloaded_if_api server_if_api;
+
+/**
+ * @brief Reset the stand-in HTTP server.
+ *
+ * @param file_size  Size of the file served, in bytes.
+ * @param rtt_ms     Round trip time between a request and its response, in milliseconds.
+ */
+void server_reset(size_t file_size, uint32_t rtt_ms);
+
+/**
+ * @brief Make the served file change on the server after a number of requests.
+ *
+ * @param requests  Number of requests answered with the original ETag.
+ */
+void server_file_change_after(uint32_t requests);
+
+/**
+ * @brief Get the value of a byte of the served file.
+ *
+ * @param off  Offset of the byte in the file.
+ *
+ * @return The value of the byte.
+ */
+uint8_t server_file_byte(size_t off);
+
+/**
+ * @brief Get the number of requests received since the last reset.
+ */
+uint32_t server_requests_get(void);
+
+/**
+ * @brief Get the maximum number of requests in flight since the last reset.
+ */
+uint32_t server_in_flight_max_get(void);
+
+int server_offload_init(const struct device *arg);
+bool server_socket_is_supported(int family, int type, int proto);
+int server_socket_create(int family, int type, int proto);
+
+#endif /* _SERVER_H_ */
@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <cJSON.h>
+#include <cJSON_os.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_defs.h>
+#include <net/nrf_cloud_codec.h>
+
+#define BUF_SIZE     256
+#define BENCH_ROUNDS 200
+
+static char buf[BUF_SIZE];
+
+/* Heap use of the cJSON path, counted through the cJSON hooks */
+static size_t alloc_bytes;
+static size_t alloc_count;
+
+static void *counting_malloc(size_t size)
+{
+	alloc_bytes += size;
+	alloc_count++;
+
+	return k_malloc(size);
+}
+
+static cJSON_Hooks counting_hooks = {
+	.malloc_fn = counting_malloc,
+	.free_fn = k_free,
+};
+
+/* Normally provided by nrf_cloud_codec_internal.c */
+const char *nrf_cloud_sensor_app_id_lookup(enum nrf_cloud_sensor type)
+{
+	switch (type) {
+	case NRF_CLOUD_SENSOR_TEMP:
+		return NRF_CLOUD_JSON_APPID_VAL_TEMP;
+	case NRF_CLOUD_SENSOR_HUMID:
+		return NRF_CLOUD_JSON_APPID_VAL_HUMID;
+	case NRF_CLOUD_LTE_LINK_RSRP:
+		return NRF_CLOUD_JSON_APPID_VAL_RSRP;
+	default:
+		return NULL;
+	}
+}
+
+/* Encode the messages with cJSON as nrf_cloud_sensor_data_encode() and
+ * nrf_cloud_gnss_msg_json_encode() did, for reference.
+ */
+static char *cjson_sensor_encode(const struct nrf_cloud_sensor_data *sensor)
+{
+	cJSON *root_obj = cJSON_CreateObject();
+	char *out;
+
+	cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_JSON_APPID_KEY,
+				  nrf_cloud_sensor_app_id_lookup(sensor->type));
+	cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_JSON_DATA_KEY, sensor->data.ptr);
+	cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+				  NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	if (sensor->ts_ms != NRF_CLOUD_NO_TIMESTAMP) {
+		cJSON_AddNumberToObjectCS(root_obj, NRF_CLOUD_MSG_TIMESTAMP_KEY, sensor->ts_ms);
+	}
+
+	out = cJSON_PrintUnformatted(root_obj);
+	cJSON_Delete(root_obj);
+
+	return out;
+}
+
+static char *cjson_gnss_encode(const struct nrf_cloud_gnss_data *gnss)
+{
+	cJSON *root_obj = cJSON_CreateObject();
+	char *out;
+
+	cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_JSON_APPID_KEY,
+				  NRF_CLOUD_JSON_APPID_VAL_GNSS);
+	cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+				  NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	if (gnss->ts_ms != NRF_CLOUD_NO_TIMESTAMP) {
+		cJSON_AddNumberToObjectCS(root_obj, NRF_CLOUD_MSG_TIMESTAMP_KEY, gnss->ts_ms);
+	}
+
+	if (gnss->type == NRF_CLOUD_GNSS_TYPE_PVT) {
+		cJSON *data_obj = cJSON_AddObjectToObject(root_obj, NRF_CLOUD_JSON_DATA_KEY);
+
+		cJSON_AddNumberToObjectCS(data_obj, NRF_CLOUD_JSON_GNSS_PVT_KEY_LON,
+					  gnss->pvt.lon);
+		cJSON_AddNumberToObjectCS(data_obj, NRF_CLOUD_JSON_GNSS_PVT_KEY_LAT,
+					  gnss->pvt.lat);
+		cJSON_AddNumberToObjectCS(data_obj, NRF_CLOUD_JSON_GNSS_PVT_KEY_ACCURACY,
+					  gnss->pvt.accuracy);
+		if (gnss->pvt.has_alt) {
+			cJSON_AddNumberToObjectCS(data_obj, NRF_CLOUD_JSON_GNSS_PVT_KEY_ALTITUDE,
+						  gnss->pvt.alt);
+		}
+		if (gnss->pvt.has_speed) {
+			cJSON_AddNumberToObjectCS(data_obj, NRF_CLOUD_JSON_GNSS_PVT_KEY_SPEED,
+						  gnss->pvt.speed);
+		}
+		if (gnss->pvt.has_heading) {
+			cJSON_AddNumberToObjectCS(data_obj, NRF_CLOUD_JSON_GNSS_PVT_KEY_HEADING,
+						  gnss->pvt.heading);
+		}
+	} else {
+		cJSON_AddStringToObject(root_obj, NRF_CLOUD_JSON_DATA_KEY, gnss->nmea.sentence);
+	}
+
+	out = cJSON_PrintUnformatted(root_obj);
+	cJSON_Delete(root_obj);
+
+	return out;
+}
+
+static void sensor_check(const struct nrf_cloud_sensor_data *sensor)
+{
+	char *expected = cjson_sensor_encode(sensor);
+	size_t len;
+	int rc;
+
+	zassert_not_null(expected, "cJSON encoding failed");
+
+	rc = nrf_cloud_sensor_data_json_write(sensor, buf, sizeof(buf), &len);
+	zassert_ok(rc, "Write failed: %d", rc);
+	zassert_equal(len, strlen(expected), "Wrong length");
+	zassert_equal(strcmp(buf, expected), 0, "Got %s, expected %s", buf, expected);
+
+	cJSON_free(expected);
+}
+
+static void gnss_check(const struct nrf_cloud_gnss_data *gnss)
+{
+	char *expected = cjson_gnss_encode(gnss);
+	size_t len;
+	int rc;
+
+	zassert_not_null(expected, "cJSON encoding failed");
+
+	rc = nrf_cloud_gnss_msg_json_write(gnss, buf, sizeof(buf), &len);
+	zassert_ok(rc, "Write failed: %d", rc);
+	zassert_equal(len, strlen(expected), "Wrong length");
+	zassert_equal(strcmp(buf, expected), 0, "Got %s, expected %s", buf, expected);
+
+	cJSON_free(expected);
+}
+
+static void *suite_setup(void)
+{
+	cJSON_Init();
+
+	return NULL;
+}
+
+ZTEST(nrf_cloud_json_writer, test_sensor_data_same_as_cjson)
+{
+	static const char *const values[] = {
+		"23.5", "", "-120", "quote \" backslash \\ slash /",
+		"\b\f\n\r\t\x01\x1f", "utf-8 \xc3\xa6\xc3\xb8\xc3\xa5",
+	};
+	static const int64_t timestamps[] = {
+		NRF_CLOUD_NO_TIMESTAMP, 1, -1, 1700000000123LL, INT32_MAX, INT64_MAX / 1000,
+	};
+	struct nrf_cloud_sensor_data sensor = {
+		.type = NRF_CLOUD_SENSOR_TEMP,
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(values); i++) {
+		for (size_t j = 0; j < ARRAY_SIZE(timestamps); j++) {
+			sensor.data.ptr = values[i];
+			sensor.data.len = strlen(values[i]);
+			sensor.ts_ms = timestamps[j];
+
+			sensor_check(&sensor);
+		}
+	}
+}
+
+ZTEST(nrf_cloud_json_writer, test_gnss_pvt_same_as_cjson)
+{
+	static const double coords[] = {
+		0.0, -0.0, 1.0, 63.4213, -10.4376512, 179.99999999999, 1e-7, -123456.789,
+	};
+	static const float floats[] = {
+		0.0f, 1.1f, 0.1f, 100.0f, 2.5e-3f, 3.4e38f, NAN, INFINITY,
+	};
+	struct nrf_cloud_gnss_data gnss = {
+		.type = NRF_CLOUD_GNSS_TYPE_PVT,
+		.ts_ms = 1700000000123LL,
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(coords); i++) {
+		gnss.pvt.lat = coords[i];
+		gnss.pvt.lon = coords[ARRAY_SIZE(coords) - 1 - i];
+		gnss.pvt.accuracy = floats[i];
+		gnss.pvt.alt = floats[(i + 1) % ARRAY_SIZE(floats)];
+		gnss.pvt.speed = floats[(i + 2) % ARRAY_SIZE(floats)];
+		gnss.pvt.heading = floats[(i + 3) % ARRAY_SIZE(floats)];
+
+		/* Every combination of the optional values */
+		for (uint8_t opt = 0; opt < 8; opt++) {
+			gnss.pvt.has_alt = !!(opt & BIT(0));
+			gnss.pvt.has_speed = !!(opt & BIT(1));
+			gnss.pvt.has_heading = !!(opt & BIT(2));
+
+			gnss_check(&gnss);
+		}
+	}
+
+	gnss.ts_ms = NRF_CLOUD_NO_TIMESTAMP;
+	gnss_check(&gnss);
+}
+
+ZTEST(nrf_cloud_json_writer, test_gnss_nmea_same_as_cjson)
+{
+	struct nrf_cloud_gnss_data gnss = {
+		.type = NRF_CLOUD_GNSS_TYPE_NMEA,
+		.ts_ms = 1700000000123LL,
+		.nmea.sentence = "$GPGGA,090213.00,6325.29,N,01025.67,E,1,08,1.0,54.3,M,,M,,*4C",
+	};
+
+	gnss_check(&gnss);
+}
+
+ZTEST(nrf_cloud_json_writer, test_errors)
+{
+	char nmea[NRF_MODEM_GNSS_NMEA_MAX_LEN + 1];
+	struct nrf_cloud_sensor_data sensor = {
+		.type = NRF_CLOUD_SENSOR_HUMID,
+		.data = { .ptr = "45", .len = 2 },
+		.ts_ms = 1700000000123LL,
+	};
+	struct nrf_cloud_gnss_data gnss = {
+		.type = NRF_CLOUD_GNSS_TYPE_NMEA,
+	};
+	size_t expected_len;
+	size_t len;
+	int rc;
+
+	rc = nrf_cloud_sensor_data_json_write(NULL, buf, sizeof(buf), &len);
+	zassert_equal(rc, -EINVAL, "Expected -EINVAL, got %d", rc);
+	rc = nrf_cloud_sensor_data_json_write(&sensor, buf, sizeof(buf), NULL);
+	zassert_equal(rc, -EINVAL, "Expected -EINVAL, got %d", rc);
+	rc = nrf_cloud_sensor_data_json_write(&sensor, NULL, sizeof(buf), &len);
+	zassert_equal(rc, -EINVAL, "Expected -EINVAL, got %d", rc);
+
+	sensor.type = NRF_CLOUD_SENSOR_FLIP;
+	rc = nrf_cloud_sensor_data_json_write(&sensor, buf, sizeof(buf), &len);
+	zassert_equal(rc, -EINVAL, "Expected -EINVAL for unknown app ID, got %d", rc);
+	sensor.type = NRF_CLOUD_SENSOR_HUMID;
+
+	/* The length is given when there is no buffer */
+	rc = nrf_cloud_sensor_data_json_write(&sensor, buf, sizeof(buf), &expected_len);
+	zassert_ok(rc, "Write failed: %d", rc);
+	rc = nrf_cloud_sensor_data_json_write(&sensor, NULL, 0, &len);
+	zassert_equal(rc, -ENOBUFS, "Expected -ENOBUFS, got %d", rc);
+	zassert_equal(len, expected_len, "Wrong length without a buffer");
+
+	/* No room for the null terminator */
+	memset(buf, 'x', sizeof(buf));
+	rc = nrf_cloud_sensor_data_json_write(&sensor, buf, expected_len, &len);
+	zassert_equal(rc, -ENOBUFS, "Expected -ENOBUFS, got %d", rc);
+	zassert_equal(len, expected_len, "Wrong length with a small buffer");
+	zassert_equal(buf[expected_len], 'x', "Wrote past the end of the buffer");
+
+	rc = nrf_cloud_gnss_msg_json_write(NULL, buf, sizeof(buf), &len);
+	zassert_equal(rc, -EINVAL, "Expected -EINVAL, got %d", rc);
+
+	gnss.nmea.sentence = NULL;
+	rc = nrf_cloud_gnss_msg_json_write(&gnss, buf, sizeof(buf), &len);
+	zassert_equal(rc, -EINVAL, "Expected -EINVAL, got %d", rc);
+
+	memset(nmea, 'N', sizeof(nmea));
+	nmea[sizeof(nmea) - 1] = '\0';
+	gnss.nmea.sentence = nmea;
+	rc = nrf_cloud_gnss_msg_json_write(&gnss, buf, sizeof(buf), &len);
+	zassert_equal(rc, -EFBIG, "Expected -EFBIG, got %d", rc);
+
+	gnss.type = NRF_CLOUD_GNSS_TYPE_INVALID;
+	rc = nrf_cloud_gnss_msg_json_write(&gnss, buf, sizeof(buf), &len);
+	zassert_equal(rc, -EPROTO, "Expected -EPROTO, got %d", rc);
+
+#if !defined(CONFIG_NRF_MODEM)
+	gnss.type = NRF_CLOUD_GNSS_TYPE_MODEM_PVT;
+	rc = nrf_cloud_gnss_msg_json_write(&gnss, buf, sizeof(buf), &len);
+	zassert_equal(rc, -ENOSYS, "Expected -ENOSYS, got %d", rc);
+#endif
+}
+
+ZTEST(nrf_cloud_json_writer, test_benchmark)
+{
+	struct nrf_cloud_sensor_data sensor = {
+		.type = NRF_CLOUD_SENSOR_TEMP,
+		.data = { .ptr = "23.5", .len = 4 },
+		.ts_ms = 1700000000123LL,
+	};
+	struct nrf_cloud_gnss_data gnss = {
+		.type = NRF_CLOUD_GNSS_TYPE_PVT,
+		.ts_ms = 1700000000123LL,
+		.pvt = {
+			.lat = 63.421339, .lon = 10.437655, .accuracy = 12.5f, .alt = 54.3f,
+			.speed = 1.2f, .heading = 271.8f,
+			.has_alt = 1, .has_speed = 1, .has_heading = 1,
+		},
+	};
+	uint32_t cjson_cycles[2];
+	uint32_t write_cycles[2];
+	size_t cjson_bytes[2];
+	size_t cjson_allocs[2];
+	uint32_t start;
+	size_t len;
+	char *out;
+
+	cJSON_InitHooks(&counting_hooks);
+
+	for (size_t msg = 0; msg < 2; msg++) {
+		alloc_bytes = 0;
+		alloc_count = 0;
+		start = k_cycle_get_32();
+
+		for (size_t i = 0; i < BENCH_ROUNDS; i++) {
+			out = (msg == 0) ? cjson_sensor_encode(&sensor) : cjson_gnss_encode(&gnss);
+			zassert_not_null(out, "cJSON encoding failed");
+			cJSON_free(out);
+		}
+
+		cjson_cycles[msg] = (k_cycle_get_32() - start) / BENCH_ROUNDS;
+		cjson_bytes[msg] = alloc_bytes / BENCH_ROUNDS;
+		cjson_allocs[msg] = alloc_count / BENCH_ROUNDS;
+
+		start = k_cycle_get_32();
+
+		for (size_t i = 0; i < BENCH_ROUNDS; i++) {
+			if (msg == 0) {
+				(void)nrf_cloud_sensor_data_json_write(&sensor, buf, sizeof(buf), &len);
+			} else {
+				(void)nrf_cloud_gnss_msg_json_write(&gnss, buf, sizeof(buf), &len);
+			}
+		}
+
+		write_cycles[msg] = (k_cycle_get_32() - start) / BENCH_ROUNDS;
+	}
+
+	cJSON_Init();
+
+	TC_PRINT("Sensor message: cJSON %u cycles, %zu bytes in %zu allocations; "
+		 "writer %u cycles, no allocations\n", cjson_cycles[0], cjson_bytes[0],
+		 cjson_allocs[0], write_cycles[0]);
+	TC_PRINT("GNSS PVT message: cJSON %u cycles, %zu bytes in %zu allocations; "
+		 "writer %u cycles, no allocations\n", cjson_cycles[1], cjson_bytes[1],
+		 cjson_allocs[1], write_cycles[1]);
+}
+
+ZTEST_SUITE(nrf_cloud_json_writer, NULL, suite_setup, NULL, NULL, NULL);
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fff.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_defs.h>
+#include <net/nrf_cloud_codec.h>
+#include <net/nrf_cloud_sensor_batch.h>
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VALUE_FUNC(int, nrf_cloud_send, const struct nrf_cloud_tx_data *);
+
+#define SAMPLE_TS    1700000000000LL
+#define LONG_DATA    "01234567890123456789012345678901234567890123456789"
+
+static char sent[CONFIG_NRF_CLOUD_SENSOR_BATCH_BUF_SIZE];
+static enum nrf_cloud_topic_type sent_topic;
+
+const char *nrf_cloud_sensor_app_id_lookup(enum nrf_cloud_sensor type)
+{
+	switch (type) {
+	case NRF_CLOUD_SENSOR_TEMP:
+		return NRF_CLOUD_JSON_APPID_VAL_TEMP;
+	default:
+		return NULL;
+	}
+}
+
+static int nrf_cloud_send_capture(const struct nrf_cloud_tx_data *msg)
+{
+	zassert_true(msg->data.len < sizeof(sent), "Payload is larger than the batch buffer");
+
+	memcpy(sent, msg->data.ptr, msg->data.len);
+	sent[msg->data.len] = '\0';
+	sent_topic = msg->topic_type;
+
+	return 0;
+}
+
+static int nrf_cloud_send_fail(const struct nrf_cloud_tx_data *msg)
+{
+	ARG_UNUSED(msg);
+
+	return -EIO;
+}
+
+static int sample_add(const char *data, int64_t ts_ms)
+{
+	struct nrf_cloud_sensor_data sample = {
+		.type = NRF_CLOUD_SENSOR_TEMP,
+		.data.ptr = data,
+		.data.len = strlen(data),
+		.ts_ms = ts_ms
+	};
+
+	return nrf_cloud_sensor_batch_add(&sample);
+}
+
+static void sample_json(char *out, size_t size, const char *data, int64_t ts_ms)
+{
+	snprintf(out, size, "{\"appId\":\"TEMP\",\"data\":\"%s\",\"messageType\":\"DATA\","
+		 "\"ts\":%lld}", data, (long long)ts_ms);
+}
+
+static void batch_before(void *f)
+{
+	ARG_UNUSED(f);
+
+	/* Drop whatever a previous test left in the batch */
+	nrf_cloud_send_fake.custom_fake = nrf_cloud_send_capture;
+	(void)nrf_cloud_sensor_batch_flush();
+
+	RESET_FAKE(nrf_cloud_send);
+	nrf_cloud_send_fake.custom_fake = nrf_cloud_send_capture;
+	memset(sent, 0, sizeof(sent));
+}
+
+ZTEST(nrf_cloud_sensor_batch, test_add_and_flush)
+{
+	char expected[CONFIG_NRF_CLOUD_SENSOR_BATCH_BUF_SIZE];
+	char first[96];
+	char second[96];
+
+	zassert_ok(sample_add("21.5", SAMPLE_TS));
+	zassert_ok(sample_add("22", SAMPLE_TS + 1000));
+	zassert_equal(nrf_cloud_sensor_batch_count_get(), 2);
+	zassert_equal(nrf_cloud_send_fake.call_count, 0, "Batch sent too early");
+
+	zassert_ok(nrf_cloud_sensor_batch_flush());
+	zassert_equal(nrf_cloud_send_fake.call_count, 1);
+	zassert_equal(nrf_cloud_sensor_batch_count_get(), 0);
+	zassert_equal(sent_topic, NRF_CLOUD_TOPIC_BULK);
+
+	sample_json(first, sizeof(first), "21.5", SAMPLE_TS);
+	sample_json(second, sizeof(second), "22", SAMPLE_TS + 1000);
+	snprintf(expected, sizeof(expected), "[%s,%s]", first, second);
+	zassert_equal(strcmp(sent, expected), 0, "Unexpected batch: %s", sent);
+}
+
+ZTEST(nrf_cloud_sensor_batch, test_flush_empty)
+{
+	zassert_ok(nrf_cloud_sensor_batch_flush());
+	zassert_equal(nrf_cloud_send_fake.call_count, 0, "Empty batch sent");
+}
+
+ZTEST(nrf_cloud_sensor_batch, test_flush_when_full)
+{
+	char expected[CONFIG_NRF_CLOUD_SENSOR_BATCH_BUF_SIZE];
+	char sample[128];
+
+	zassert_ok(sample_add(LONG_DATA, SAMPLE_TS));
+	zassert_ok(sample_add(LONG_DATA, SAMPLE_TS + 1));
+	zassert_equal(nrf_cloud_send_fake.call_count, 0, "Batch sent too early");
+
+	/* No room for a third sample, the first two are sent to make room */
+	zassert_ok(sample_add(LONG_DATA, SAMPLE_TS + 2));
+	zassert_equal(nrf_cloud_send_fake.call_count, 1);
+	zassert_equal(nrf_cloud_sensor_batch_count_get(), 1);
+
+	sample_json(sample, sizeof(sample), LONG_DATA, SAMPLE_TS);
+	snprintf(expected, sizeof(expected), "[%s,", sample);
+	zassert_equal(strncmp(sent, expected, strlen(expected)), 0, "Unexpected batch: %s", sent);
+}
+
+ZTEST(nrf_cloud_sensor_batch, test_flush_on_max_samples)
+{
+	for (int i = 0; i < CONFIG_NRF_CLOUD_SENSOR_BATCH_MAX_SAMPLES; i++) {
+		zassert_ok(sample_add("1", SAMPLE_TS + i));
+	}
+
+	zassert_equal(nrf_cloud_send_fake.call_count, 1);
+	zassert_equal(nrf_cloud_sensor_batch_count_get(), 0);
+}
+
+ZTEST(nrf_cloud_sensor_batch, test_flush_on_max_age)
+{
+	zassert_ok(sample_add("1", SAMPLE_TS));
+
+	k_sleep(K_MSEC(CONFIG_NRF_CLOUD_SENSOR_BATCH_MAX_AGE * MSEC_PER_SEC + 500));
+
+	zassert_equal(nrf_cloud_send_fake.call_count, 1, "Old batch not sent");
+	zassert_equal(nrf_cloud_sensor_batch_count_get(), 0);
+}
+
+ZTEST(nrf_cloud_sensor_batch, test_send_failure_keeps_samples)
+{
+	nrf_cloud_send_fake.custom_fake = nrf_cloud_send_fail;
+
+	zassert_ok(sample_add("1", SAMPLE_TS));
+	zassert_equal(nrf_cloud_sensor_batch_flush(), -EIO);
+	zassert_equal(nrf_cloud_sensor_batch_count_get(), 1, "Samples lost on failure");
+
+	nrf_cloud_send_fake.custom_fake = nrf_cloud_send_capture;
+	zassert_ok(nrf_cloud_sensor_batch_flush());
+	zassert_equal(nrf_cloud_sensor_batch_count_get(), 0);
+}
+
+ZTEST(nrf_cloud_sensor_batch, test_invalid_samples)
+{
+	static char big[CONFIG_NRF_CLOUD_SENSOR_BATCH_BUF_SIZE];
+	struct nrf_cloud_sensor_data sample = {
+		.type = NRF_CLOUD_SENSOR_HUMID,
+		.data.ptr = "1",
+		.data.len = 1,
+		.ts_ms = SAMPLE_TS
+	};
+
+	zassert_equal(nrf_cloud_sensor_batch_add(NULL), -EINVAL);
+	zassert_equal(nrf_cloud_sensor_batch_add(&sample), -EINVAL, "Unknown type accepted");
+
+	memset(big, 'x', sizeof(big) - 1);
+	zassert_equal(sample_add(big, SAMPLE_TS), -E2BIG);
+	zassert_equal(nrf_cloud_sensor_batch_count_get(), 0);
+	zassert_equal(nrf_cloud_send_fake.call_count, 0);
+}
+
+ZTEST_SUITE(nrf_cloud_sensor_batch, NULL, NULL, batch_before, NULL, NULL);
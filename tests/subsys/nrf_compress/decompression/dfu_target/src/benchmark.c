@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <dfu_target_decompress.h>
+
+#include "decompress_test.h"
+
+/* Typical download client fragment sizes */
+static const size_t bench_fragments[] = { 512, 1024, CONFIG_NRF_COMPRESS_CHUNK_SIZE };
+
+ZTEST(nrf_compress_decompression_dfu_target_benchmark, test_benchmark_throughput)
+{
+	uint32_t start;
+	uint32_t cycles;
+	int rc;
+
+	for (size_t i = 0; i < ARRAY_SIZE(bench_fragments); i++) {
+		file_build(dummy_data_input, dummy_data_input_size, 0, dummy_data_output_size);
+
+		start = k_cycle_get_32();
+
+		rc = dfu_target_decompress_start(file_len, dummy_data_output_size);
+		zassert_ok(rc, "Expected start to be successful");
+
+		rc = file_write(bench_fragments[i]);
+		zassert_ok(rc, "Expected write to be successful");
+
+		rc = dfu_target_decompress_done(true);
+		zassert_ok(rc, "Expected done to be successful");
+
+		cycles = MAX(k_cycle_get_32() - start, 1);
+
+		TC_PRINT("%zu byte fragments: %u cycles, %llu compressed bytes/s, "
+			 "%llu decompressed bytes/s\n", bench_fragments[i], cycles,
+			 ((uint64_t)file_len * sys_clock_hw_cycles_per_sec()) / cycles,
+			 ((uint64_t)stream_written * sys_clock_hw_cycles_per_sec()) / cycles);
+	}
+}
+
+ZTEST(nrf_compress_decompression_dfu_target_benchmark, test_benchmark_ram)
+{
+	size_t unused;
+	int rc;
+
+	file_build(dummy_data_input, dummy_data_input_size, 0, dummy_data_output_size);
+
+	rc = dfu_target_decompress_start(file_len, dummy_data_output_size);
+	zassert_ok(rc, "Expected start to be successful");
+
+	rc = file_write(CONFIG_NRF_COMPRESS_CHUNK_SIZE);
+	zassert_ok(rc, "Expected write to be successful");
+
+	rc = dfu_target_decompress_done(true);
+	zassert_ok(rc, "Expected done to be successful");
+
+	rc = k_thread_stack_space_get(k_current_get(), &unused);
+	zassert_ok(rc, "Expected stack space to be available");
+
+	/* The decompressor dictionary and probabilities, the input buffer, the ARM thumb
+	 * staging buffer and the ARM thumb output buffer, plus the peak stack usage.
+	 */
+	TC_PRINT("Peak RAM: %u bytes decompressor, %u bytes buffers, %zu bytes stack\n",
+		 CONFIG_NRF_COMPRESS_MIN_MEMORY_REQUIRED, 3 * CONFIG_NRF_COMPRESS_CHUNK_SIZE,
+		 CONFIG_ZTEST_STACK_SIZE - unused);
+}
+
+ZTEST_SUITE(nrf_compress_decompression_dfu_target_benchmark, NULL, NULL, NULL, NULL, NULL);
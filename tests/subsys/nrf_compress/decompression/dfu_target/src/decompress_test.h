@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef DECOMPRESS_TEST_H__
+#define DECOMPRESS_TEST_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Input valid lzma2 compressed data */
+extern const uint8_t dummy_data_input[];
+extern const size_t dummy_data_input_size;
+extern const uint32_t dummy_data_output_size;
+
+/* Compressed file built by the tests, header included */
+extern uint8_t file_buf[];
+extern size_t file_len;
+
+/* Bytes written to the stream since the last call to file_build */
+extern size_t stream_written;
+
+/**
+ * @brief Build a compressed file from a header and compressed data in file_buf.
+ */
+void file_build(const uint8_t *payload, size_t payload_len, uint8_t flags, uint32_t image_size);
+
+/**
+ * @brief Feed file_buf to the decompressor in fragments of at most max_fragment bytes.
+ *
+ * @return The first error returned by dfu_target_decompress_write, or 0.
+ */
+int file_write(size_t max_fragment);
+
+#endif /* DECOMPRESS_TEST_H__ */
@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <dfu/dfu_target_stream.h>
+#include <dfu_target_decompress.h>
+#include <mbedtls/sha256.h>
+
+#include "decompress_test.h"
+
+#define SHA256_SIZE 32
+
+/* LZMA2 dictionary size property for 128 KiB, the largest the library accepts */
+#define LZMA2_DICT_PROP_128K 10
+#define LZMA2_HEADER_SIZE 2
+#define LZMA2_STORED_CHUNK_MAX 0x10000
+#define LZMA2_STORED_CHUNK_OVERHEAD 3
+#define LZMA2_CONTROL_END 0x00
+#define LZMA2_CONTROL_STORED_RESET 0x01
+#define LZMA2_CONTROL_STORED 0x02
+
+const uint8_t dummy_data_input[] = {
+#include "dummy_data_input.inc"
+};
+const size_t dummy_data_input_size = sizeof(dummy_data_input);
+
+/* File size and sha256 hash of decompressed data */
+const uint32_t dummy_data_output_size = 66477;
+static const uint8_t dummy_data_output_sha256[] = {
+	0x87, 0xee, 0x2e, 0x17, 0xa5, 0xdb, 0x98, 0xbe,
+	0x8c, 0xcb, 0xfe, 0xc9, 0x70, 0x8c, 0x7a, 0x43,
+	0x66, 0xda, 0x63, 0xff, 0x48, 0x15, 0x48, 0x88,
+	0xd7, 0xed, 0x64, 0x87, 0xba, 0xb9, 0xef, 0xc5
+};
+
+/* ARM thumb filtered data and the expected data once the filter is reverted */
+static const uint8_t thumb_input[] = {
+#include "arm_thumb_compressed.inc"
+};
+
+static const uint8_t thumb_output[] = {
+#include "arm_thumb.inc"
+};
+
+/* The filtered data wrapped in stored LZMA2 chunks */
+#define THUMB_PAYLOAD_MAX (LZMA2_HEADER_SIZE + sizeof(thumb_input) + 1 +			\
+			   LZMA2_STORED_CHUNK_OVERHEAD *						\
+			   DIV_ROUND_UP(sizeof(thumb_input), LZMA2_STORED_CHUNK_MAX))
+
+static uint8_t thumb_payload[THUMB_PAYLOAD_MAX];
+
+uint8_t file_buf[sizeof(struct dfu_target_decompress_header) +
+		 MAX(sizeof(dummy_data_input), THUMB_PAYLOAD_MAX)];
+size_t file_len;
+size_t stream_written;
+
+static bool hashing;
+static mbedtls_sha256_context sha_ctx;
+static const uint8_t *expected;
+
+/* Stands in for the flash stream, checking the decompressed data instead */
+int dfu_target_stream_write(const uint8_t *buf, size_t len)
+{
+	if (expected != NULL) {
+		zassert_mem_equal(buf, &expected[stream_written], len,
+				  "Expected decompressed data to match at %zu", stream_written);
+	}
+
+	if (hashing) {
+		zassert_ok(mbedtls_sha256_update(&sha_ctx, buf, len),
+			   "Expected hash update to be successful");
+	}
+
+	stream_written += len;
+
+	return 0;
+}
+
+void file_build(const uint8_t *payload, size_t payload_len, uint8_t flags, uint32_t image_size)
+{
+	struct dfu_target_decompress_header *hdr = (struct dfu_target_decompress_header *)file_buf;
+
+	zassert_true(sizeof(*hdr) + payload_len <= sizeof(file_buf), "Payload too large");
+
+	sys_put_le32(DFU_TARGET_DECOMPRESS_MAGIC, (uint8_t *)&hdr->magic);
+	hdr->version = DFU_TARGET_DECOMPRESS_VERSION;
+	hdr->flags = flags;
+	sys_put_le16(sizeof(*hdr), (uint8_t *)&hdr->header_size);
+	sys_put_le32(image_size, (uint8_t *)&hdr->image_size);
+
+	memcpy(&file_buf[sizeof(*hdr)], payload, payload_len);
+	file_len = sizeof(*hdr) + payload_len;
+	stream_written = 0;
+}
+
+int file_write(size_t fragment)
+{
+	int rc;
+
+	for (size_t pos = 0; pos < file_len; pos += fragment) {
+		rc = dfu_target_decompress_write(&file_buf[pos], MIN(fragment, file_len - pos));
+		if (rc != 0) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+/* Wrap data in stored LZMA2 chunks, which pass through the decoder as is */
+static size_t lzma2_stored_build(uint8_t *out, const uint8_t *data, size_t len)
+{
+	size_t pos = 0;
+	size_t chunk;
+
+	out[pos++] = LZMA2_DICT_PROP_128K;
+	out[pos++] = 0;
+
+	for (size_t i = 0; i < len; i += chunk) {
+		chunk = MIN(len - i, LZMA2_STORED_CHUNK_MAX);
+
+		out[pos++] = (i == 0) ? LZMA2_CONTROL_STORED_RESET : LZMA2_CONTROL_STORED;
+		sys_put_be16(chunk - 1, &out[pos]);
+		pos += sizeof(uint16_t);
+		memcpy(&out[pos], &data[i], chunk);
+		pos += chunk;
+	}
+
+	out[pos++] = LZMA2_CONTROL_END;
+
+	return pos;
+}
+
+static void hash_start(void)
+{
+	mbedtls_sha256_init(&sha_ctx);
+	zassert_ok(mbedtls_sha256_starts(&sha_ctx, false),
+		   "Expected mbedtls sha256 start to be successful");
+	hashing = true;
+}
+
+static void hash_check(const uint8_t *sha)
+{
+	uint8_t output_sha[SHA256_SIZE] = { 0 };
+	int rc;
+
+	hashing = false;
+	rc = mbedtls_sha256_finish(&sha_ctx, output_sha);
+	mbedtls_sha256_free(&sha_ctx);
+	zassert_ok(rc, "Expected mbedtls sha256 finish to be successful");
+	zassert_mem_equal(output_sha, sha, SHA256_SIZE, "Expected hash to match");
+}
+
+static void test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	expected = NULL;
+	hashing = false;
+	dfu_target_decompress_reset();
+}
+
+ZTEST(nrf_compress_decompression_dfu_target, test_identify)
+{
+	file_build(dummy_data_input, sizeof(dummy_data_input), 0, dummy_data_output_size);
+
+	zassert_true(dfu_target_decompress_identify(file_buf),
+		     "Expected compressed image header to be identified");
+
+	file_buf[0] ^= 0xff;
+
+	zassert_false(dfu_target_decompress_identify(file_buf),
+		      "Expected other data to not be identified");
+}
+
+ZTEST(nrf_compress_decompression_dfu_target, test_lzma_fragments)
+{
+	/* Fragments smaller than the header, odd sizes and sizes above the chunk size */
+	const size_t fragments[] = { 1, 7, 509, CONFIG_NRF_COMPRESS_CHUNK_SIZE, 4099 };
+	int rc;
+
+	for (size_t i = 0; i < ARRAY_SIZE(fragments); i++) {
+		file_build(dummy_data_input, sizeof(dummy_data_input), 0,
+			   dummy_data_output_size);
+		hash_start();
+
+		rc = dfu_target_decompress_start(file_len, dummy_data_output_size);
+		zassert_ok(rc, "Expected start to be successful");
+
+		rc = file_write(fragments[i]);
+		zassert_ok(rc, "Expected write to be successful with %zu byte fragments",
+			   fragments[i]);
+
+		zassert_equal(dfu_target_decompress_offset(), file_len,
+			      "Expected offset to be the compressed file size");
+		zassert_equal(stream_written, dummy_data_output_size,
+			      "Expected decompressed data size to match");
+
+		rc = dfu_target_decompress_done(true);
+		zassert_ok(rc, "Expected done to be successful");
+		zassert_false(dfu_target_decompress_active(), "Expected to not be active");
+
+		hash_check(dummy_data_output_sha256);
+	}
+}
+
+ZTEST(nrf_compress_decompression_dfu_target, test_arm_thumb_fragments)
+{
+	const size_t fragments[] = { 3, 1022, CONFIG_NRF_COMPRESS_CHUNK_SIZE + 2 };
+	size_t payload_len;
+	int rc;
+
+	payload_len = lzma2_stored_build(thumb_payload, thumb_input, sizeof(thumb_input));
+	expected = thumb_output;
+
+	for (size_t i = 0; i < ARRAY_SIZE(fragments); i++) {
+		file_build(thumb_payload, payload_len, DFU_TARGET_DECOMPRESS_FLAG_ARM_THUMB,
+			   sizeof(thumb_output));
+
+		rc = dfu_target_decompress_start(file_len, sizeof(thumb_output));
+		zassert_ok(rc, "Expected start to be successful");
+
+		rc = file_write(fragments[i]);
+		zassert_ok(rc, "Expected write to be successful with %zu byte fragments",
+			   fragments[i]);
+		zassert_equal(stream_written, sizeof(thumb_output),
+			      "Expected decompressed data size to match");
+
+		rc = dfu_target_decompress_done(true);
+		zassert_ok(rc, "Expected done to be successful");
+	}
+}
+
+ZTEST(nrf_compress_decompression_dfu_target, test_image_too_large)
+{
+	int rc;
+
+	file_build(dummy_data_input, sizeof(dummy_data_input), 0, dummy_data_output_size);
+
+	rc = dfu_target_decompress_start(file_len, dummy_data_output_size - 1);
+	zassert_ok(rc, "Expected start to be successful");
+
+	rc = file_write(CONFIG_NRF_COMPRESS_CHUNK_SIZE);
+	zassert_equal(rc, -EFBIG, "Expected image larger than the slot to fail");
+	zassert_equal(stream_written, 0, "Expected nothing to be written");
+}
+
+ZTEST(nrf_compress_decompression_dfu_target, test_image_size_mismatch)
+{
+	int rc;
+
+	file_build(dummy_data_input, sizeof(dummy_data_input), 0, dummy_data_output_size - 1);
+
+	rc = dfu_target_decompress_start(file_len, dummy_data_output_size);
+	zassert_ok(rc, "Expected start to be successful");
+
+	rc = file_write(CONFIG_NRF_COMPRESS_CHUNK_SIZE);
+	zassert_equal(rc, -EFBIG, "Expected more data than announced to fail");
+
+	file_build(dummy_data_input, sizeof(dummy_data_input), 0, dummy_data_output_size + 1);
+
+	rc = dfu_target_decompress_start(file_len, dummy_data_output_size + 1);
+	zassert_ok(rc, "Expected start to be successful");
+
+	rc = file_write(CONFIG_NRF_COMPRESS_CHUNK_SIZE);
+	zassert_equal(rc, -EINVAL, "Expected less data than announced to fail");
+}
+
+ZTEST(nrf_compress_decompression_dfu_target, test_bad_header)
+{
+	struct dfu_target_decompress_header *hdr = (struct dfu_target_decompress_header *)file_buf;
+	int rc;
+
+	file_build(dummy_data_input, sizeof(dummy_data_input), 0, dummy_data_output_size);
+	hdr->version = DFU_TARGET_DECOMPRESS_VERSION + 1;
+
+	rc = dfu_target_decompress_start(file_len, dummy_data_output_size);
+	zassert_ok(rc, "Expected start to be successful");
+
+	rc = file_write(CONFIG_NRF_COMPRESS_CHUNK_SIZE);
+	zassert_equal(rc, -EINVAL, "Expected unknown version to fail");
+
+	file_build(dummy_data_input, sizeof(dummy_data_input), BIT(7), dummy_data_output_size);
+
+	rc = dfu_target_decompress_start(file_len, dummy_data_output_size);
+	zassert_ok(rc, "Expected start to be successful");
+
+	rc = file_write(CONFIG_NRF_COMPRESS_CHUNK_SIZE);
+	zassert_equal(rc, -ENOTSUP, "Expected unknown flags to fail");
+}
+
+ZTEST(nrf_compress_decompression_dfu_target, test_incomplete)
+{
+	int rc;
+
+	file_build(dummy_data_input, sizeof(dummy_data_input), 0, dummy_data_output_size);
+
+	rc = dfu_target_decompress_start(file_len, dummy_data_output_size);
+	zassert_ok(rc, "Expected start to be successful");
+
+	rc = dfu_target_decompress_write(file_buf, file_len / 2);
+	zassert_ok(rc, "Expected write to be successful");
+	zassert_equal(dfu_target_decompress_offset(), file_len / 2,
+		      "Expected offset to follow the written data");
+
+	rc = dfu_target_decompress_done(true);
+	zassert_equal(rc, -EINVAL, "Expected done on an incomplete file to fail");
+}
+
+ZTEST_SUITE(nrf_compress_decompression_dfu_target, NULL, NULL, test_before, NULL, NULL);
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <suit_dfu_cache.h>
+
+#define BENCH_ENTRIES	  300
+#define BENCH_POOL_SPLIT  200
+#define BENCH_URI_FMT	  "http://cache.example.com/component_%03u.bin"
+#define BENCH_URI_LEN	  (sizeof("http://cache.example.com/component_000.bin") - 1)
+#define BENCH_PAYLOAD_LEN 4
+/* tstr header with one byte length, URI, bstr header and payload */
+#define BENCH_ENTRY_LEN	  (2 + BENCH_URI_LEN + 1 + BENCH_PAYLOAD_LEN)
+
+BUILD_ASSERT(BENCH_URI_LEN <= UINT8_MAX, "URI length must fit in a one byte tstr header");
+
+static uint8_t bench_pools[2][1 + BENCH_ENTRIES * BENCH_ENTRY_LEN + 1];
+static size_t bench_pools_len[2];
+
+static void bench_uri(char *uri, unsigned int idx)
+{
+	snprintf(uri, BENCH_URI_LEN + 1, BENCH_URI_FMT, idx);
+}
+
+/* Build an indefinite CBOR map with entries first to last - 1 */
+static size_t bench_pool_build(uint8_t *pool, unsigned int first, unsigned int last)
+{
+	char uri[BENCH_URI_LEN + 1];
+	size_t len = 0;
+
+	pool[len++] = 0xBF;
+
+	for (unsigned int i = first; i < last; i++) {
+		bench_uri(uri, i);
+
+		pool[len++] = 0x78;
+		pool[len++] = BENCH_URI_LEN;
+		memcpy(&pool[len], uri, BENCH_URI_LEN);
+		len += BENCH_URI_LEN;
+
+		pool[len++] = 0x40 + BENCH_PAYLOAD_LEN;
+		sys_put_le32(i, &pool[len]);
+		len += BENCH_PAYLOAD_LEN;
+	}
+
+	pool[len++] = 0xFF;
+
+	return len;
+}
+
+static void bench_before(void *f)
+{
+	struct dfu_cache dfu_caches;
+
+	zassert_between_inclusive(2, 1, CONFIG_SUIT_CACHE_MAX_CACHES,
+				  "Failed to prepare test fixture: cache is too small");
+
+	suit_dfu_cache_deinitialize();
+
+	bench_pools_len[0] = bench_pool_build(bench_pools[0], 0, BENCH_POOL_SPLIT);
+	/* The last entry of the first pool is also in the second one */
+	bench_pools_len[1] = bench_pool_build(bench_pools[1], BENCH_POOL_SPLIT - 1, BENCH_ENTRIES);
+
+	for (size_t i = 0; i < ARRAY_SIZE(bench_pools); i++) {
+		dfu_caches.pools[i].address = bench_pools[i];
+		dfu_caches.pools[i].size = bench_pools_len[i];
+	}
+	dfu_caches.pools_count = ARRAY_SIZE(bench_pools);
+
+	suit_plat_err_t rc = suit_dfu_cache_initialize(&dfu_caches);
+
+	zassert_equal(rc, SUIT_PLAT_SUCCESS, "Failed to initialize cache: %i", rc);
+}
+
+static void bench_after(void *f)
+{
+	suit_dfu_cache_deinitialize();
+}
+
+ZTEST(cache_benchmark, test_search_all_entries)
+{
+	char uri[BENCH_URI_LEN + 1];
+	const uint8_t *payload;
+	size_t payload_size;
+	suit_plat_err_t ret;
+	bool in_first_pool;
+
+	for (unsigned int i = 0; i < BENCH_ENTRIES; i++) {
+		bench_uri(uri, i);
+
+		ret = suit_dfu_cache_search((const uint8_t *)uri, sizeof(uri), &payload,
+					    &payload_size);
+		zassert_equal(ret, SUIT_PLAT_SUCCESS, "Entry %u not found", i);
+		zassert_equal(payload_size, BENCH_PAYLOAD_LEN, "Wrong payload size for entry %u",
+			      i);
+		zassert_equal(sys_get_le32(payload), i, "Wrong payload for entry %u", i);
+
+		/* The entry present in both pools is taken from the first one */
+		in_first_pool = (payload > bench_pools[0]) &&
+				(payload < bench_pools[0] + bench_pools_len[0]);
+		zassert_equal(in_first_pool, i < BENCH_POOL_SPLIT,
+			      "Entry %u found in the wrong pool", i);
+	}
+}
+
+ZTEST(cache_benchmark, test_benchmark_search)
+{
+	char uri[BENCH_URI_LEN + 1];
+	const uint8_t *payload;
+	size_t payload_size;
+	suit_plat_err_t ret;
+	uint32_t first_cycles;
+	uint32_t hit_cycles;
+	uint32_t miss_cycles;
+	uint32_t start;
+
+	/* The first search indexes the cache */
+	bench_uri(uri, 0);
+	start = k_cycle_get_32();
+	ret = suit_dfu_cache_search((const uint8_t *)uri, sizeof(uri), &payload, &payload_size);
+	first_cycles = k_cycle_get_32() - start;
+	zassert_equal(ret, SUIT_PLAT_SUCCESS, "Entry not found");
+
+	start = k_cycle_get_32();
+
+	for (unsigned int i = 0; i < BENCH_ENTRIES; i++) {
+		bench_uri(uri, i);
+		(void)suit_dfu_cache_search((const uint8_t *)uri, sizeof(uri), &payload,
+					    &payload_size);
+	}
+
+	hit_cycles = k_cycle_get_32() - start;
+
+	start = k_cycle_get_32();
+
+	for (unsigned int i = 0; i < BENCH_ENTRIES; i++) {
+		bench_uri(uri, BENCH_ENTRIES + i);
+		(void)suit_dfu_cache_search((const uint8_t *)uri, sizeof(uri), &payload,
+					    &payload_size);
+	}
+
+	miss_cycles = k_cycle_get_32() - start;
+
+	TC_PRINT("%u cache entries: first search %u cycles, %u cycles per hit, "
+		 "%u cycles per miss\n", BENCH_ENTRIES, first_cycles, hit_cycles / BENCH_ENTRIES,
+		 miss_cycles / BENCH_ENTRIES);
+}
+
+ZTEST_SUITE(cache_benchmark, NULL, NULL, bench_before, bench_after, NULL);
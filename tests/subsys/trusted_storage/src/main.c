@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <psa/internal_trusted_storage.h>
+
+#define UID_SMALL	0x5001
+#define UID_LARGE	0x5002
+#define SMALL_SIZE	32
+#define LARGE_SIZE	CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_MAX_DATA_SIZE
+#define PARTIAL_SIZE	16
+#define LATENCY_ROUNDS	100
+
+static uint8_t data_in[LARGE_SIZE];
+static uint8_t data_out[LARGE_SIZE];
+
+static void data_fill(uint8_t seed)
+{
+	for (size_t i = 0; i < sizeof(data_in); i++) {
+		data_in[i] = seed + i * 7;
+	}
+}
+
+ZTEST(trusted_storage, test_get)
+{
+	size_t offsets[] = { 0, 1, 63, 64, 65, 200, LARGE_SIZE - 1 };
+	size_t out_len;
+
+	data_fill(1);
+	zassert_equal(psa_its_set(UID_LARGE, LARGE_SIZE, data_in, PSA_STORAGE_FLAG_NONE),
+		      PSA_SUCCESS);
+
+	zassert_equal(psa_its_get(UID_LARGE, 0, LARGE_SIZE, data_out, &out_len), PSA_SUCCESS);
+	zassert_equal(out_len, LARGE_SIZE);
+	zassert_mem_equal(data_out, data_in, LARGE_SIZE);
+
+	for (size_t i = 0; i < ARRAY_SIZE(offsets); i++) {
+		size_t len = MIN(100, LARGE_SIZE - offsets[i]);
+
+		memset(data_out, 0, sizeof(data_out));
+		zassert_equal(psa_its_get(UID_LARGE, offsets[i], len, data_out, &out_len),
+			      PSA_SUCCESS);
+		zassert_equal(out_len, len);
+		zassert_mem_equal(data_out, &data_in[offsets[i]], len, "Wrong data at %zu",
+				  offsets[i]);
+	}
+
+	/* Reads past the end of the object are truncated */
+	zassert_equal(psa_its_set(UID_SMALL, SMALL_SIZE, data_in, PSA_STORAGE_FLAG_NONE),
+		      PSA_SUCCESS);
+	zassert_equal(psa_its_get(UID_SMALL, SMALL_SIZE - 4, 16, data_out, &out_len),
+		      PSA_SUCCESS);
+	zassert_equal(out_len, 4);
+	zassert_mem_equal(data_out, &data_in[SMALL_SIZE - 4], 4);
+	zassert_equal(psa_its_get(UID_SMALL, SMALL_SIZE + 1, 16, data_out, &out_len),
+		      PSA_ERROR_INVALID_ARGUMENT);
+}
+
+ZTEST(trusted_storage, test_overwrite)
+{
+	struct psa_storage_info_t info;
+	size_t out_len;
+
+	data_fill(2);
+	zassert_equal(psa_its_set(UID_SMALL, SMALL_SIZE, data_in, PSA_STORAGE_FLAG_NONE),
+		      PSA_SUCCESS);
+	zassert_equal(psa_its_get(UID_SMALL, 0, SMALL_SIZE, data_out, &out_len), PSA_SUCCESS);
+	zassert_mem_equal(data_out, data_in, SMALL_SIZE);
+
+	/* A new value replaces the old one, also if it has been read before */
+	data_fill(3);
+	zassert_equal(psa_its_set(UID_SMALL, SMALL_SIZE / 2, data_in, PSA_STORAGE_FLAG_NONE),
+		      PSA_SUCCESS);
+	zassert_equal(psa_its_get(UID_SMALL, 0, SMALL_SIZE, data_out, &out_len), PSA_SUCCESS);
+	zassert_equal(out_len, SMALL_SIZE / 2);
+	zassert_mem_equal(data_out, data_in, SMALL_SIZE / 2);
+
+	zassert_equal(psa_its_get_info(UID_SMALL, &info), PSA_SUCCESS);
+	zassert_equal(info.size, SMALL_SIZE / 2);
+	zassert_equal(info.flags, PSA_STORAGE_FLAG_NONE);
+
+	zassert_equal(psa_its_remove(UID_SMALL), PSA_SUCCESS);
+	zassert_equal(psa_its_get(UID_SMALL, 0, SMALL_SIZE, data_out, &out_len),
+		      PSA_ERROR_DOES_NOT_EXIST);
+}
+
+static void get_latency(psa_storage_uid_t uid, size_t size, size_t offset, size_t len)
+{
+	uint32_t start;
+	uint32_t cycles;
+	size_t out_len;
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < LATENCY_ROUNDS; i++) {
+		zassert_equal(psa_its_get(uid, offset, len, data_out, &out_len), PSA_SUCCESS);
+	}
+	cycles = k_cycle_get_32() - start;
+
+	TC_PRINT("psa_its_get of %zu of %zu bytes: %llu us\n", len, size,
+		 k_cyc_to_us_floor64(cycles / LATENCY_ROUNDS));
+}
+
+ZTEST(trusted_storage, test_get_latency)
+{
+	data_fill(4);
+	zassert_equal(psa_its_set(UID_SMALL, SMALL_SIZE, data_in, PSA_STORAGE_FLAG_NONE),
+		      PSA_SUCCESS);
+	zassert_equal(psa_its_set(UID_LARGE, LARGE_SIZE, data_in, PSA_STORAGE_FLAG_NONE),
+		      PSA_SUCCESS);
+
+	get_latency(UID_SMALL, SMALL_SIZE, 0, SMALL_SIZE);
+	get_latency(UID_LARGE, LARGE_SIZE, 0, LARGE_SIZE);
+	get_latency(UID_LARGE, LARGE_SIZE, LARGE_SIZE - PARTIAL_SIZE, PARTIAL_SIZE);
+}
+
+static void *trusted_storage_setup(void)
+{
+	zassert_equal(settings_subsys_init(), 0, "Settings init failed");
+
+	return NULL;
+}
+
+ZTEST_SUITE(trusted_storage, NULL, trusted_storage_setup, NULL, NULL, NULL);